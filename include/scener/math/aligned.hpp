@@ -0,0 +1,140 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_ALIGNED_HPP
+#define SCENER_MATH_ALIGNED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include "scener/math/basic_matrix.hpp"
+#include "scener/math/basic_quaternion.hpp"
+#include "scener/math/basic_vector.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// A math type stored at the given alignment.
+    ///
+    /// Derives from the wrapped type, so every operation on it accepts aligned values as they are. Results of those
+    /// operations are of the wrapped type and convert back implicitly. The size is rounded up to the alignment, so an
+    /// aligned vector4 of floats is 16 bytes and an aligned matrix4 of floats is 64 bytes, with no padding between the
+    /// elements of an array; use aligned_allocator to align containers of the unwrapped types instead.
+    template <typename T, std::size_t Alignment>
+    struct alignas(Alignment) aligned final : T
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "the alignment must be a power of two");
+        static_assert(Alignment >= alignof(T), "the alignment must not be weaker than the alignment of the type");
+
+    public:
+        using T::T;
+
+        /// Initializes a new instance of the aligned struct.
+        constexpr aligned() noexcept
+            : T { }
+        {
+        }
+
+        /// Initializes a new instance of the aligned struct with the given value.
+        /// \param value the value to copy.
+        constexpr aligned(const T& value) noexcept
+            : T { value }
+        {
+        }
+    };
+
+    /// Allocates storage aligned to the given boundary, for containers of math types that must be loaded with aligned
+    /// SIMD instructions or must not straddle cache lines (a 64 bytes alignment keeps every matrix4 of floats in a
+    /// single cache line).
+    template <typename T, std::size_t Alignment = alignof(T)>
+    class aligned_allocator
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "the alignment must be a power of two");
+        static_assert(Alignment >= alignof(T), "the alignment must not be weaker than the alignment of the type");
+
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = aligned_allocator<U, Alignment>;
+        };
+
+    public:
+        /// Initializes a new instance of the aligned_allocator class.
+        constexpr aligned_allocator() noexcept = default;
+
+        /// Initializes a new instance of the aligned_allocator class from an allocator of another type.
+        template <typename U>
+        constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+        {
+        }
+
+    public:
+        /// Allocates uninitialized storage for the given number of objects.
+        /// \param count the number of objects.
+        /// \returns a pointer to the storage, aligned to the allocator alignment.
+        T* allocate(std::size_t count)
+        {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            {
+                throw std::bad_array_new_length();
+            }
+
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t { Alignment }));
+        }
+
+        /// Deallocates storage obtained from allocate.
+        /// \param pointer the storage to deallocate.
+        /// \param count the number of objects the storage was allocated for.
+        void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            ::operator delete(pointer, count * sizeof(T), std::align_val_t { Alignment });
+        }
+    };
+
+    template <typename T, typename U, std::size_t Alignment>
+    constexpr bool operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U, std::size_t Alignment>
+    constexpr bool operator!=(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+    {
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    template <typename T>
+    using basic_aligned_vector4 = aligned<basic_vector4<T>, (sizeof(T) * 4 <= 16) ? 16 : 32>;
+
+    template <typename T>
+    using basic_aligned_quaternion = aligned<basic_quaternion<T>, (sizeof(T) * 4 <= 16) ? 16 : 32>;
+
+    template <typename T>
+    using basic_aligned_matrix4 = aligned<basic_matrix4<T>, 32>;
+
+    using aligned_vector4    = basic_aligned_vector4<float>;
+    using aligned_quaternion = basic_aligned_quaternion<float>;
+    using aligned_matrix4    = basic_aligned_matrix4<float>;
+
+    namespace detail
+    {
+        /// Checks whether an address is a multiple of the given alignment.
+        inline bool is_aligned(const void* pointer, std::size_t alignment) noexcept
+        {
+            return (reinterpret_cast<std::uintptr_t>(pointer) & (alignment - 1)) == 0;
+        }
+
+    }
+}
+
+#endif // SCENER_MATH_ALIGNED_HPP
@@ -31,7 +31,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Represents a generic angle.
-    template <typename T, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_angle
     {
         using value_type      = typename std::remove_reference_t<typename std::remove_cv_t<T>>;
@@ -232,82 +232,82 @@ namespace scener::math
     // OPERATORS (WITH SCALARS)
 
     /// Equality operator for comparing basic_angle instances against scalar values.
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator==(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return equal(lhs.value, rhs);
     }
 
     /// Inequality operator for comparing basic_angle instances against scalar values.
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator!=(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
     /// Equality operator for comparing scalar values against basic_angle instances.
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator==(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return equal(lhs, rhs.value);
     }
 
     /// Inequality operator for comparing scalar values against basic_angle instances.
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator!=(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator<(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return (lhs.value < rhs);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator<=(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return (lhs.value <= rhs);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator>(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return (lhs.value > rhs);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator>=(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         return (lhs.value >= rhs);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator<(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return (lhs < rhs.value);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator<=(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return (lhs <= rhs.value);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator>(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return (lhs > rhs.value);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr bool operator>=(const S& lhs, const basic_angle<T, Unit>& rhs) noexcept
     {
         return (lhs >= rhs.value);
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit>& operator*=(basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         lhs.value *= rhs;
@@ -315,7 +315,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit> operator*(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -325,7 +325,7 @@ namespace scener::math
         return result;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit>& operator/=(basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         lhs.value /= rhs;
@@ -333,7 +333,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit> operator/(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -343,7 +343,7 @@ namespace scener::math
         return result;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit>& operator-=(basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         lhs.value -= rhs;
@@ -351,7 +351,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit> operator-(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -361,7 +361,7 @@ namespace scener::math
         return result;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit>& operator+=(basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         lhs.value += rhs;
@@ -369,7 +369,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename Unit, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_angle<T, Unit> operator+(const basic_angle<T, Unit>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
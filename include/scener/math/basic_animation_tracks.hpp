@@ -0,0 +1,560 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_ANIMATION_TRACKS_HPP
+#define SCENER_MATH_BASIC_ANIMATION_TRACKS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/aligned.hpp"
+#include "scener/math/curve_interpolation.hpp"
+#include "scener/math/quaternion.hpp"
+#include "scener/math/simd.hpp"
+#include "scener/math/vector.hpp"
+
+namespace scener::math
+{
+    namespace detail
+    {
+        /// Describes the values an animation track can hold.
+        template <typename Value>
+        struct animation_value;
+
+        template <std::size_t Dimension>
+        struct animation_value<basic_vector<float, Dimension>>
+        {
+            constexpr static std::size_t components = Dimension;
+            constexpr static bool        rotation   = false;
+        };
+
+        template <>
+        struct animation_value<basic_quaternion<float>>
+        {
+            constexpr static std::size_t components = 4;
+            constexpr static bool        rotation   = true;
+        };
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Set of animation tracks, each one a sequence of keys holding vectors or rotations, all of them interpolated the
+    /// same way.
+    ///
+    /// Key times and every component of the key values are stored in separate arrays, with the keys of a track next
+    /// to each other. Every track keeps a cursor on the segment sampled last together with the time range it covers,
+    /// so sampling at coherent times only compares the time against that range; the keys are searched again only
+    /// when it falls outside, one step forward in the common case of playback moving to the next key.
+    ///
+    /// The batch evaluation samples several tracks at once, one per simd lane, with the same formulas as
+    /// vector::lerp, vector::hermite, vector::catmull_rom and quat::slerp.
+    template <typename Value>
+    class basic_animation_tracks final
+    {
+    public:
+        /// Identifies a track of the set.
+        using track_type = std::uint32_t;
+
+        /// Number of components of the track values.
+        constexpr static std::size_t components = detail::animation_value<Value>::components;
+
+    public:
+        /// Initializes a new instance of the basic_animation_tracks class.
+        /// \param interpolation the interpolation between keys; rotations support step and linear interpolation.
+        explicit basic_animation_tracks(curve_interpolation interpolation = curve_interpolation::linear) noexcept
+            : _interpolation { interpolation }
+            , _times         { }
+            , _values        { }
+            , _tangents      { }
+            , _first         { }
+            , _count         { }
+            , _cursor        { }
+            , _lower         { }
+            , _upper         { }
+            , _start         { }
+            , _length        { }
+        {
+            Expects(!detail::animation_value<Value>::rotation || interpolation == curve_interpolation::step
+                                                              || interpolation == curve_interpolation::linear);
+        }
+
+    public:
+        /// Gets the interpolation between keys.
+        /// \returns the interpolation between keys.
+        curve_interpolation interpolation() const noexcept
+        {
+            return _interpolation;
+        }
+
+        /// Gets the number of tracks.
+        /// \returns the number of tracks.
+        std::size_t size() const noexcept
+        {
+            return _first.size();
+        }
+
+        /// Gets the number of keys of all the tracks.
+        /// \returns the number of keys of all the tracks.
+        std::size_t key_count() const noexcept
+        {
+            return _times.size();
+        }
+
+        /// Reserves storage for the given number of tracks and keys.
+        /// \param tracks the number of tracks.
+        /// \param keys the number of keys of all the tracks.
+        void reserve(std::size_t tracks, std::size_t keys)
+        {
+            _times.reserve(keys);
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                _values[c].reserve(keys);
+
+                if (_interpolation == curve_interpolation::hermite)
+                {
+                    _tangents[c].reserve(keys);
+                }
+            }
+
+            _first.reserve(tracks);
+            _count.reserve(tracks);
+            _cursor.reserve(tracks);
+            _lower.reserve(tracks);
+            _upper.reserve(tracks);
+            _start.reserve(tracks);
+            _length.reserve(tracks);
+        }
+
+        /// Adds a track.
+        /// \param times the increasing times of the keys, at least one.
+        /// \param values the key values, of the same size as times.
+        /// \returns the new track.
+        track_type add(gsl::span<const float> times, gsl::span<const Value> values)
+        {
+            Expects(_interpolation != curve_interpolation::hermite);
+
+            return add_track(times, values, { });
+        }
+
+        /// Adds a track interpolated with hermite splines.
+        /// \param times the increasing times of the keys, at least one.
+        /// \param values the key values, of the same size as times.
+        /// \param tangents the key tangents, as rates of change per unit of time; of the same size as times.
+        /// \returns the new track.
+        track_type add(gsl::span<const float> times, gsl::span<const Value> values, gsl::span<const Value> tangents)
+        {
+            Expects(_interpolation == curve_interpolation::hermite && tangents.size() == times.size());
+
+            return add_track(times, values, tangents);
+        }
+
+        /// Removes all the tracks.
+        void clear() noexcept
+        {
+            _times.clear();
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                _values[c].clear();
+                _tangents[c].clear();
+            }
+
+            _first.clear();
+            _count.clear();
+            _cursor.clear();
+            _lower.clear();
+            _upper.clear();
+            _start.clear();
+            _length.clear();
+        }
+
+    public:
+        /// Samples a track; times outside the keys are clamped.
+        /// \param track the track.
+        /// \param time the time.
+        /// \returns the value of the track at the given time.
+        Value evaluate(track_type track, float time) noexcept
+        {
+            Expects(track < size());
+
+            if (time < _lower[track] || time >= _upper[track])
+            {
+                seek(track, time);
+            }
+
+            auto amount = (_length[track] > 0.0f) ? std::clamp((time - _start[track]) / _length[track], 0.0f, 1.0f)
+                                                  : 0.0f;
+            auto index  = _first[track] + _cursor[track];
+            auto next   = index + ((_count[track] > 1) ? 1 : 0);
+
+            switch (_interpolation)
+            {
+            case curve_interpolation::step:
+                return key(amount < 1.0f ? index : next);
+
+            case curve_interpolation::linear:
+                if constexpr (detail::animation_value<Value>::rotation)
+                {
+                    return quat::slerp(key(index), key(next), amount);
+                }
+                else
+                {
+                    return vector::lerp(key(index), key(next), amount);
+                }
+
+            case curve_interpolation::hermite:
+                if constexpr (!detail::animation_value<Value>::rotation)
+                {
+                    return vector::hermite(key(index)
+                                         , tangent(index) * _length[track]
+                                         , key(next)
+                                         , tangent(next) * _length[track]
+                                         , amount);
+                }
+                break;
+
+            case curve_interpolation::catmull_rom:
+                if constexpr (!detail::animation_value<Value>::rotation)
+                {
+                    return vector::catmull_rom(key(previous_of(track, index))
+                                             , key(index)
+                                             , key(next)
+                                             , key(next_of(track, next))
+                                             , amount);
+                }
+                break;
+            }
+
+            return key(index);
+        }
+
+        /// Samples all the tracks at the same time; times outside the keys of a track are clamped.
+        /// \param time the time.
+        /// \param result the values of the tracks, of the same size as the set.
+        void evaluate(float time, gsl::span<Value> result) noexcept
+        {
+            Expects(result.size() == size());
+
+            evaluate_tracks([time](auto, auto lanes) { return decltype(lanes) { time }; }, result);
+        }
+
+        /// Samples every track at its own time; times outside the keys of a track are clamped.
+        /// \param times the time of every track, of the same size as the set.
+        /// \param result the values of the tracks, of the same size as the set.
+        void evaluate(gsl::span<const float> times, gsl::span<Value> result) noexcept
+        {
+            Expects(times.size() == size() && result.size() == size());
+
+            evaluate_tracks([&times](std::size_t first, auto lanes)
+            {
+                return decltype(lanes)::load(times.data() + first);
+            }, result);
+        }
+
+    private:
+        using float_array = std::vector<float, aligned_allocator<float, 64>>;
+        using index_array = std::vector<std::uint32_t>;
+
+    private:
+        track_type add_track(gsl::span<const float> times
+                           , gsl::span<const Value> values
+                           , gsl::span<const Value> tangents)
+        {
+            Expects(!times.empty() && times.size() == values.size());
+            Expects(std::is_sorted(times.begin(), times.end()));
+            Expects(_times.size() + times.size() <= std::numeric_limits<std::uint32_t>::max());
+
+            auto track = static_cast<track_type>(size());
+
+            _first.push_back(static_cast<std::uint32_t>(_times.size()));
+            _count.push_back(static_cast<std::uint32_t>(times.size()));
+            _times.insert(_times.end(), times.begin(), times.end());
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                for (const auto& value : values)
+                {
+                    _values[c].push_back(value[c]);
+                }
+
+                for (const auto& tangent : tangents)
+                {
+                    _tangents[c].push_back(tangent[c]);
+                }
+            }
+
+            // Tracks with a single key hold it at any time, and never need to seek
+            _cursor.push_back(0);
+            _lower.push_back(-std::numeric_limits<float>::infinity());
+            _upper.push_back(std::numeric_limits<float>::infinity());
+            _start.push_back(times[0]);
+            _length.push_back(0.0f);
+
+            if (times.size() > 1)
+            {
+                seek(track, times[0]);
+            }
+
+            return track;
+        }
+
+        void seek(std::size_t track, float time) noexcept
+        {
+            auto count = std::size_t { _count[track] };
+
+            if (count < 2)
+            {
+                return;
+            }
+
+            auto        times   = gsl::span<const float>(_times.data() + _first[track], count);
+            std::size_t segment = _cursor[track];
+
+            detail::locate(times, time, segment);
+
+            // The first and the last segments also cover the times clamped to them
+            _cursor[track] = static_cast<std::uint32_t>(segment);
+            _lower[track]  = (segment == 0) ? -std::numeric_limits<float>::infinity() : times[segment];
+            _upper[track]  = (segment + 2 == count) ? std::numeric_limits<float>::infinity() : times[segment + 1];
+            _start[track]  = times[segment];
+            _length[track] = times[segment + 1] - times[segment];
+        }
+
+        std::size_t previous_of(std::size_t track, std::size_t index) const noexcept
+        {
+            return (index > _first[track]) ? index - 1 : index;
+        }
+
+        std::size_t next_of(std::size_t track, std::size_t index) const noexcept
+        {
+            return (index + 1 < std::size_t { _first[track] } + _count[track]) ? index + 1 : index;
+        }
+
+        Value key(std::size_t index) const noexcept
+        {
+            Value value;
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                value[c] = _values[c][index];
+            }
+
+            return value;
+        }
+
+        Value tangent(std::size_t index) const noexcept
+        {
+            Value value;
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                value[c] = _tangents[c][index];
+            }
+
+            return value;
+        }
+
+        template <typename Time>
+        void evaluate_tracks(Time&& time, gsl::span<Value> result) noexcept
+        {
+            using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+            using lane  = math::detail::simd<float, 1>;
+
+            std::size_t count = size();
+            std::size_t i     = 0;
+
+            for (; i + lanes::size() <= count; i += lanes::size())
+            {
+                evaluate_lanes(i, time(i, lanes { }), result.data() + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                evaluate_lanes(i, time(i, lane { }), result.data() + i);
+            }
+        }
+
+        template <typename V>
+        void evaluate_lanes(std::size_t first, const V& time, Value* destination) noexcept
+        {
+            constexpr auto width = V::size();
+
+            auto miss = (time < V::load(_lower.data() + first)) | (time >= V::load(_upper.data() + first));
+
+            if (any_of(miss))
+            {
+                for (std::size_t lane = 0; lane < width; ++lane)
+                {
+                    if (miss[lane])
+                    {
+                        seek(first + lane, time[lane]);
+                    }
+                }
+            }
+
+            auto length = V::load(_length.data() + first);
+            auto amount = select(length > V { 0.0f }, (time - V::load(_start.data() + first)) / length, V { 0.0f });
+
+            amount = min(max(amount, V { 0.0f }), V { 1.0f });
+
+            std::uint32_t index[width];
+            std::uint32_t next[width];
+
+            for (std::size_t lane = 0; lane < width; ++lane)
+            {
+                auto track = first + lane;
+
+                index[lane] = _first[track] + _cursor[track];
+                next[lane]  = index[lane] + ((_count[track] > 1) ? 1 : 0);
+            }
+
+            V a[components];
+            V b[components];
+            V r[components];
+
+            gather(_values, index, a);
+            gather(_values, next, b);
+
+            switch (_interpolation)
+            {
+            case curve_interpolation::step:
+                for (std::size_t c = 0; c < components; ++c)
+                {
+                    r[c] = select(amount < V { 1.0f }, a[c], b[c]);
+                }
+                break;
+
+            case curve_interpolation::linear:
+                if constexpr (detail::animation_value<Value>::rotation)
+                {
+                    math::detail::slerp(a, b, amount, r);
+                }
+                else
+                {
+                    for (std::size_t c = 0; c < components; ++c)
+                    {
+                        r[c] = a[c] + (b[c] - a[c]) * amount;
+                    }
+                }
+                break;
+
+            case curve_interpolation::hermite:
+                {
+                    V ta[components];
+                    V tb[components];
+
+                    gather(_tangents, index, ta);
+                    gather(_tangents, next, tb);
+
+                    auto s2 = amount * amount;
+                    auto s3 = s2 * amount;
+                    auto h1 = V {  2.0f } * s3 - V { 3.0f } * s2 + V { 1.0f };
+                    auto h2 = V { -2.0f } * s3 + V { 3.0f } * s2;
+                    auto h3 = (s3 - V { 2.0f } * s2 + amount) * length;
+                    auto h4 = (s3 - s2) * length;
+
+                    for (std::size_t c = 0; c < components; ++c)
+                    {
+                        r[c] = h1 * a[c] + h2 * b[c] + h3 * ta[c] + h4 * tb[c];
+                    }
+                }
+                break;
+
+            case curve_interpolation::catmull_rom:
+                {
+                    std::uint32_t before[width];
+                    std::uint32_t after[width];
+
+                    for (std::size_t lane = 0; lane < width; ++lane)
+                    {
+                        before[lane] = static_cast<std::uint32_t>(previous_of(first + lane, index[lane]));
+                        after[lane]  = static_cast<std::uint32_t>(next_of(first + lane, next[lane]));
+                    }
+
+                    V p[components];
+                    V n[components];
+
+                    gather(_values, before, p);
+                    gather(_values, after, n);
+
+                    auto s2 = amount * amount;
+                    auto s3 = s2 * amount;
+                    auto w1 = -s3 + V { 2.0f } * s2 - amount;
+                    auto w2 = V {  3.0f } * s3 - V { 5.0f } * s2 + V { 2.0f };
+                    auto w3 = V { -3.0f } * s3 + V { 4.0f } * s2 + amount;
+                    auto w4 = s3 - s2;
+
+                    for (std::size_t c = 0; c < components; ++c)
+                    {
+                        r[c] = (w1 * p[c] + w2 * a[c] + w3 * b[c] + w4 * n[c]) * V { 0.5f };
+                    }
+                }
+                break;
+            }
+
+            float values[components][width];
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                r[c].store(values[c]);
+            }
+
+            for (std::size_t lane = 0; lane < width; ++lane)
+            {
+                for (std::size_t c = 0; c < components; ++c)
+                {
+                    destination[lane][c] = values[c][lane];
+                }
+            }
+        }
+
+        template <typename V>
+        static void gather(const std::array<float_array, components>& source
+                         , const std::uint32_t                         (&index)[V::size()]
+                         , V                                           (&result)[components]) noexcept
+        {
+            float values[V::size()];
+
+            for (std::size_t c = 0; c < components; ++c)
+            {
+                for (std::size_t lane = 0; lane < V::size(); ++lane)
+                {
+                    values[lane] = source[c][index[lane]];
+                }
+
+                result[c] = V::load(values);
+            }
+        }
+
+    private:
+        curve_interpolation                 _interpolation;
+        float_array                         _times;
+        std::array<float_array, components> _values;
+        std::array<float_array, components> _tangents;
+        index_array                         _first;
+        index_array                         _count;
+        index_array                         _cursor;
+        float_array                         _lower;
+        float_array                         _upper;
+        float_array                         _start;
+        float_array                         _length;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using vector2_animation_tracks    = basic_animation_tracks<basic_vector2<float>>;
+    using vector3_animation_tracks    = basic_animation_tracks<basic_vector3<float>>;
+    using vector4_animation_tracks    = basic_animation_tracks<basic_vector4<float>>;
+    using quaternion_animation_tracks = basic_animation_tracks<basic_quaternion<float>>;
+}
+
+#endif // SCENER_MATH_BASIC_ANIMATION_TRACKS_HPP
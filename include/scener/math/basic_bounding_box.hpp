@@ -14,7 +14,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Defines an axis-aligned box-shaped 3D volume.
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_bounding_box
     {
     public:
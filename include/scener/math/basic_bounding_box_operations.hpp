@@ -1,12 +1,14 @@
 // Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
-#ifndef SCENER_MATH_BASIC_BOUNDING_BOX_HPP
-#define SCENER_MATH_BASIC_BOUNDING_BOX_HPP
+#ifndef SCENER_MATH_BASIC_BOUNDING_BOX_OPERATIONS_HPP
+#define SCENER_MATH_BASIC_BOUNDING_BOX_OPERATIONS_HPP
 
 #include "scener/math/basic_bounding_box.hpp"
 
+#include "scener/math/basic_bounding_sphere.hpp"
 #include "scener/math/basic_ray.hpp"
+#include "scener/math/basic_vector_operations.hpp"
 
 namespace scener::math
 {
@@ -37,21 +39,38 @@ namespace scener::math
     //{
     //}
 
-    //bool intersects(const basic_bounding_box& box) const noexcept
-    //{
-    //}
+    /// Checks whether two basic_bounding_box instances intersect.
+    /// \param lhs the first box.
+    /// \param rhs the second box.
+    /// \returns true if the boxes overlap or touch; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_bounding_box<T>& lhs, const basic_bounding_box<T>& rhs) noexcept
+    {
+        return (lhs.min.x <= rhs.max.x && lhs.max.x >= rhs.min.x)
+            && (lhs.min.y <= rhs.max.y && lhs.max.y >= rhs.min.y)
+            && (lhs.min.z <= rhs.max.z && lhs.max.z >= rhs.min.z);
+    }
 
     //bool intersects(const BoundingFrustrum& frustrum) const noexcept
     //{
     //}
 
-    //bool intersects(const BoundingSphere& sphere) const noexcept
-    //{
-    //}
+    /// Checks whether a basic_bounding_box intersects a basic_bounding_sphere.
+    /// \param box the box.
+    /// \param sphere the sphere.
+    /// \returns true if the box and the sphere overlap or touch; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_bounding_box<T>& box, const basic_bounding_sphere<T>& sphere) noexcept
+    {
+        // The closest point of the box to the sphere center must lie within the sphere
+        auto closest = vector::clamp(sphere.center, box.min, box.max);
+
+        return (vector::distance_squared(closest, sphere.center) <= T(sphere.radius * sphere.radius));
+    }
 
     //plane_intersection_type intersects(const plane_t& plane) const noexcept
     //{
     //}
 }
 
-#endif  // SCENER_MATH_BASIC_BOUNDING_BOX_HPP
+#endif  // SCENER_MATH_BASIC_BOUNDING_BOX_OPERATIONS_HPP
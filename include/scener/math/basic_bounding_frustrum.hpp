@@ -4,9 +4,13 @@
 #ifndef SCENER_MATH_BASIC_BOUNDING_FRUSTRUM_HPP
 #define SCENER_MATH_BASIC_BOUNDING_FRUSTRUM_HPP
 
+#include <array>
 #include <cstdint>
 
+#include "scener/math/basic_matrix_operations.hpp"
 #include "scener/math/basic_plane_operations.hpp"
+#include "scener/math/basic_vector_operations.hpp"
+#include "scener/math/basic_vector_transforms.hpp"
 
 namespace scener::math 
 {
@@ -14,25 +18,39 @@ namespace scener::math
     // TEMPLATES
 
     /// Defines a frustum and helps determine whether forms intersect with it.
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     class basic_bounding_frustrum final
     {
     public:
         /// Specifies the total number of corners (8) in the BoundingFrustrum.
         constexpr static const std::uint32_t corner_count = 8;
 
+        /// Specifies the total number of edges (12) in the BoundingFrustrum.
+        constexpr static const std::uint32_t edge_count = 12;
+
+        /// Specifies the total number of planes (6) in the BoundingFrustrum.
+        constexpr static const std::uint32_t plane_count = 6;
+
+        /// Index of each plane in the array returned by planes().
+        constexpr static const std::uint32_t near_plane   = 0;
+        constexpr static const std::uint32_t far_plane    = 1;
+        constexpr static const std::uint32_t left_plane   = 2;
+        constexpr static const std::uint32_t right_plane  = 3;
+        constexpr static const std::uint32_t top_plane    = 4;
+        constexpr static const std::uint32_t bottom_plane = 5;
+
     public:
         /// Initializes a new instance of the BoundingFrustrum class.
         /// \param value Combined matrix that usually takes view × projection matrix.
         basic_bounding_frustrum(const basic_matrix4<T>& value) noexcept
-            : _bottom { T(0), T(0), T(0), T(0) }
-            , _far    { T(0), T(0), T(0), T(0) }
-            , _left   { T(0), T(0), T(0), T(0) }
-            , _near   { T(0), T(0), T(0), T(0) }
-            , _right  { T(0), T(0), T(0), T(0) }
-            , _top    { T(0), T(0), T(0), T(0) }
-            , _value  { value }
+            : _planes       { }
+            , _value        { value }
+            , _corners      { }
+            , _edges        { }
+            , _unique_edges { 0 }
         {
+            update_planes();
+            update_corners();
         }
 
     public:
@@ -40,26 +58,49 @@ namespace scener::math
         /// \returns the bottom plane of the BoundingFrustum.
         const basic_plane<T>& bottom() const noexcept
         {
-            return _bottom;
+            return _planes[bottom_plane];
+        }
+
+        /// Gets the eight corners of the BoundingFrustum, computed whenever the matrix is set.
+        /// \returns the corners of the near plane followed by the corners of the far plane, each of them in top-left,
+        ///          top-right, bottom-right, bottom-left order.
+        const std::array<basic_vector3<T>, corner_count>& corners() const noexcept
+        {
+            return _corners;
+        }
+
+        /// Gets the number of distinct edge directions of the BoundingFrustum, six for the usual perspective and
+        /// orthographic projections, where opposite edges of the near and far planes are parallel.
+        /// \returns the number of valid entries in the array returned by edges().
+        std::uint32_t edge_direction_count() const noexcept
+        {
+            return _unique_edges;
+        }
+
+        /// Gets the distinct edge directions of the BoundingFrustum, computed whenever the matrix is set.
+        /// \returns the unit length edge directions, only the first edge_direction_count() entries are valid.
+        const std::array<basic_vector3<T>, edge_count>& edges() const noexcept
+        {
+            return _edges;
         }
 
         /// Gets the far plane of the BoundingFrustum.
         /// \returns the far plane of the BoundingFrustum.
         const basic_plane<T>& far() const noexcept
         {
-            return _far;
+            return _planes[far_plane];
         }
 
         /// Gets the left plane of the BoundingFrustum.
         /// \returns the left plane of the BoundingFrustum.
         const basic_plane<T>& left() const noexcept
         {
-            return _left;
+            return _planes[left_plane];
         }
 
         /// Gets the matrix4 that describes this bounding frustum.
         /// \returns the matrix4 that describes this bounding frustum.
-        const matrix4& matrix() const noexcept
+        const basic_matrix4<T>& matrix() const noexcept
         {
             return _value;
         }
@@ -70,27 +111,36 @@ namespace scener::math
         {
             _value = matrix;
             update_planes();
+            update_corners();
         }
 
         /// Gets the near plane of the BoundingFrustum.
         /// \returns the near plane of the BoundingFrustum.
         const basic_plane<T>& near() const noexcept
         {
-            return _near;
+            return _planes[near_plane];
+        }
+
+        /// Gets the six planes of the BoundingFrustum, their normals point towards the inside of the frustum.
+        /// \returns the planes of the BoundingFrustum indexed by near_plane, far_plane, left_plane, right_plane,
+        ///          top_plane and bottom_plane.
+        const std::array<basic_plane<T>, plane_count>& planes() const noexcept
+        {
+            return _planes;
         }
 
         /// Gets the right plane of the BoundingFrustum.
         /// \returns the right plane of the BoundingFrustum.
         const basic_plane<T>& right() const noexcept
         {
-            return _right;
+            return _planes[right_plane];
         }
 
         /// Gets the top plane of the BoundingFrustum.
         /// \returns the top plane of the BoundingFrustum.
         const basic_plane<T>& top() const noexcept
         {
-            return _top;
+            return _planes[top_plane];
         }
 
     public:
@@ -110,48 +160,85 @@ namespace scener::math
             // http://www.chadvernon.com/blog/resources/directx9/frustum-culling/
 
             // Left basic_plane<T>
-            _left = plane::normalize({ _value.m14 + _value.m11
-                                     , _value.m24 + _value.m21
-                                     , _value.m34 + _value.m31
-                                     , _value.m44 + _value.m41 });
+            _planes[left_plane] = plane::normalize({ _value.m14 + _value.m11
+                                                   , _value.m24 + _value.m21
+                                                   , _value.m34 + _value.m31
+                                                   , _value.m44 + _value.m41 });
 
             // Right basic_plane<T>
-            _right = plane::normalize({ _value.m14 - _value.m11
-                                      , _value.m24 - _value.m21
-                                      , _value.m34 - _value.m31
-                                      , _value.m44 - _value.m41 });
+            _planes[right_plane] = plane::normalize({ _value.m14 - _value.m11
+                                                    , _value.m24 - _value.m21
+                                                    , _value.m34 - _value.m31
+                                                    , _value.m44 - _value.m41 });
 
             // Top basic_plane<T>
-            _top = plane::normalize({ _value.m14 - _value.m12
-                                    , _value.m24 - _value.m22
-                                    , _value.m34 - _value.m32
-                                    , _value.m44 - _value.m42 });
+            _planes[top_plane] = plane::normalize({ _value.m14 - _value.m12
+                                                  , _value.m24 - _value.m22
+                                                  , _value.m34 - _value.m32
+                                                  , _value.m44 - _value.m42 });
 
             // Bottom basic_plane<T>
-            _bottom = plane::normalize({ _value.m14 + _value.m12
-                                       , _value.m24 + _value.m22
-                                       , _value.m34 + _value.m32
-                                       , _value.m44 + _value.m42 });
+            _planes[bottom_plane] = plane::normalize({ _value.m14 + _value.m12
+                                                     , _value.m24 + _value.m22
+                                                     , _value.m34 + _value.m32
+                                                     , _value.m44 + _value.m42 });
 
             // Near basic_plane<T>
-            _near = plane::normalize({ _value.m13, _value.m23, _value.m33, _value.m43 });
+            _planes[near_plane] = plane::normalize({ _value.m13, _value.m23, _value.m33, _value.m43 });
 
 
             // Far basic_plane<T>
-            _far = plane::normalize({ _value.m14 - _value.m13
-                                    , _value.m24 - _value.m23
-                                    , _value.m34 - _value.m33
-                                    , _value.m44 - _value.m43 });
+            _planes[far_plane] = plane::normalize({ _value.m14 - _value.m13
+                                                  , _value.m24 - _value.m23
+                                                  , _value.m34 - _value.m33
+                                                  , _value.m44 - _value.m43 });
+        }
+
+        void update_corners() noexcept
+        {
+            // The corners of the clip space volume (x and y in [-1, 1], z in [0, 1]) back into the space of the matrix
+            constexpr std::array<basic_vector3<T>, corner_count> clip_corners =
+            {
+                basic_vector3<T> { T(-1), T( 1), T(0) }, basic_vector3<T> { T( 1), T( 1), T(0) }
+              , basic_vector3<T> { T( 1), T(-1), T(0) }, basic_vector3<T> { T(-1), T(-1), T(0) }
+              , basic_vector3<T> { T(-1), T( 1), T(1) }, basic_vector3<T> { T( 1), T( 1), T(1) }
+              , basic_vector3<T> { T( 1), T(-1), T(1) }, basic_vector3<T> { T(-1), T(-1), T(1) }
+            };
+
+            _corners      = vector::transform(clip_corners, matrix::invert(_value));
+            _unique_edges = 0;
+
+            // Edges joining the near and far planes, followed by the edges of the near and far planes
+            constexpr std::uint32_t edge_corners[edge_count][2] =
+            {
+                { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+              , { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }
+              , { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 }
+            };
+
+            for (const auto& corner : edge_corners)
+            {
+                auto edge = vector::normalize(_corners[corner[1]] - _corners[corner[0]]);
+                auto seen = false;
+
+                for (std::uint32_t j = 0; j < _unique_edges && !seen; ++j)
+                {
+                    seen = (vector::length_squared(vector::cross(edge, _edges[j])) < T(1e-6));
+                }
+
+                if (!seen)
+                {
+                    _edges[_unique_edges++] = edge;
+                }
+            }
         }
 
     private:
-        basic_plane<T>   _bottom;
-        basic_plane<T>   _far;
-        basic_plane<T>   _left;
-        basic_plane<T>   _near;
-        basic_plane<T>   _right;
-        basic_plane<T>   _top;
-        basic_matrix4<T> _value;
+        std::array<basic_plane<T>, plane_count>    _planes;
+        basic_matrix4<T>                           _value;
+        std::array<basic_vector3<T>, corner_count> _corners;
+        std::array<basic_vector3<T>, edge_count>   _edges;
+        std::uint32_t                              _unique_edges;
     };
 
     // -----------------------------------------------------------------------------------------------------------------
@@ -4,60 +4,350 @@
 #ifndef SCENER_MATH_BASIC_BOUNDING_FRUSTRUM_OPERATIONS_HPP
 #define SCENER_MATH_BASIC_BOUNDING_FRUSTRUM_OPERATIONS_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "scener/math/bounding_box.hpp"
 #include "scener/math/bounding_frustrum.hpp"
+#include "scener/math/bounding_sphere.hpp"
+#include "scener/math/containment_type.hpp"
 
 namespace scener::math 
 {
-    //containment_type BoundingFrustrum::contains(const BoundingBox& box) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //containment_type BoundingFrustrum::contains(const BoundingFrustrum& frustrum) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //containment_type BoundingFrustrum::contains(const BoundingSphere& sphere) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //containment_type BoundingFrustrum::contains(const vector3& point) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //std::vector<vector3> BoundingFrustrum::get_corners() noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //bool BoundingFrustrum::intersects(const BoundingBox& box) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //bool BoundingFrustrum::intersects(const BoundingFrustrum& frustrum) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //bool BoundingFrustrum::intersects(const BoundingSphere& sphere) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //plane_intersection_type BoundingFrustrum::intersects(const plane_t& plane) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //float BoundingFrustrum::intersects(const basic_ray& ray) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
+    /// Mask selecting all the planes of a bounding frustum, bit i selects the plane at index i of planes().
+    constexpr std::uint32_t frustrum_all_planes = 0x3F;
+
+    /// Gets the eight corners of the bounding frustum.
+    /// \param frustrum the bounding frustum.
+    /// \returns the corners of the near plane followed by the corners of the far plane, each of them in top-left,
+    ///          top-right, bottom-right, bottom-left order.
+    template <typename T>
+    std::array<basic_vector3<T>, basic_bounding_frustrum<T>::corner_count>
+    get_corners(const basic_bounding_frustrum<T>& frustrum) noexcept
+    {
+        return frustrum.corners();
+    }
+
+    /// Checks whether the bounding frustum contains the given bounding box, testing only the planes selected by the
+    /// given mask.
+    ///
+    /// Planes the box is known to be inside of can be dropped from the mask, which allows hierarchical culling to skip
+    /// the planes that already contain a parent volume. Like any plane based culling test this is conservative, boxes
+    /// lying outside the frustum near one of its edges may be reported as intersecting it.
+    /// \param frustrum the bounding frustum.
+    /// \param box the bounding box to check against the frustum.
+    /// \param plane_mask on input the planes to test; on output the subset of them the box straddles.
+    /// \returns the extent of overlap between the frustum and the box.
+    template <typename T>
+    containment_type contains(const basic_bounding_frustrum<T>& frustrum
+                            , const basic_bounding_box<T>&      box
+                            , std::uint32_t&                    plane_mask) noexcept
+    {
+        const auto&   planes   = frustrum.planes();
+        std::uint32_t straddle = 0;
+
+        for (std::uint32_t i = 0; i < basic_bounding_frustrum<T>::plane_count; ++i)
+        {
+            if ((plane_mask & (1u << i)) == 0)
+            {
+                continue;
+            }
+
+            switch (plane::intersects(planes[i], box))
+            {
+            case plane_intersection_type::back:
+                plane_mask = 0;
+                return containment_type::disjoint;
+
+            case plane_intersection_type::intersecting:
+                straddle |= (1u << i);
+                break;
+
+            case plane_intersection_type::front:
+                break;
+            }
+        }
+
+        plane_mask = straddle;
+
+        return (straddle == 0) ? containment_type::contains : containment_type::intersects;
+    }
+
+    /// Checks whether the bounding frustum contains the given bounding box.
+    /// \param frustrum the bounding frustum.
+    /// \param box the bounding box to check against the frustum.
+    /// \returns the extent of overlap between the frustum and the box.
+    template <typename T>
+    containment_type contains(const basic_bounding_frustrum<T>& frustrum, const basic_bounding_box<T>& box) noexcept
+    {
+        std::uint32_t plane_mask = frustrum_all_planes;
+
+        auto result = contains(frustrum, box, plane_mask);
+
+        if (result == containment_type::intersects && !intersects(frustrum, box))
+        {
+            return containment_type::disjoint;
+        }
+
+        return result;
+    }
+
+    /// Checks whether the bounding frustum contains the given bounding sphere.
+    /// \param frustrum the bounding frustum.
+    /// \param sphere the bounding sphere to check against the frustum.
+    /// \returns the extent of overlap between the frustum and the sphere.
+    template <typename T>
+    containment_type contains(const basic_bounding_frustrum<T>& frustrum, const basic_bounding_sphere<T>& sphere) noexcept
+    {
+        auto result = containment_type::contains;
+
+        for (const auto& p : frustrum.planes())
+        {
+            auto intersection = plane::intersects(p, sphere);
+
+            if (intersection == plane_intersection_type::back)
+            {
+                return containment_type::disjoint;
+            }
+            if (intersection == plane_intersection_type::intersecting)
+            {
+                result = containment_type::intersects;
+            }
+        }
+
+        return result;
+    }
+
+    /// Checks whether the bounding frustum contains the given point.
+    /// \param frustrum the bounding frustum.
+    /// \param position the point to check against the frustum.
+    /// \returns contains when the point lies inside the frustum or on its boundary; otherwise disjoint.
+    template <typename T>
+    containment_type contains(const basic_bounding_frustrum<T>& frustrum, const basic_vector3<T>& position) noexcept
+    {
+        for (const auto& p : frustrum.planes())
+        {
+            if (plane::dot_coordinate(p, position) < T(0))
+            {
+                return containment_type::disjoint;
+            }
+        }
+
+        return containment_type::contains;
+    }
+
+    /// Checks whether the bounding frustum intersects the given bounding box.
+    ///
+    /// The test is exact: on top of the frustum planes it checks the box axes and the cross products of the box axes
+    /// with the frustum edges, as given by the separating axis theorem.
+    /// \param frustrum the bounding frustum.
+    /// \param box the bounding box to check for intersection with.
+    /// \returns true if the frustum and the box intersect; false otherwise.
+    template <typename T>
+    bool intersects(const basic_bounding_frustrum<T>& frustrum, const basic_bounding_box<T>& box) noexcept
+    {
+        for (const auto& p : frustrum.planes())
+        {
+            if (plane::intersects(p, box) == plane_intersection_type::back)
+            {
+                return false;
+            }
+        }
+
+        const auto& corners = frustrum.corners();
+        const auto& edges   = frustrum.edges();
+
+        auto project = [&] (const basic_vector3<T>& axis, T& min, T& max) -> void
+        {
+            min = max = vector::dot(corners[0], axis);
+
+            for (std::uint32_t i = 1; i < basic_bounding_frustrum<T>::corner_count; ++i)
+            {
+                auto distance = vector::dot(corners[i], axis);
+
+                min = std::min(min, distance);
+                max = std::max(max, distance);
+            }
+        };
+
+        const basic_vector3<T> box_axes[3] = { basic_vector3<T>::unit_x()
+                                             , basic_vector3<T>::unit_y()
+                                             , basic_vector3<T>::unit_z() };
+
+        T min = T(0);
+        T max = T(0);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            project(box_axes[i], min, max);
+
+            if (max < box.min[i] || min > box.max[i])
+            {
+                return false;
+            }
+        }
+
+        auto center = (box.min + box.max) * T(0.5);
+        auto extent = (box.max - box.min) * T(0.5);
+
+        for (std::uint32_t i = 0; i < frustrum.edge_direction_count(); ++i)
+        {
+            for (const auto& box_axis : box_axes)
+            {
+                auto axis = vector::cross(edges[i], box_axis);
+
+                if (vector::length_squared(axis) < T(1e-6))
+                {
+                    continue;
+                }
+
+                auto distance = vector::dot(center, axis);
+                auto radius   = vector::dot(extent, vector::abs(axis));
+
+                project(axis, min, max);
+
+                if (max < distance - radius || min > distance + radius)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// Checks whether the bounding frustum intersects the given bounding sphere.
+    /// \param frustrum the bounding frustum.
+    /// \param sphere the bounding sphere to check for intersection with.
+    /// \returns true if the frustum and the sphere intersect; false otherwise.
+    template <typename T>
+    bool intersects(const basic_bounding_frustrum<T>& frustrum, const basic_bounding_sphere<T>& sphere) noexcept
+    {
+        return (contains(frustrum, sphere) != containment_type::disjoint);
+    }
+
+    /// Checks whether the bounding frustum intersects another bounding frustum.
+    ///
+    /// The test is exact, it looks for a separating axis among the planes of both frustums and the cross products of
+    /// their edges. The corners and edges of both frustums are computed when their matrices are set, so queries only
+    /// project them.
+    /// \param lhs the first bounding frustum.
+    /// \param rhs the second bounding frustum.
+    /// \returns true if the frustums intersect; false otherwise.
+    template <typename T>
+    bool intersects(const basic_bounding_frustrum<T>& lhs, const basic_bounding_frustrum<T>& rhs) noexcept
+    {
+        const auto& lhs_corners = lhs.corners();
+        const auto& rhs_corners = rhs.corners();
+
+        auto outside = [] (const basic_bounding_frustrum<T>& frustrum, const auto& corners) -> bool
+        {
+            for (const auto& p : frustrum.planes())
+            {
+                auto behind = true;
+
+                for (const auto& corner : corners)
+                {
+                    behind = behind && (plane::dot_coordinate(p, corner) < T(0));
+                }
+
+                if (behind)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        if (outside(lhs, rhs_corners) || outside(rhs, lhs_corners))
+        {
+            return false;
+        }
+
+        auto project = [] (const auto& corners, const basic_vector3<T>& axis, T& min, T& max) -> void
+        {
+            min = max = vector::dot(corners[0], axis);
+
+            for (std::uint32_t i = 1; i < basic_bounding_frustrum<T>::corner_count; ++i)
+            {
+                auto distance = vector::dot(corners[i], axis);
+
+                min = std::min(min, distance);
+                max = std::max(max, distance);
+            }
+        };
+
+        for (std::uint32_t i = 0; i < lhs.edge_direction_count(); ++i)
+        {
+            for (std::uint32_t j = 0; j < rhs.edge_direction_count(); ++j)
+            {
+                auto axis = vector::cross(lhs.edges()[i], rhs.edges()[j]);
+
+                if (vector::length_squared(axis) < T(1e-6))
+                {
+                    continue;
+                }
+
+                T lhs_min, lhs_max, rhs_min, rhs_max;
+
+                project(lhs_corners, axis, lhs_min, lhs_max);
+                project(rhs_corners, axis, rhs_min, rhs_max);
+
+                if (lhs_max < rhs_min || rhs_max < lhs_min)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// Checks whether the bounding frustum contains another bounding frustum.
+    /// \param frustrum the bounding frustum.
+    /// \param other the bounding frustum to check against the first one.
+    /// \returns the extent of overlap between the frustums.
+    template <typename T>
+    containment_type contains(const basic_bounding_frustrum<T>& frustrum, const basic_bounding_frustrum<T>& other) noexcept
+    {
+        auto inside = true;
+
+        for (const auto& corner : other.corners())
+        {
+            inside = inside && (contains(frustrum, corner) == containment_type::contains);
+        }
+
+        if (inside)
+        {
+            return containment_type::contains;
+        }
+
+        return intersects(frustrum, other) ? containment_type::intersects : containment_type::disjoint;
+    }
+
+    /// Checks whether the bounding frustum intersects the given plane.
+    /// \param frustrum the bounding frustum.
+    /// \param p the plane to check for intersection with.
+    /// \returns the half-space of the plane the frustum lies in, or intersecting when the plane crosses the frustum.
+    template <typename T>
+    plane_intersection_type intersects(const basic_bounding_frustrum<T>& frustrum, const basic_plane<T>& p) noexcept
+    {
+        std::uint32_t in_front = 0;
+
+        for (const auto& corner : frustrum.corners())
+        {
+            in_front += (plane::dot_coordinate(p, corner) >= T(0)) ? 1 : 0;
+        }
+
+        if (in_front == basic_bounding_frustrum<T>::corner_count)
+        {
+            return plane_intersection_type::front;
+        }
+
+        return (in_front == 0) ? plane_intersection_type::back : plane_intersection_type::intersecting;
+    }
 }
 
 #endif  // SCENER_MATH_BASIC_BOUNDING_FRUSTRUM_OPERATIONS_HPP
-
@@ -12,7 +12,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Defines a sphere.
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_bounding_sphere
     {
     public:
@@ -42,7 +42,7 @@ namespace scener::math
     template <typename T>
     constexpr bool operator==(const basic_bounding_sphere<T>& lhs, const basic_bounding_sphere<T>& rhs) noexcept
     {
-        return (lhs.center == rhs.center && math::equal(lhs.radius, rhs._radius));
+        return (lhs.center == rhs.center && math::equal(lhs.radius, rhs.radius));
     }
 
     /// Inequality operator for comparing basic_bounding_sphere instances.
@@ -5,6 +5,7 @@
 #define SCENER_MATH_BASIC_BOUNDING_SPHERE_OPERATIONS_HPP
 
 #include "scener/math/bounding_sphere.hpp"
+#include "scener/math/bounding_box.hpp"
 
 namespace scener::math 
 {
@@ -48,20 +49,32 @@ namespace scener::math
     //    throw std::runtime_error("Not implemented");
     //}
 
-    //bool BoundingSphere::intersects(const BoundingBox& boundingBox) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
+    /// Checks whether a basic_bounding_sphere intersects a basic_bounding_box.
+    /// \param sphere the sphere.
+    /// \param box the box.
+    /// \returns true if the sphere and the box overlap or touch; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_bounding_sphere<T>& sphere, const basic_bounding_box<T>& box) noexcept
+    {
+        return intersects(box, sphere);
+    }
 
     //bool BoundingSphere::intersects(const BoundingFrustum& frustrum) const noexcept
     //{
     //    throw std::runtime_error("Not implemented");
     //}
 
-    //bool BoundingSphere::intersects(const BoundingSphere& sphere) const noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
+    /// Checks whether two basic_bounding_sphere instances intersect.
+    /// \param lhs the first sphere.
+    /// \param rhs the second sphere.
+    /// \returns true if the spheres overlap or touch; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_bounding_sphere<T>& lhs, const basic_bounding_sphere<T>& rhs) noexcept
+    {
+        auto radius = T(lhs.radius + rhs.radius);
+
+        return (vector::distance_squared(lhs.center, rhs.center) <= radius * radius);
+    }
 
     //plane_intersection_type BoundingSphere::intersects(const plane_t& plane) const noexcept
     //{
@@ -12,7 +12,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Describes a color in terms of red, green, blue and alpha components.
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_color
     {
     public:
@@ -4,22 +4,164 @@
 #ifndef SCENER_MATH_BASIC_COLOR_OPERATIONS_HPP
 #define SCENER_MATH_BASIC_COLOR_OPERATIONS_HPP
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <gsl/assert>
+#include <gsl/span>
+
 #include "scener/math/basic_color.hpp"
+#include "scener/math/basic_math.hpp"
+#include "scener/math/fast_math.hpp"
+#include "scener/math/simd.hpp"
 
 namespace scener::math
 {
+    namespace detail
+    {
+        /// Converts a color channel to an 8 bits unsigned normalized value, rounding to nearest even as the packed
+        /// color functions do.
+        template <typename T>
+        constexpr std::uint32_t channel8(T value) noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                auto scaled = ((value > T(0)) ? ((value < T(1)) ? value : T(1)) : T(0)) * T(255);
+
+                if (detail::is_constant_evaluated())
+                {
+                    // The fractional part of a value below 256 is exact
+                    auto whole    = static_cast<std::uint32_t>(scaled);
+                    auto fraction = scaled - static_cast<T>(whole);
+
+                    return whole + ((fraction > T(0.5) || (fraction == T(0.5) && (whole & 1))) ? 1 : 0);
+                }
+
+                return static_cast<std::uint32_t>(std::nearbyint(scaled));
+            }
+            else
+            {
+                return static_cast<std::uint32_t>(value) & 0xFF;
+            }
+        }
+
+        /// Applies the sRGB transfer function, or its inverse, to every lane.
+        ///
+        /// The power is evaluated as exp(y * log(x)) with the high precision approximations of fast_math.
+        template <bool Decode, typename V>
+        inline V srgb_transfer(const V& value) noexcept
+        {
+            constexpr auto P = fast::precision::high;
+
+            if constexpr (Decode)
+            {
+                auto base  = (max(value, V { 0.04045f }) + V { 0.055f }) / V { 1.055f };
+                auto curve = fast::detail::exp<P>(V { 2.4f } * fast::detail::log<P>(base));
+
+                return select(value <= V { 0.04045f }, value / V { 12.92f }, curve);
+            }
+            else
+            {
+                auto base  = max(value, V { 0.0031308f });
+                auto curve = fast::detail::exp<P>(V { 1.0f / 2.4f } * fast::detail::log<P>(base));
+
+                return select(value <= V { 0.0031308f }, value * V { 12.92f }, V { 1.055f } * curve - V { 0.055f });
+            }
+        }
+    }
+
     // -----------------------------------------------------------------------------------------------------------------
     // OPERATIONS
 
+    /// Gets the color packed as a 32 bits value, 8 bits per channel with red in the most significant bits.
+    /// Floating point channels are clamped to [0, 1] and rounded to nearest even, as packed::pack_rgba8 does.
+    /// \param value the color to pack.
+    /// \returns the packed color.
     template <typename T>
     constexpr std::uint32_t packed_value(const basic_color<T>& value) noexcept
     {
-        return ((static_cast<std::uint32_t>(value.r) * 255) << 24)
-             + ((static_cast<std::uint32_t>(value.g) * 255) << 16)
-             + ((static_cast<std::uint32_t>(value.b) * 255) << 8)
-             +  (static_cast<std::uint32_t>(value.a) * 255);
+        return (detail::channel8(value.r) << 24)
+             | (detail::channel8(value.g) << 16)
+             | (detail::channel8(value.b) << 8)
+             |  detail::channel8(value.a);
+    }
+
+    /// Converts a sRGB encoded channel value to linear.
+    /// The relative error is below 1e-5 compared to the exact transfer function.
+    /// \param value the sRGB encoded value.
+    /// \returns the linear value.
+    inline float srgb_to_linear(float value) noexcept
+    {
+        return detail::srgb_transfer<true>(detail::simd<float, 1> { value })[0];
+    }
+
+    /// Converts a linear channel value to sRGB.
+    /// The relative error is below 1e-5 compared to the exact transfer function.
+    /// \param value the linear value.
+    /// \returns the sRGB encoded value.
+    inline float linear_to_srgb(float value) noexcept
+    {
+        return detail::srgb_transfer<false>(detail::simd<float, 1> { value })[0];
+    }
+
+    /// Converts a sRGB encoded color to linear, alpha is kept as is.
+    /// \param value the sRGB encoded color.
+    /// \returns the linear color.
+    inline basic_color<float> srgb_to_linear(const basic_color<float>& value) noexcept
+    {
+        return { srgb_to_linear(value.r), srgb_to_linear(value.g), srgb_to_linear(value.b), value.a };
+    }
+
+    /// Converts a linear color to sRGB, alpha is kept as is.
+    /// \param value the linear color.
+    /// \returns the sRGB encoded color.
+    inline basic_color<float> linear_to_srgb(const basic_color<float>& value) noexcept
+    {
+        return { linear_to_srgb(value.r), linear_to_srgb(value.g), linear_to_srgb(value.b), value.a };
+    }
+
+    /// Converts sRGB encoded colors to linear, alpha is kept as is.
+    /// \param source the sRGB encoded colors.
+    /// \param destination the linear colors, of the same size as the source; may be the source itself.
+    inline void srgb_to_linear(gsl::span<const basic_color<float>> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        using lanes = detail::simd<float, 4, detail::simd_abi::fixed>;
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            // Alpha is kept as is
+            auto alpha = source[i].a;
+            auto value = lanes::load(source[i].components.data());
+
+            detail::srgb_transfer<true>(value).store(destination[i].components.data());
+
+            destination[i].a = alpha;
+        }
+    }
+
+    /// Converts linear colors to sRGB, alpha is kept as is.
+    /// \param source the linear colors.
+    /// \param destination the sRGB encoded colors, of the same size as the source; may be the source itself.
+    inline void linear_to_srgb(gsl::span<const basic_color<float>> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        using lanes = detail::simd<float, 4, detail::simd_abi::fixed>;
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            // Alpha is kept as is
+            auto alpha = source[i].a;
+            auto value = lanes::load(source[i].components.data());
+
+            detail::srgb_transfer<false>(value).store(destination[i].components.data());
+
+            destination[i].a = alpha;
+        }
     }
 }
 
 #endif  // SCENER_MATH_BASIC_COLOR_OPERATIONS_HPP
-
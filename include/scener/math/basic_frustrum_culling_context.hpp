@@ -0,0 +1,162 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_FRUSTRUM_CULLING_CONTEXT_HPP
+#define SCENER_MATH_BASIC_FRUSTRUM_CULLING_CONTEXT_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "scener/math/bounding_box.hpp"
+#include "scener/math/bounding_frustrum.hpp"
+#include "scener/math/containment_type.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Frustum culling state kept between frames.
+    ///
+    /// Remembers, for every object and hierarchy node, the plane that last rejected its bounds, and tests that plane
+    /// first the next time (plane coherency): as the camera moves smoothly, a volume outside the frustum is usually
+    /// rejected by the same plane again, after a single plane test. Combined with the plane masks passed down a
+    /// hierarchy, where a child skips every plane its parent is known to be inside of, most volumes are classified
+    /// without testing all six planes.
+    ///
+    /// Reference: Assarsson, Möller. "Optimized View Frustum Culling Algorithms for Bounding Boxes"
+    template <typename T, typename = typename std::enable_if_t<std::is_floating_point_v<T>>>
+    class basic_frustrum_culling_context final
+    {
+    public:
+        /// Initializes a new instance of the basic_frustrum_culling_context class.
+        /// \param value the frustum volumes are culled against.
+        basic_frustrum_culling_context(const basic_bounding_frustrum<T>& value) noexcept
+            : _frustrum     { value }
+            , _object_plane { }
+            , _node_plane   { }
+        {
+        }
+
+    public:
+        /// Gets the frustum volumes are culled against.
+        /// \returns the frustum volumes are culled against.
+        const basic_bounding_frustrum<T>& frustrum() const noexcept
+        {
+            return _frustrum;
+        }
+
+        /// Sets the frustum volumes are culled against, keeping the state gathered in previous frames.
+        /// \param value the frustum volumes are culled against.
+        void frustrum(const basic_bounding_frustrum<T>& value) noexcept
+        {
+            _frustrum = value;
+        }
+
+        /// Gets the index of the plane that last rejected the given object.
+        /// \param object the object index.
+        /// \returns the index in basic_bounding_frustrum::planes() of the plane that last rejected the object.
+        std::uint32_t last_plane(std::uint32_t object) const noexcept
+        {
+            return (object < _object_plane.size()) ? _object_plane[object] : 0;
+        }
+
+        /// Forgets the state gathered in previous frames.
+        void clear() noexcept
+        {
+            _object_plane.clear();
+            _node_plane.clear();
+        }
+
+    public:
+        /// Checks whether the frustum contains the bounds of an object.
+        /// \param object the object index, a small integer such as a container handle.
+        /// \param box the object bounds.
+        /// \param plane_mask on input the planes to test; on output the subset of them the box straddles.
+        /// \returns the extent of overlap between the frustum and the box.
+        containment_type contains_object(std::uint32_t object, const basic_bounding_box<T>& box, std::uint32_t& plane_mask)
+        {
+            return classify(slot_of(_object_plane, object), box, plane_mask);
+        }
+
+        /// Checks whether the frustum contains the given object.
+        /// \param object the object index, a small integer such as a container handle.
+        /// \param box the object bounds.
+        /// \returns the extent of overlap between the frustum and the box.
+        containment_type contains_object(std::uint32_t object, const basic_bounding_box<T>& box)
+        {
+            std::uint32_t plane_mask = frustrum_all_planes;
+
+            return contains_object(object, box, plane_mask);
+        }
+
+        /// Checks whether the frustum contains the bounds of a hierarchy node.
+        /// \param node the node index.
+        /// \param box the node bounds.
+        /// \param plane_mask on input the planes the parent node straddles; on output the subset of them the box
+        ///                   straddles, to be passed down to the node children.
+        /// \returns the extent of overlap between the frustum and the box.
+        containment_type contains_node(std::uint32_t node, const basic_bounding_box<T>& box, std::uint32_t& plane_mask)
+        {
+            return classify(slot_of(_node_plane, node), box, plane_mask);
+        }
+
+    private:
+        static std::uint8_t& slot_of(std::vector<std::uint8_t>& planes, std::uint32_t index)
+        {
+            if (index >= planes.size())
+            {
+                planes.resize(index + 1, 0);
+            }
+
+            return planes[index];
+        }
+
+        containment_type classify(std::uint8_t&                last
+                                , const basic_bounding_box<T>& box
+                                , std::uint32_t&               plane_mask) const noexcept
+        {
+            const auto&   planes   = _frustrum.planes();
+            std::uint32_t straddle = 0;
+
+            // The plane that rejected the volume last time is the most likely to reject it again
+            for (std::uint32_t n = 0; n < basic_bounding_frustrum<T>::plane_count; ++n)
+            {
+                auto i = (last + n) % basic_bounding_frustrum<T>::plane_count;
+
+                if ((plane_mask & (1u << i)) != 0)
+                {
+                    auto intersection = plane::intersects(planes[i], box);
+
+                    if (intersection == plane_intersection_type::back)
+                    {
+                        last       = static_cast<std::uint8_t>(i);
+                        plane_mask = 0;
+
+                        return containment_type::disjoint;
+                    }
+                    if (intersection == plane_intersection_type::intersecting)
+                    {
+                        straddle |= (1u << i);
+                    }
+                }
+            }
+
+            plane_mask = straddle;
+
+            return (straddle == 0) ? containment_type::contains : containment_type::intersects;
+        }
+
+    private:
+        basic_bounding_frustrum<T> _frustrum;
+        std::vector<std::uint8_t>  _object_plane;
+        std::vector<std::uint8_t>  _node_plane;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using frustrum_culling_context = basic_frustrum_culling_context<float>;
+}
+
+#endif // SCENER_MATH_BASIC_FRUSTRUM_CULLING_CONTEXT_HPP
@@ -0,0 +1,517 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_LOOSE_OCTREE_HPP
+#define SCENER_MATH_BASIC_LOOSE_OCTREE_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gsl/assert>
+
+#include "scener/math/bounding_box.hpp"
+#include "scener/math/bounding_frustrum.hpp"
+#include "scener/math/bounding_sphere.hpp"
+#include "scener/math/frustrum_culling_context.hpp"
+#include "scener/math/ray.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Loose octree over basic_bounding_box volumes.
+    ///
+    /// Every node bounds its objects with a cube twice the size of its cell, so an object is stored in the node whose
+    /// cell holds its center at the depth matching its size, and never straddles several nodes. Reinserting a moved
+    /// object is a constant time unlink and a walk down the tree, which is skipped entirely while the object center
+    /// stays within the same cell. Nodes live in a flat arena, with the eight children of a node stored contiguously.
+    ///
+    /// Objects whose center lies outside of the world bounds are kept at the root, which is never culled.
+    template <typename T, typename = typename std::enable_if_t<std::is_floating_point_v<T>>>
+    class basic_loose_octree final
+    {
+    public:
+        /// Identifies an object stored in the octree.
+        using handle_type = std::uint32_t;
+
+        /// Value used to represent an invalid object handle.
+        constexpr static handle_type invalid_handle = std::numeric_limits<handle_type>::max();
+
+    public:
+        /// Initializes a new instance of the basic_loose_octree class.
+        /// \param center the center of the world bounds.
+        /// \param half_size half the edge length of the world bounds.
+        /// \param max_depth the maximum depth of the tree, the root being at depth zero.
+        basic_loose_octree(const basic_vector3<T>& center, T half_size, std::uint32_t max_depth = 8)
+            : _nodes       { }
+            , _objects     { }
+            , _max_depth   { max_depth }
+            , _free_object { invalid_handle }
+            , _count       { 0 }
+        {
+            Expects(half_size > T(0) && max_depth < 32);
+
+            _nodes.push_back({ center, half_size, invalid_handle, invalid_handle, 0 });
+        }
+
+    public:
+        /// Gets the number of objects stored in the octree.
+        /// \returns the number of objects stored in the octree.
+        std::size_t size() const noexcept
+        {
+            return _count;
+        }
+
+        /// Gets the number of nodes allocated by the octree.
+        /// \returns the number of nodes allocated by the octree.
+        std::size_t node_count() const noexcept
+        {
+            return _nodes.size();
+        }
+
+        /// Gets the bounds of the given object.
+        /// \param handle the object handle.
+        /// \returns the bounds of the given object.
+        const basic_bounding_box<T>& bounds(handle_type handle) const noexcept
+        {
+            Expects(is_alive(handle));
+
+            return _objects[handle].box;
+        }
+
+        /// Inserts a new object in the octree.
+        /// \param box the object bounds.
+        /// \returns the handle of the new object.
+        handle_type insert(const basic_bounding_box<T>& box)
+        {
+            handle_type handle = _free_object;
+
+            if (handle != invalid_handle)
+            {
+                _free_object = _objects[handle].next_free;
+                _objects[handle].box = box;
+            }
+            else
+            {
+                handle = static_cast<handle_type>(_objects.size());
+                _objects.push_back({ box, 0, invalid_handle, invalid_handle, invalid_handle, false });
+            }
+
+            _objects[handle].next_free = invalid_handle;
+            _objects[handle].alive     = true;
+
+            link(handle, locate(box));
+
+            ++_count;
+
+            return handle;
+        }
+
+        /// Updates the bounds of an object, moving it to another node only when it no longer fits its current one.
+        /// \param handle the object handle.
+        /// \param box the new object bounds.
+        void update(handle_type handle, const basic_bounding_box<T>& box)
+        {
+            Expects(is_alive(handle));
+
+            auto& record = _objects[handle];
+
+            record.box = box;
+
+            if (fits(record.node, box))
+            {
+                return;
+            }
+
+            unlink(handle);
+            link(handle, locate(box));
+        }
+
+        /// Removes an object from the octree.
+        /// \param handle the object handle.
+        void remove(handle_type handle) noexcept
+        {
+            Expects(is_alive(handle));
+
+            unlink(handle);
+
+            auto& record = _objects[handle];
+
+            record.alive     = false;
+            record.next_free = _free_object;
+            _free_object     = handle;
+
+            --_count;
+        }
+
+        /// Removes all the objects and nodes from the octree, keeping the allocated storage.
+        void clear() noexcept
+        {
+            _nodes.erase(_nodes.begin() + 1, _nodes.end());
+            _nodes[0].children     = invalid_handle;
+            _nodes[0].first_object = invalid_handle;
+
+            _objects.clear();
+
+            _free_object = invalid_handle;
+            _count       = 0;
+        }
+
+    public:
+        /// Invokes the given function once for every object whose bounds intersect the given box.
+        /// \param box the query volume.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(const basic_bounding_box<T>& box, Function&& fn) const
+        {
+            query_volume(0, [&] (const basic_bounding_box<T>& bounds) -> bool { return intersects(box, bounds); }, fn);
+        }
+
+        /// Invokes the given function once for every object whose bounds intersect the given sphere.
+        /// \param sphere the query volume.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(const basic_bounding_sphere<T>& sphere, Function&& fn) const
+        {
+            query_volume(0, [&] (const basic_bounding_box<T>& bounds) -> bool { return intersects(bounds, sphere); }, fn);
+        }
+
+        /// Invokes the given function once for every object whose bounds intersect the given frustum.
+        ///
+        /// Nodes pass down the planes their bounds straddle, so the children of a node lying inside a plane are not
+        /// tested against it again, and whole subtrees inside the frustum are reported without testing. Objects are
+        /// culled with the plane test, so a few lying just outside the frustum edges may be reported too.
+        /// \param frustrum the query volume.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(const basic_bounding_frustrum<T>& frustrum, Function&& fn) const
+        {
+            auto classify = [&] (std::uint32_t, const basic_bounding_box<T>& box, std::uint32_t& plane_mask) -> bool
+            {
+                return (contains(frustrum, box, plane_mask) != containment_type::disjoint);
+            };
+
+            query_frustrum(0, frustrum_all_planes, classify, classify, fn);
+        }
+
+        /// Invokes the given function once for every object whose bounds intersect the frustum of the given culling
+        /// context, which remembers the plane that rejected each node and object for the next frames.
+        /// \param context the culling context, holding the query frustum.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(basic_frustrum_culling_context<T>& context, Function&& fn) const
+        {
+            auto classify_node = [&] (std::uint32_t index, const auto& box, std::uint32_t& plane_mask) -> bool
+            {
+                return (context.contains_node(index, box, plane_mask) != containment_type::disjoint);
+            };
+            auto classify_object = [&] (handle_type handle, const auto& box, std::uint32_t& plane_mask) -> bool
+            {
+                return (context.contains_object(handle, box, plane_mask) != containment_type::disjoint);
+            };
+
+            query_frustrum(0, frustrum_all_planes, classify_node, classify_object, fn);
+        }
+
+        /// Invokes the given function once for every object whose bounds are hit by the given ray, in no particular
+        /// order.
+        /// \param ray_ the query ray.
+        /// \param fn function invoked with the handle of each object found and the distance at which the ray hits it.
+        template <typename Function>
+        void query(const basic_ray<T>& ray_, Function&& fn) const
+        {
+            query_ray(0, ray_, fn);
+        }
+
+    private:
+        struct node
+        {
+            basic_vector3<T> center;
+            T                half_size;
+            std::uint32_t    children;      // index of the first of the eight children, or invalid_handle
+            handle_type      first_object;
+            std::uint32_t    depth;
+        };
+
+        struct object_record
+        {
+            basic_bounding_box<T> box;
+            std::uint32_t         node;
+            handle_type           prev;
+            handle_type           next;
+            handle_type           next_free;
+            bool                  alive;
+        };
+
+    private:
+        static basic_vector3<T> center_of(const basic_bounding_box<T>& box) noexcept
+        {
+            return (box.min + box.max) * T(0.5);
+        }
+
+        static bool inside_cell(const node& current, const basic_vector3<T>& position) noexcept
+        {
+            return std::abs(position.x - current.center.x) <= current.half_size
+                && std::abs(position.y - current.center.y) <= current.half_size
+                && std::abs(position.z - current.center.z) <= current.half_size;
+        }
+
+        static basic_bounding_box<T> loose_bounds_of(const node& current) noexcept
+        {
+            auto extent = basic_vector3<T> { current.half_size * T(2) };
+
+            return { current.center - extent, current.center + extent };
+        }
+
+        bool is_alive(handle_type handle) const noexcept
+        {
+            return (handle < _objects.size() && _objects[handle].alive);
+        }
+
+        std::uint32_t depth_of(const basic_bounding_box<T>& box) const noexcept
+        {
+            auto extent = (box.max - box.min) * T(0.5);
+            auto radius = std::max(extent.x, std::max(extent.y, extent.z));
+
+            // The deepest node whose cell half size is not smaller than the object half size
+            if (radius <= _nodes[0].half_size / T(std::uint64_t(1) << _max_depth))
+            {
+                return _max_depth;
+            }
+            if (radius >= _nodes[0].half_size)
+            {
+                return 0;
+            }
+
+            return std::min(_max_depth, static_cast<std::uint32_t>(std::floor(std::log2(_nodes[0].half_size / radius))));
+        }
+
+        bool fits(std::uint32_t index, const basic_bounding_box<T>& box) const noexcept
+        {
+            auto position = center_of(box);
+
+            if (!inside_cell(_nodes[0], position))
+            {
+                return (index == 0);
+            }
+
+            return (_nodes[index].depth == depth_of(box) && inside_cell(_nodes[index], position));
+        }
+
+        std::uint32_t locate(const basic_bounding_box<T>& box)
+        {
+            auto          position = center_of(box);
+            auto          depth    = depth_of(box);
+            std::uint32_t index    = 0;
+
+            if (!inside_cell(_nodes[0], position))
+            {
+                return index;
+            }
+
+            while (_nodes[index].depth < depth)
+            {
+                if (_nodes[index].children == invalid_handle)
+                {
+                    split(index);
+                }
+
+                const auto& current = _nodes[index];
+
+                index = current.children
+                      + ((position.x >= current.center.x) ? 1u : 0u)
+                      + ((position.y >= current.center.y) ? 2u : 0u)
+                      + ((position.z >= current.center.z) ? 4u : 0u);
+            }
+
+            return index;
+        }
+
+        void split(std::uint32_t index)
+        {
+            auto parent = _nodes[index];
+            auto first  = static_cast<std::uint32_t>(_nodes.size());
+            auto half   = parent.half_size * T(0.5);
+
+            for (std::uint32_t i = 0; i < 8; ++i)
+            {
+                basic_vector3<T> offset { (i & 1) ? half : -half, (i & 2) ? half : -half, (i & 4) ? half : -half };
+
+                _nodes.push_back({ parent.center + offset, half, invalid_handle, invalid_handle, parent.depth + 1 });
+            }
+
+            _nodes[index].children = first;
+        }
+
+        void link(handle_type handle, std::uint32_t index) noexcept
+        {
+            auto& record = _objects[handle];
+            auto& owner  = _nodes[index];
+
+            record.node = index;
+            record.prev = invalid_handle;
+            record.next = owner.first_object;
+
+            if (owner.first_object != invalid_handle)
+            {
+                _objects[owner.first_object].prev = handle;
+            }
+
+            owner.first_object = handle;
+        }
+
+        void unlink(handle_type handle) noexcept
+        {
+            auto& record = _objects[handle];
+
+            if (record.prev != invalid_handle)
+            {
+                _objects[record.prev].next = record.next;
+            }
+            else
+            {
+                _nodes[record.node].first_object = record.next;
+            }
+
+            if (record.next != invalid_handle)
+            {
+                _objects[record.next].prev = record.prev;
+            }
+
+            record.prev = invalid_handle;
+            record.next = invalid_handle;
+        }
+
+        template <typename Function>
+        void report_subtree(std::uint32_t index, Function& fn) const
+        {
+            const auto& current = _nodes[index];
+
+            for (auto i = current.first_object; i != invalid_handle; i = _objects[i].next)
+            {
+                fn(i);
+            }
+
+            if (current.children != invalid_handle)
+            {
+                for (std::uint32_t i = 0; i < 8; ++i)
+                {
+                    report_subtree(current.children + i, fn);
+                }
+            }
+        }
+
+        template <typename Predicate, typename Function>
+        void query_volume(std::uint32_t index, const Predicate& predicate, Function& fn) const
+        {
+            const auto& current = _nodes[index];
+
+            // The root also holds the objects lying outside of the world bounds, so it is never culled
+            if (index != 0 && !predicate(loose_bounds_of(current)))
+            {
+                return;
+            }
+
+            for (auto i = current.first_object; i != invalid_handle; i = _objects[i].next)
+            {
+                if (predicate(_objects[i].box))
+                {
+                    fn(i);
+                }
+            }
+
+            if (current.children != invalid_handle)
+            {
+                for (std::uint32_t i = 0; i < 8; ++i)
+                {
+                    query_volume(current.children + i, predicate, fn);
+                }
+            }
+        }
+
+        template <typename NodePredicate, typename ObjectPredicate, typename Function>
+        void query_frustrum(std::uint32_t          index
+                          , std::uint32_t          plane_mask
+                          , const NodePredicate&   classify_node
+                          , const ObjectPredicate& classify_object
+                          , Function&              fn) const
+        {
+            const auto& current = _nodes[index];
+
+            if (index != 0 && !classify_node(index, loose_bounds_of(current), plane_mask))
+            {
+                return;
+            }
+
+            if (plane_mask == 0)
+            {
+                report_subtree(index, fn);
+                return;
+            }
+
+            for (auto i = current.first_object; i != invalid_handle; i = _objects[i].next)
+            {
+                auto object_mask = plane_mask;
+
+                if (classify_object(i, _objects[i].box, object_mask))
+                {
+                    fn(i);
+                }
+            }
+
+            if (current.children != invalid_handle)
+            {
+                for (std::uint32_t i = 0; i < 8; ++i)
+                {
+                    query_frustrum(current.children + i, plane_mask, classify_node, classify_object, fn);
+                }
+            }
+        }
+
+        template <typename Function>
+        void query_ray(std::uint32_t index, const basic_ray<T>& ray_, Function& fn) const
+        {
+            const auto& current = _nodes[index];
+
+            if (index != 0 && !intersects(ray_, loose_bounds_of(current)))
+            {
+                return;
+            }
+
+            for (auto i = current.first_object; i != invalid_handle; i = _objects[i].next)
+            {
+                auto distance = intersection_distance(ray_, _objects[i].box);
+
+                if (distance.has_value())
+                {
+                    fn(i, *distance);
+                }
+            }
+
+            if (current.children != invalid_handle)
+            {
+                for (std::uint32_t i = 0; i < 8; ++i)
+                {
+                    query_ray(current.children + i, ray_, fn);
+                }
+            }
+        }
+
+    private:
+        std::vector<node>          _nodes;
+        std::vector<object_record> _objects;
+        std::uint32_t              _max_depth;
+        handle_type                _free_object;
+        std::size_t                _count;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using loose_octree = basic_loose_octree<float>;
+}
+
+#endif // SCENER_MATH_BASIC_LOOSE_OCTREE_HPP
@@ -9,35 +9,38 @@
 #include <functional>
 #include <limits>
 #include <type_traits>
+#include <utility>
+
+#include "scener/math/type_traits.hpp"
 
 namespace scener::math
 {
     /// Represents the mathematical constant e.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T e = T(M_E);
 
     /// Represents the log base ten of e.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T log_10E = T(M_LOG10E);
 
     /// Represents the log base two of e.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T log_2E = T(M_LOG2E);
 
     /// Represents the value of PI
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T pi = T(M_PI);
 
     /// Represents the value of PI divided by 2
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T pi_over_2 = T(M_PI_2);
 
     /// Represents the value of PI divided by 4
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T pi_over_4 = T(M_PI_4);
 
     /// Represents the value of pi times two.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T two_pi = T(M_2_PI);
 
     /// Represents positive infinity.
@@ -53,22 +56,22 @@ namespace scener::math
     constexpr T NaN = std::numeric_limits<T>::quiet_NaN();
 
     /// Represents the smallest positive value that is greater than zero.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T epsilon = std::numeric_limits<T>::epsilon();
 
     /// Represents the smallest possible value of the underliying template type.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T min_value = std::numeric_limits<T>::lowest();
 
     /// Represents the largest possible value of the underliying template type.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T max_value = std::numeric_limits<T>::max();
 
     /// Equality comparision between two values.
     /// \param value1 the first value.
     /// \param value2 the second value.
     /// \returns true if both values are equal; false otherwise.
-    template <typename T, typename S, typename = std::enable_if_t<std::is_arithmetic_v<T> && std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = std::enable_if_t<is_arithmetic_like_v<T> && is_arithmetic_like_v<S>>>
     constexpr bool equal(T value1, S value2) noexcept
     {
         typedef typename std::common_type<T, S>::type common_t;
@@ -124,7 +127,7 @@ namespace scener::math
     /// \param y a divisor.
     /// \returns a number equal to x - (y Q), where Q is the quotient of x / y rounded to the nearest integer
     ///          (if x / y falls halfway between two integers, the even integer is returned).
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     inline T ieee_remainder(T x, T y) noexcept
     {
         // Reference: https://msdn.microsoft.com/es-es/library/system.math.ieeeremainder%28v=vs.110%29.aspx
@@ -142,7 +145,7 @@ namespace scener::math
     /// \param amount2 the normalized barycentric (areal) coordinate b3, equal to the weighting factor for vertex 3,
     ///                the coordinate of which is specified in value3.
     /// \returns the Cartesian coordinate.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T barycentric(T value1, T value2, T value3, T amount1, T amount2) noexcept
     {
         // Reference: http://msdn.microsoft.com/en-us/library/microsoft.xna.framework.Math.barycentric(v=xnagamestudio.40).aspx
@@ -162,7 +165,7 @@ namespace scener::math
     /// \param value4 the fourth position in the interpolation.
     /// \param amount weighting factor.
     /// \returns the interpolation result.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T catmull_rom(T value1, T value2, T value3, T value4, T amount) noexcept
     {
         // Reference: http://msdn.microsoft.com/en-us/library/windows/desktop/bb324331(v=vs.85).aspx
@@ -183,7 +186,7 @@ namespace scener::math
     /// \param min_ the min value.
     /// \param max_ the max value.
     /// \returns the clamped value.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T clamp(T value, T min_, T max_) noexcept
     {
         const T max_value = ((max_ < min_) ? min_ : max_);
@@ -198,7 +201,7 @@ namespace scener::math
     /// \param tangent2 source tangent 2.
     /// \param amount weighting factor.
     /// \returns the interpolation result.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T hermite(T value1, T tangent1, T value2, T tangent2, T amount) noexcept
     {
         // Reference: http://cubic.org/docs/hermite.htm
@@ -224,7 +227,7 @@ namespace scener::math
     /// \param value2 second values.
     /// \param amount value between 0 and 1 indicating the weight of value2.
     /// \returns the linear interpolation of the two values.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T lerp(T value1, T value2, T amount) noexcept
     {
         // Reference: http://msdn.microsoft.com/en-us/library/bb197812.aspx
@@ -236,7 +239,7 @@ namespace scener::math
     /// \param value2 second value
     /// \param amount weighting value.
     /// \returns the interpolation result.
-    template <typename T = float, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T = float, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     constexpr T smooth_step(T value1, T value2, T amount) noexcept
     {
         // Reference: http://msdn.microsoft.com/en-us/library/windows/desktop/microsoft.directx_sdk.geometric.xmvectorlerp(v=vs.85).aspx
@@ -244,6 +247,341 @@ namespace scener::math
 
         return lerp(value1, value2, t * t * (3 - 2 * t));
     }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // CONSTANT EXPRESSION FRIENDLY FUNCTIONS
+
+    namespace detail
+    {
+        /// Returns true when called during constant evaluation. Without compiler support every call takes the
+        /// constant expression path, so the functions below stay usable at compile time everywhere.
+        constexpr bool is_constant_evaluated() noexcept
+        {
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+            return __builtin_is_constant_evaluated();
+#else
+            return true;
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+            return __builtin_is_constant_evaluated();
+#else
+            return true;
+#endif
+        }
+
+        /// Result type of the functions below, integral arguments are computed as double like <cmath> does.
+        template <typename T>
+        using floating_point_t = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+        constexpr bool is_nan(double x) noexcept
+        {
+            return x != x;
+        }
+
+        constexpr bool is_finite(double x) noexcept
+        {
+            return x - x == 0.0;
+        }
+
+        constexpr double sqrt(double x) noexcept
+        {
+            if (is_nan(x) || x < 0.0)
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (x == 0.0 || !is_finite(x))
+            {
+                return x;
+            }
+
+            // Scales x by powers of four into [0.25, 4], where Newton's iteration converges in a few steps
+            double scale = 1.0;
+
+            while (x > 4.0)
+            {
+                x     *= 0.25;
+                scale *= 2.0;
+            }
+            while (x < 0.25)
+            {
+                x     *= 4.0;
+                scale *= 0.5;
+            }
+
+            double result = 0.5 * (1.0 + x);
+
+            for (int i = 0; i < 6; ++i)
+            {
+                result = 0.5 * (result + x / result);
+            }
+
+            return result * scale;
+        }
+
+        /// Reduces x to r in [-pi/4, pi/4], x = r + quadrant * pi/2, subtracting pi/2 in two parts to keep the
+        /// bits lost by a single subtraction (fdlibm's pio2_1 and pio2_1t).
+        constexpr double reduce_half_pi(double x, long long& quadrant) noexcept
+        {
+            constexpr double inv_pio2 = 6.36619772367581382433e-01;
+            constexpr double pio2_1   = 1.57079632673412561417e+00;
+            constexpr double pio2_1t  = 6.07710050650619224932e-11;
+
+            auto k = x * inv_pio2;
+
+            quadrant = static_cast<long long>(k >= 0.0 ? k + 0.5 : k - 0.5);
+
+            auto n = static_cast<double>(quadrant);
+
+            return (x - n * pio2_1) - n * pio2_1t;
+        }
+
+        /// Sine on [-pi/4, pi/4] (fdlibm's __kernel_sin coefficients).
+        constexpr double sin_kernel(double x) noexcept
+        {
+            constexpr double s1 = -1.66666666666666324348e-01;
+            constexpr double s2 =  8.33333333332248946124e-03;
+            constexpr double s3 = -1.98412698298579493134e-04;
+            constexpr double s4 =  2.75573137070700676789e-06;
+            constexpr double s5 = -2.50507602534068634195e-08;
+            constexpr double s6 =  1.58969099521155010221e-10;
+
+            auto z = x * x;
+
+            return x + z * x * (s1 + z * (s2 + z * (s3 + z * (s4 + z * (s5 + z * s6)))));
+        }
+
+        /// Cosine on [-pi/4, pi/4] (fdlibm's __kernel_cos coefficients).
+        constexpr double cos_kernel(double x) noexcept
+        {
+            constexpr double c1 =  4.16666666666666019037e-02;
+            constexpr double c2 = -1.38888888888741095749e-03;
+            constexpr double c3 =  2.48015872894767294178e-05;
+            constexpr double c4 = -2.75573143513906633035e-07;
+            constexpr double c5 =  2.08757232129817482790e-09;
+            constexpr double c6 = -1.13596475577881948265e-11;
+
+            auto z = x * x;
+
+            return (1.0 - 0.5 * z) + z * z * (c1 + z * (c2 + z * (c3 + z * (c4 + z * (c5 + z * c6)))));
+        }
+
+        constexpr double sin(double x) noexcept
+        {
+            if (!is_finite(x))
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            long long quadrant = 0;
+
+            auto r = reduce_half_pi(x, quadrant);
+
+            switch (quadrant & 3)
+            {
+            case 0:  return  sin_kernel(r);
+            case 1:  return  cos_kernel(r);
+            case 2:  return -sin_kernel(r);
+            default: return -cos_kernel(r);
+            }
+        }
+
+        constexpr double cos(double x) noexcept
+        {
+            if (!is_finite(x))
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            long long quadrant = 0;
+
+            auto r = reduce_half_pi(x, quadrant);
+
+            switch (quadrant & 3)
+            {
+            case 0:  return  cos_kernel(r);
+            case 1:  return -sin_kernel(r);
+            case 2:  return -cos_kernel(r);
+            default: return  sin_kernel(r);
+            }
+        }
+
+        /// Sine and cosine of x sharing a single argument reduction.
+        constexpr std::pair<double, double> sincos(double x) noexcept
+        {
+            if (!is_finite(x))
+            {
+                return { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() };
+            }
+
+            long long quadrant = 0;
+
+            auto r = reduce_half_pi(x, quadrant);
+            auto s = sin_kernel(r);
+            auto c = cos_kernel(r);
+
+            switch (quadrant & 3)
+            {
+            case 0:  return {  s,  c };
+            case 1:  return {  c, -s };
+            case 2:  return { -s, -c };
+            default: return { -c,  s };
+            }
+        }
+
+        constexpr double tan(double x) noexcept
+        {
+            if (!is_finite(x))
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            long long quadrant = 0;
+
+            auto r = reduce_half_pi(x, quadrant);
+            auto s = sin_kernel(r);
+            auto c = cos_kernel(r);
+
+            return (quadrant & 1) ? -c / s : s / c;
+        }
+
+        /// Rational approximation used by acos (fdlibm's e_acos.c), z = x^2 or z = (1 - |x|) / 2.
+        constexpr double acos_rational(double z) noexcept
+        {
+            constexpr double ps0 =  1.66666666666666657415e-01;
+            constexpr double ps1 = -3.25565818622400915405e-01;
+            constexpr double ps2 =  2.01212532134862925881e-01;
+            constexpr double ps3 = -4.00555345006794114027e-02;
+            constexpr double ps4 =  7.91534994289814532176e-04;
+            constexpr double ps5 =  3.47933107596021167570e-05;
+            constexpr double qs1 = -2.40339491173441421878e+00;
+            constexpr double qs2 =  2.02094576023350569471e+00;
+            constexpr double qs3 = -6.88283971605453293030e-01;
+            constexpr double qs4 =  7.70381505559019352791e-02;
+
+            auto p = z * (ps0 + z * (ps1 + z * (ps2 + z * (ps3 + z * (ps4 + z * ps5)))));
+            auto q = 1.0 + z * (qs1 + z * (qs2 + z * (qs3 + z * qs4)));
+
+            return p / q;
+        }
+
+        constexpr double acos(double x) noexcept
+        {
+            constexpr double pio2_hi = 1.57079632679489655800e+00;
+            constexpr double pio2_lo = 6.12323399573676603587e-17;
+
+            if (is_nan(x) || x > 1.0 || x < -1.0)
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (x < 0.5 && x > -0.5)
+            {
+                return pio2_hi - (x - (pio2_lo - x * acos_rational(x * x)));
+            }
+            if (x < 0.0)
+            {
+                auto z = (1.0 + x) * 0.5;
+                auto s = sqrt(z);
+
+                return 2.0 * (pio2_hi - (s + (acos_rational(z) * s - pio2_lo)));
+            }
+
+            auto z = (1.0 - x) * 0.5;
+            auto s = sqrt(z);
+
+            return 2.0 * (s + acos_rational(z) * s);
+        }
+    }
+
+    /// Computes the square root of the given value. Usable in constant expressions, at run time it calls std::sqrt.
+    /// \param x the value.
+    /// \returns the square root of x, NaN if x is negative.
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr detail::floating_point_t<T> sqrt(T x) noexcept
+    {
+        if (detail::is_constant_evaluated())
+        {
+            return static_cast<detail::floating_point_t<T>>(detail::sqrt(static_cast<double>(x)));
+        }
+
+        return std::sqrt(x);
+    }
+
+    /// Computes the sine of the given angle. Usable in constant expressions, at run time it calls std::sin.
+    /// \param x the angle, in radians.
+    /// \returns the sine of x; in constant expressions accuracy drops for angles larger than about 1e9 radians.
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr detail::floating_point_t<T> sin(T x) noexcept
+    {
+        if (detail::is_constant_evaluated())
+        {
+            return static_cast<detail::floating_point_t<T>>(detail::sin(static_cast<double>(x)));
+        }
+
+        return std::sin(x);
+    }
+
+    /// Computes the cosine of the given angle. Usable in constant expressions, at run time it calls std::cos.
+    /// \param x the angle, in radians.
+    /// \returns the cosine of x; in constant expressions accuracy drops for angles larger than about 1e9 radians.
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr detail::floating_point_t<T> cos(T x) noexcept
+    {
+        if (detail::is_constant_evaluated())
+        {
+            return static_cast<detail::floating_point_t<T>>(detail::cos(static_cast<double>(x)));
+        }
+
+        return std::cos(x);
+    }
+
+    /// Computes the sine and the cosine of the given angle at once. Usable in constant expressions, where both share
+    /// one argument reduction; at run time std::sin and std::cos are called side by side, which GCC and Clang merge
+    /// into a single sincos call.
+    /// \param x the angle, in radians.
+    /// \returns the sine and the cosine of x, in this order.
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr std::pair<detail::floating_point_t<T>, detail::floating_point_t<T>> sincos(T x) noexcept
+    {
+        using result_type = detail::floating_point_t<T>;
+
+        if (detail::is_constant_evaluated())
+        {
+            auto [s, c] = detail::sincos(static_cast<double>(x));
+
+            return { static_cast<result_type>(s), static_cast<result_type>(c) };
+        }
+
+        return { std::sin(x), std::cos(x) };
+    }
+
+    /// Computes the tangent of the given angle. Usable in constant expressions, at run time it calls std::tan.
+    /// \param x the angle, in radians.
+    /// \returns the tangent of x.
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr detail::floating_point_t<T> tan(T x) noexcept
+    {
+        if (detail::is_constant_evaluated())
+        {
+            return static_cast<detail::floating_point_t<T>>(detail::tan(static_cast<double>(x)));
+        }
+
+        return std::tan(x);
+    }
+
+    /// Computes the arc cosine of the given value. Usable in constant expressions, at run time it calls std::acos.
+    /// \param x the value, in [-1, 1].
+    /// \returns the arc cosine of x in radians, in [0, pi]; NaN if x is outside [-1, 1].
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
+    constexpr detail::floating_point_t<T> acos(T x) noexcept
+    {
+        if (detail::is_constant_evaluated())
+        {
+            return static_cast<detail::floating_point_t<T>>(detail::acos(static_cast<double>(x)));
+        }
+
+        return std::acos(x);
+    }
 }
 
 #endif // SCENER_MATH_BASIC_MATH_HPP
@@ -32,7 +32,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Represents a squared matrix.
-    template <typename T, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_matrix
     {
         using traits_type            = basic_matrix_traits<T, Dimension>;
@@ -4,13 +4,53 @@
 #ifndef SCENER_MATH_BASIC_MATRIX_OPERATIONS_HPP
 #define SCENER_MATH_BASIC_MATRIX_OPERATIONS_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <iterator>
 
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/aligned.hpp"
 #include "scener/math/basic_matrix.hpp"
 #include "scener/math/basic_angle.hpp"
 #include "scener/math/basic_quaternion_operations.hpp"
 #include "scener/math/basic_vector_operations.hpp"
 #include "scener/math/basic_plane_operations.hpp"
+#include "scener/math/euler_order.hpp"
+#include "scener/math/fast_math.hpp"
+#include "scener/math/executor.hpp"
+#include "scener/math/simd.hpp"
+
+namespace scener::math::detail
+{
+    /// Multiplies two 4x4 matrices of floats, one row of the result at a time; the result may alias either operand.
+    ///
+    /// Evaluates the products and sums of the scalar operator, which the compiler may fuse, so the results can differ
+    /// from it in the last bits.
+    template <typename Flags>
+    inline void multiply(const float* lhs, const float* rhs, float* result, Flags flags) noexcept
+    {
+        using row_type = simd<float, 4>;
+
+        auto r1 = row_type::load(rhs, flags);
+        auto r2 = row_type::load(rhs + 4, flags);
+        auto r3 = row_type::load(rhs + 8, flags);
+        auto r4 = row_type::load(rhs + 12, flags);
+
+        for (std::size_t i = 0; i < 16; i += 4)
+        {
+            auto row = row_type { lhs[i] } * r1;
+
+            row = row + row_type { lhs[i + 1] } * r2;
+            row = row + row_type { lhs[i + 2] } * r3;
+            row = row + row_type { lhs[i + 3] } * r4;
+
+            row.store(result + i, flags);
+        }
+    }
+}
 
 namespace scener::math::matrix
 {
@@ -304,7 +344,7 @@ namespace scener::math::matrix
     /// \param value2 second matrix.
     /// \param amount value between 0 and 1 indicating the weight of value2.
     /// \returns the linear interpolation of the two matrices.
-    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_matrix<T, Dimension> lerp(const basic_matrix<T, Dimension>& value1
                                             , const basic_matrix<T, Dimension>& value2
                                             , S                                 amount) noexcept
@@ -327,19 +367,21 @@ namespace scener::math::matrix
     constexpr basic_matrix4<T> create_from_axis_angle(const basic_vector3<T>& axis, const basic_radians<T>& angle) noexcept
     {
         // http://mathworld.wolfram.com/RodriguesRotationFormula.html
-        auto naxis = vector::normalize(axis);
-        T    cos   = std::cos(angle.value);
-        T    sin   = std::sin(angle.value);
-        T    cos_1 = 1 - cos;
-        T    x     = naxis.x;
-        T    y     = naxis.y;
-        T    z     = naxis.z;
-        T    xx    = x * x;
-        T    yy    = y * y;
-        T    zz    = z * z;
-        T    xy    = x * y;
-        T    yz    = y * z;
-        T    xz    = x * z;
+        // The axis is normalized through its named components, vector::normalize goes through the items array, which
+        // cannot be read in constant expressions when the components were the ones initialized.
+        auto [sin, cos] = math::sincos(angle.value);
+
+        T    length = math::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+        T    cos_1  = 1 - cos;
+        T    x      = axis.x / length;
+        T    y      = axis.y / length;
+        T    z      = axis.z / length;
+        T    xx     = x * x;
+        T    yy     = y * y;
+        T    zz     = z * z;
+        T    xy     = x * y;
+        T    yz     = y * z;
+        T    xz     = x * z;
 
         return {     cos + xx * cos_1,  z * sin + xy * cos_1, -y * sin + xz * cos_1
                , xy * cos_1 - z * sin,      cos + yy * cos_1,  x * sin + yz * cos_1
@@ -382,9 +424,50 @@ namespace scener::math::matrix
                                                         , const basic_radians<T>& pitch
                                                         , const basic_radians<T>& roll) noexcept
     {
-        return create_from_axis_angle(basic_vector3<T>::unit_z(), roll)
-             * create_from_axis_angle(basic_vector3<T>::unit_x(), pitch)
-             * create_from_axis_angle(basic_vector3<T>::unit_y(), yaw);
+        // Rz(roll) * Rx(pitch) * Ry(yaw) expanded, with one sincos per angle and no matrix products.
+        auto [sy, cy] = math::sincos(yaw.value);
+        auto [sp, cp] = math::sincos(pitch.value);
+        auto [sr, cr] = math::sincos(roll.value);
+
+        return { cr * cy + sr * sp * sy, sr * cp, sr * sp * cy - cr * sy
+               , cr * sp * sy - sr * cy, cr * cp, sr * sy + cr * sp * cy
+               , cp * sy               , -sp    , cp * cy                };
+    }
+
+    /// Creates a rotation matrix from a set of Euler angles.
+    /// \param angles the three angles, in radians, in the order given by the sequence.
+    /// \param order the sequence of axes the angles rotate about.
+    /// \returns the rotation matrix.
+    template <typename T = float>
+    constexpr basic_matrix4<T> create_from_euler(const basic_vector3<T>& angles, euler_order order) noexcept
+    {
+        auto [si, ci] = math::sincos(angles.x);
+        auto [sj, cj] = math::sincos(angles.y);
+        auto [sh, ch] = math::sincos(angles.z);
+
+        T m[3][3] = { };
+
+        math::detail::euler_to_rotation<T>(math::detail::axes_of(order), si, ci, sj, cj, sh, ch, m);
+
+        return { m[0][0], m[1][0], m[2][0]
+               , m[0][1], m[1][1], m[2][1]
+               , m[0][2], m[1][2], m[2][2] };
+    }
+
+    /// Gets the Euler angles of the rotation of the given matrix.
+    /// \param matrix the matrix, its upper 3x3 part must be a rotation.
+    /// \param order the sequence of axes of the result.
+    /// \returns the three angles, in radians, in the order given by the sequence. The middle angle is in [-pi/2, pi/2]
+    ///          for Tait-Bryan sequences and in [0, pi] for proper Euler ones, the others in [-pi, pi]. In gimbal lock
+    ///          the last angle is zero.
+    template <typename T = float>
+    inline basic_vector3<T> to_euler(const basic_matrix4<T>& matrix, euler_order order) noexcept
+    {
+        const T m[3][3] = { { matrix.m11, matrix.m21, matrix.m31 }
+                          , { matrix.m12, matrix.m22, matrix.m32 }
+                          , { matrix.m13, matrix.m23, matrix.m33 } };
+
+        return math::detail::euler_from_rotation(math::detail::axes_of(order), m);
     }
 
     /// Creates a perspective projection matrix.
@@ -546,7 +629,7 @@ namespace scener::math::matrix
         // yScale = cot(fovY/2)
         // xScale = yScale / aspect ratio
 
-        T yScale = T(1) / std::tan(fieldOfView.value * T(0.5));
+        T yScale = T(1) / math::tan(fieldOfView.value * T(0.5));
         T xScale = yScale / aspectRatio;
         T nsr    = zNear - zFar;
 
@@ -594,8 +677,7 @@ namespace scener::math::matrix
     constexpr basic_matrix4<T> create_rotation_x(const basic_radians<T>& angle) noexcept
     {
         // Reference: http://en.wikipedia.org/wiki/Rotation_matrix
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
 
         return { 1,    0,    0
                , 0,  cos,  sin
@@ -615,8 +697,7 @@ namespace scener::math::matrix
         // [r20][r21][r22][z - r20*x - r21*y - r22*z]
         // [0  ][0  ][0  ][1                        ]
 
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
         T y   = center.y;
         T z   = center.z;
 
@@ -632,8 +713,7 @@ namespace scener::math::matrix
     constexpr basic_matrix4<T> create_rotation_y(const basic_radians<T>& angle) noexcept
     {
         // Reference: http://en.wikipedia.org/wiki/Rotation_matrix
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
 
         return {  cos, 0, -sin
                ,    0, 1,    0
@@ -653,8 +733,7 @@ namespace scener::math::matrix
         // [r20][r21][r22][z - r20*x - r21*y - r22*z]
         // [0  ][0  ][0  ][1                        ]
 
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
         T x   = center.x;
         T z   = center.z;
 
@@ -670,8 +749,7 @@ namespace scener::math::matrix
     constexpr basic_matrix4<T> create_rotation_z(const basic_radians<T>& angle) noexcept
     {
         // Reference: http://en.wikipedia.org/wiki/Rotation_matrix
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
 
         return {  cos,  sin, 0
                , -sin,  cos, 0
@@ -691,8 +769,7 @@ namespace scener::math::matrix
         // [r20][r21][r22][z - r20*x - r21*y - r22*z]
         // [0  ][0  ][0  ][1                        ]
 
-        T cos = std::cos(angle.value);
-        T sin = std::sin(angle.value);
+        auto [sin, cos] = math::sincos(angle.value);
         T x   = center.x;
         T y   = center.y;
 
@@ -882,6 +959,179 @@ namespace scener::math::matrix
     {
         return value * create_from_quaternion(rotation);
     }
+
+    /// Multiplies matrices pairwise, as lhs[i] * rhs[i].
+    ///
+    /// Aligned loads and stores are used when the three arrays are 16 bytes aligned, as they are when stored in
+    /// aligned_matrix4 values or in containers using aligned_allocator.
+    /// \param lhs the matrices on the left of the products.
+    /// \param rhs the matrices on the right of the products, of the same size as lhs.
+    /// \param result the products, of the same size as lhs; may be either operand.
+    inline void multiply(gsl::span<const basic_matrix4<float>> lhs
+                       , gsl::span<const basic_matrix4<float>> rhs
+                       , gsl::span<basic_matrix4<float>>       result) noexcept
+    {
+        Expects(lhs.size() == rhs.size() && lhs.size() == result.size());
+
+        if (math::detail::is_aligned(lhs.data(), 16)
+         && math::detail::is_aligned(rhs.data(), 16)
+         && math::detail::is_aligned(result.data(), 16))
+        {
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                math::detail::multiply(lhs[i].data(), rhs[i].data(), result[i].data(), math::detail::vector_aligned);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                math::detail::multiply(lhs[i].data(), rhs[i].data(), result[i].data(), math::detail::element_aligned);
+            }
+        }
+    }
+
+    /// Multiplies matrices pairwise, as lhs[i] * rhs[i], with the given executor.
+    /// \param executor the executor running the batch.
+    /// \param lhs the matrices on the left of the products.
+    /// \param rhs the matrices on the right of the products, of the same size as lhs.
+    /// \param result the products, of the same size as lhs; may be either operand.
+    template <typename Executor, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void multiply(Executor&&                            executor
+                , gsl::span<const basic_matrix4<float>> lhs
+                , gsl::span<const basic_matrix4<float>> rhs
+                , gsl::span<basic_matrix4<float>>       result)
+    {
+        parallel_batch(executor, [](auto l, auto r, auto p) { multiply(l, r, p); }, lhs, rhs, result);
+    }
+
+    /// Creates rotation matrices from sets of Euler angles, as create_from_euler(angles[i], order), evaluating the
+    /// sines and cosines with fast::sincos.
+    /// \param angles the sets of angles, in radians.
+    /// \param order the sequence of axes the angles rotate about.
+    /// \param result the rotation matrices, of the same size as angles.
+    inline void create_from_euler(gsl::span<const basic_vector3<float>> angles
+                                , euler_order                           order
+                                , gsl::span<basic_matrix4<float>>       result) noexcept
+    {
+        Expects(angles.size() == result.size());
+
+        using lanes = fast::detail::lanes;
+
+        auto axes = math::detail::axes_of(order);
+
+        auto kernel = [&](const basic_vector3<float>* source, basic_matrix4<float>* destination)
+        {
+            lanes a, b, c, si, ci, sj, cj, sh, ch;
+            lanes m[3][3];
+            float e[3][3][lanes::size()];
+
+            math::detail::deinterleave(source, a, b, c);
+
+            fast::detail::sincos<fast::precision::high>(a, si, ci);
+            fast::detail::sincos<fast::precision::high>(b, sj, cj);
+            fast::detail::sincos<fast::precision::high>(c, sh, ch);
+
+            math::detail::euler_to_rotation(axes, si, ci, sj, cj, sh, ch, m);
+
+            for (std::size_t r = 0; r < 3; ++r)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    m[r][k].store(e[r][k]);
+                }
+            }
+
+            for (std::size_t n = 0; n < lanes::size(); ++n)
+            {
+                destination[n] = { e[0][0][n], e[1][0][n], e[2][0][n]
+                                 , e[0][1][n], e[1][1][n], e[2][1][n]
+                                 , e[0][2][n], e[1][2][n], e[2][2][n] };
+            }
+        };
+
+        auto        count = static_cast<std::size_t>(angles.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(angles.data() + i, result.data() + i);
+        }
+
+        if (i < count)
+        {
+            // The remainder goes through the same kernel, so every element is computed the same way
+            basic_vector3<float> source[lanes::size()] = { };
+            basic_matrix4<float> destination[lanes::size()];
+
+            std::copy(angles.data() + i, angles.data() + count, source);
+            kernel(source, destination);
+            std::copy(destination, destination + (count - i), result.data() + i);
+        }
+    }
+
+    /// Gets the Euler angles of the rotations of matrices, as to_euler(source[i], order), evaluating the arc tangents
+    /// with fast::atan2.
+    /// \param source the matrices, their upper 3x3 parts must be rotations.
+    /// \param order the sequence of axes of the result.
+    /// \param angles the sets of angles, in radians, of the same size as source.
+    inline void to_euler(gsl::span<const basic_matrix4<float>> source
+                       , euler_order                           order
+                       , gsl::span<basic_vector3<float>>       angles) noexcept
+    {
+        Expects(source.size() == angles.size());
+
+        using lanes = fast::detail::lanes;
+
+        auto axes = math::detail::axes_of(order);
+
+        auto kernel = [&](const basic_matrix4<float>* matrices, basic_vector3<float>* destination)
+        {
+            lanes a, b, c;
+            lanes m[3][3];
+            float e[3][3][lanes::size()];
+
+            for (std::size_t n = 0; n < lanes::size(); ++n)
+            {
+                const auto& matrix = matrices[n];
+
+                e[0][0][n] = matrix.m11; e[0][1][n] = matrix.m21; e[0][2][n] = matrix.m31;
+                e[1][0][n] = matrix.m12; e[1][1][n] = matrix.m22; e[1][2][n] = matrix.m32;
+                e[2][0][n] = matrix.m13; e[2][1][n] = matrix.m23; e[2][2][n] = matrix.m33;
+            }
+
+            for (std::size_t r = 0; r < 3; ++r)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    m[r][k] = lanes::load(e[r][k]);
+                }
+            }
+
+            math::detail::euler_from_rotation(axes, m, a, b, c);
+            math::detail::interleave(a, b, c, destination);
+        };
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(source.data() + i, angles.data() + i);
+        }
+
+        if (i < count)
+        {
+            // Padded with identities, so the unused lanes stay finite
+            basic_matrix4<float> matrices[lanes::size()];
+            basic_vector3<float> destination[lanes::size()];
+
+            std::fill(std::begin(matrices), std::end(matrices), basic_matrix4<float>::identity());
+            std::copy(source.data() + i, source.data() + count, matrices);
+            kernel(matrices, destination);
+            std::copy(destination, destination + (count - i), angles.data() + i);
+        }
+    }
 }
 
 #endif // SCENER_MATH_BASIC_MATRIX_OPERATIONS_HPP
@@ -14,7 +14,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Defines a plane.
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_plane
     {
     public:
@@ -5,8 +5,11 @@
 #define SCENER_MATH_BASIC_PLANE_OPERATIONS_HPP
 
 #include "scener/math/basic_plane.hpp"
+#include "scener/math/basic_bounding_box.hpp"
+#include "scener/math/basic_bounding_sphere.hpp"
 #include "scener/math/basic_matrix.hpp"
 #include "scener/math/basic_vector_operations.hpp"
+#include "scener/math/plane_intersection_type.hpp"
 
 namespace scener::math::plane 
 {
@@ -80,23 +83,57 @@ namespace scener::math::plane
         return { value.normal * reciprocal_length, value.d * reciprocal_length };
     }
 
-    //template <typename T>
-    //plane_intersection_type intersects(const basic_plane<T>& plane, const bounding_box& box)
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //template <typename T>
-    //plane_intersection_type intersects(const basic_plane<T>& plane, const bounding_frustrum& frustrum)
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
-
-    //template <typename T>
-    //plane_intersection_type Plane::intersects(const basic_plane<T>& plane, const bounding_sphere& sphere)
-    //{
-    //    return sphere.intersects(plane);
-    //}
+    /// Checks whether the given plane intersects a bounding box.
+    /// \param p the plane.
+    /// \param box the bounding box to check for intersection with.
+    /// \returns the half-space of the plane the box lies in, or intersecting when the plane crosses the box.
+    template <typename T = float>
+    constexpr plane_intersection_type intersects(const basic_plane<T>& p, const basic_bounding_box<T>& box) noexcept
+    {
+        // Only the box corners farthest along (p-vertex) and against (n-vertex) the plane normal need to be tested.
+        // Reference: Akenine-Möller et al. "Real-Time Rendering", 3rd edition, section 16.10.1
+        basic_vector3<T> positive { (p.normal.x >= T(0)) ? box.max.x : box.min.x
+                                  , (p.normal.y >= T(0)) ? box.max.y : box.min.y
+                                  , (p.normal.z >= T(0)) ? box.max.z : box.min.z };
+
+        if (dot_coordinate(p, positive) < T(0))
+        {
+            return plane_intersection_type::back;
+        }
+
+        basic_vector3<T> negative { (p.normal.x >= T(0)) ? box.min.x : box.max.x
+                                  , (p.normal.y >= T(0)) ? box.min.y : box.max.y
+                                  , (p.normal.z >= T(0)) ? box.min.z : box.max.z };
+
+        if (dot_coordinate(p, negative) >= T(0))
+        {
+            return plane_intersection_type::front;
+        }
+
+        return plane_intersection_type::intersecting;
+    }
+
+    /// Checks whether the given plane intersects a bounding sphere.
+    /// \param p the plane, its normal is expected to be of unit length.
+    /// \param sphere the bounding sphere to check for intersection with.
+    /// \returns the half-space of the plane the sphere lies in, or intersecting when the plane crosses the sphere.
+    template <typename T = float>
+    constexpr plane_intersection_type intersects(const basic_plane<T>& p, const basic_bounding_sphere<T>& sphere) noexcept
+    {
+        auto distance = dot_coordinate(p, sphere.center);
+        auto radius   = T(sphere.radius);
+
+        if (distance < -radius)
+        {
+            return plane_intersection_type::back;
+        }
+        if (distance >= radius)
+        {
+            return plane_intersection_type::front;
+        }
+
+        return plane_intersection_type::intersecting;
+    }
 }
 
 #endif // SCENER_MATH_BASIC_PLANE_OPERATIONS_HPP
@@ -237,7 +237,7 @@ namespace scener::math
     // -----------------------------------------------------------------------------------------------------------------
     // OPERATORS (WITH SCALARS)
 
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T>& operator*=(basic_quaternion<T>& lhs, const S& rhs) noexcept
     {
         lhs.x *= rhs;
@@ -248,7 +248,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T> operator*(const basic_quaternion<T>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -258,7 +258,7 @@ namespace scener::math
         return result;
     }
 
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T>& operator/=(basic_quaternion<T>& lhs, const S& rhs) noexcept
     {
         lhs.x /= rhs;
@@ -269,7 +269,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T> operator/(const basic_quaternion<T>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -4,10 +4,448 @@
 #ifndef SCENER_MATH_BASIC_QUATERNION_OPERATIONS_HPP
 #define SCENER_MATH_BASIC_QUATERNION_OPERATIONS_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include <gsl/assert>
+#include <gsl/span>
+
 #include "scener/math/basic_quaternion.hpp"
 #include "scener/math/basic_angle.hpp"
 #include "scener/math/basic_matrix.hpp"
 #include "scener/math/basic_vector_operations.hpp"
+#include "scener/math/euler_order.hpp"
+#include "scener/math/fast_math.hpp"
+
+namespace scener::math::detail
+{
+    /// Loads the components of V::size() consecutive quaternions into separate x, y, z and w registers.
+    template <typename V>
+    inline void deinterleave(const basic_quaternion<float>* source, V& x, V& y, V& z, V& w) noexcept
+    {
+        float vx[V::size()];
+        float vy[V::size()];
+        float vz[V::size()];
+        float vw[V::size()];
+
+        for (std::size_t i = 0; i < V::size(); ++i)
+        {
+            vx[i] = source[i].x;
+            vy[i] = source[i].y;
+            vz[i] = source[i].z;
+            vw[i] = source[i].w;
+        }
+
+        x = V::load(vx);
+        y = V::load(vy);
+        z = V::load(vz);
+        w = V::load(vw);
+    }
+
+    /// Stores x, y, z and w registers as V::size() consecutive quaternions.
+    template <typename V>
+    inline void interleave(const V& x, const V& y, const V& z, const V& w
+                         , basic_quaternion<float>* destination) noexcept
+    {
+        float vx[V::size()];
+        float vy[V::size()];
+        float vz[V::size()];
+        float vw[V::size()];
+
+        x.store(vx);
+        y.store(vy);
+        z.store(vz);
+        w.store(vw);
+
+        for (std::size_t i = 0; i < V::size(); ++i)
+        {
+            destination[i] = { vx[i], vy[i], vz[i], vw[i] };
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // EULER ANGLES
+    //
+    // The kernels below take either plain values or simd registers. Rotation matrices are m[row][column] in column
+    // vector form, the transpose of the row vector matrices of the matrix namespace.
+
+    /// Rotation matrix of a set of Euler angles, given the sines and cosines of the three angles.
+    template <typename V>
+    constexpr void euler_to_rotation(const euler_axes& axes
+                                   , V si, const V& ci, V sj, const V& cj, V sh, const V& ch
+                                   , V (&m)[3][3]) noexcept
+    {
+        if (axes.odd)
+        {
+            si = -si;
+            sj = -sj;
+            sh = -sh;
+        }
+
+        auto i  = axes.i;
+        auto j  = axes.j;
+        auto k  = axes.k;
+        V    cc = ci * ch;
+        V    cs = ci * sh;
+        V    sc = si * ch;
+        V    ss = si * sh;
+
+        if (axes.repeated)
+        {
+            m[i][i] =  cj;      m[i][j] =  sj * si;       m[i][k] =  sj * ci;
+            m[j][i] =  sj * sh; m[j][j] = -cj * ss + cc;  m[j][k] = -cj * cs - sc;
+            m[k][i] = -sj * ch; m[k][j] =  cj * sc + cs;  m[k][k] =  cj * cc - ss;
+        }
+        else
+        {
+            m[i][i] =  cj * ch; m[i][j] =  sj * sc - cs;  m[i][k] =  sj * cc + ss;
+            m[j][i] =  cj * sh; m[j][j] =  sj * ss + cc;  m[j][k] =  sj * cs - sc;
+            m[k][i] = -sj;      m[k][j] =  cj * si;       m[k][k] =  cj * ci;
+        }
+    }
+
+    /// Quaternion of a set of Euler angles as { x, y, z, w }, given the sines and cosines of the half angles.
+    template <typename V>
+    constexpr void euler_to_quaternion(const euler_axes& axes
+                                     , const V& si, const V& ci, V sj, const V& cj, const V& sh, const V& ch
+                                     , V (&q)[4]) noexcept
+    {
+        if (axes.odd)
+        {
+            sj = -sj;
+        }
+
+        V cc = ci * ch;
+        V cs = ci * sh;
+        V sc = si * ch;
+        V ss = si * sh;
+
+        if (axes.repeated)
+        {
+            q[axes.i] = cj * (cs + sc);
+            q[axes.j] = sj * (cc + ss);
+            q[axes.k] = sj * (cs - sc);
+            q[3]      = cj * (cc - ss);
+        }
+        else
+        {
+            q[axes.i] = cj * sc - sj * cs;
+            q[axes.j] = cj * ss + sj * cc;
+            q[axes.k] = cj * cs - sj * sc;
+            q[3]      = cj * cc + sj * ss;
+        }
+
+        if (axes.odd)
+        {
+            q[axes.j] = -q[axes.j];
+        }
+    }
+
+    /// Rotation matrix of a quaternion, which does not need to be of unit length.
+    template <typename V>
+    constexpr void quaternion_to_rotation(const V& x, const V& y, const V& z, const V& w, V (&m)[3][3]) noexcept
+    {
+        V s  = V(2.0f) / (x * x + y * y + z * z + w * w);
+        V xs = x * s;
+        V ys = y * s;
+        V zs = z * s;
+        V wx = w * xs;
+        V wy = w * ys;
+        V wz = w * zs;
+        V xx = x * xs;
+        V xy = x * ys;
+        V xz = x * zs;
+        V yy = y * ys;
+        V yz = y * zs;
+        V zz = z * zs;
+
+        m[0][0] = V(1.0f) - (yy + zz); m[0][1] = xy - wz;               m[0][2] = xz + wy;
+        m[1][0] = xy + wz;             m[1][1] = V(1.0f) - (xx + zz);   m[1][2] = yz - wx;
+        m[2][0] = xz - wy;             m[2][1] = yz + wx;               m[2][2] = V(1.0f) - (xx + yy);
+    }
+
+    /// Euler angles of a rotation matrix. When the middle rotation aligns the first and the last axes (gimbal lock) the
+    /// last angle is set to zero and the first one takes the whole rotation about that axis.
+    template <typename T>
+    inline basic_vector3<T> euler_from_rotation(const euler_axes& axes, const T (&m)[3][3]) noexcept
+    {
+        constexpr T threshold = 16 * std::numeric_limits<T>::epsilon();
+
+        auto i = axes.i;
+        auto j = axes.j;
+        auto k = axes.k;
+        T    a = 0;
+        T    b = 0;
+        T    c = 0;
+
+        if (axes.repeated)
+        {
+            // Odd sequences flip the sign of the middle angle; (a, b, c) and (a + pi, -b, c + pi) are the same
+            // rotation, so the signs are applied to the atan2 arguments instead, keeping the middle angle in [0, pi]
+            T sign = axes.odd ? T(-1) : T(1);
+            T sj   = std::sqrt(m[i][j] * m[i][j] + m[i][k] * m[i][k]);
+
+            b = std::atan2(sj, m[i][i]);
+
+            if (sj > threshold)
+            {
+                a = std::atan2(m[i][j], sign * m[i][k]);
+                c = std::atan2(m[j][i], -sign * m[k][i]);
+            }
+            else
+            {
+                a = std::atan2(-sign * m[j][k], m[j][j]);
+            }
+
+            return { a, b, c };
+        }
+        else
+        {
+            T cj = std::sqrt(m[i][i] * m[i][i] + m[j][i] * m[j][i]);
+
+            b = std::atan2(-m[k][i], cj);
+
+            if (cj > threshold)
+            {
+                a = std::atan2(m[k][j], m[k][k]);
+                c = std::atan2(m[j][i], m[i][i]);
+            }
+            else
+            {
+                a = std::atan2(-m[j][k], m[j][j]);
+            }
+        }
+
+        if (axes.odd)
+        {
+            return { -a, -b, -c };
+        }
+
+        return { a, b, c };
+    }
+
+    /// Euler angles of V::size() rotation matrices, the simd counterpart of the function above.
+    template <typename V>
+    inline void euler_from_rotation(const euler_axes& axes, const V (&m)[3][3], V& a, V& b, V& c) noexcept
+    {
+        using fast::precision;
+        using fast::detail::atan2;
+
+        auto i         = axes.i;
+        auto j         = axes.j;
+        auto k         = axes.k;
+        auto zero      = V { 0.0f };
+        auto threshold = V { 16 * std::numeric_limits<float>::epsilon() };
+
+        if (axes.repeated)
+        {
+            auto sign   = V { axes.odd ? -1.0f : 1.0f };
+            auto sj     = sqrt(m[i][j] * m[i][j] + m[i][k] * m[i][k]);
+            auto locked = sj <= threshold;
+
+            b = atan2<precision::high>(sj, m[i][i]);
+            a = select(locked
+                     , atan2<precision::high>(-sign * m[j][k], m[j][j])
+                     , atan2<precision::high>(m[i][j], sign * m[i][k]));
+            c = select(locked, zero, atan2<precision::high>(m[j][i], -sign * m[k][i]));
+        }
+        else
+        {
+            auto cj     = sqrt(m[i][i] * m[i][i] + m[j][i] * m[j][i]);
+            auto locked = cj <= threshold;
+
+            b = atan2<precision::high>(-m[k][i], cj);
+            a = select(locked
+                     , atan2<precision::high>(-m[j][k], m[j][j])
+                     , atan2<precision::high>(m[k][j], m[k][k]));
+            c = select(locked, zero, atan2<precision::high>(m[j][i], m[i][i]));
+
+            if (axes.odd)
+            {
+                a = -a;
+                b = -b;
+                c = -c;
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // SWING TWIST
+    //
+    // The kernels below work on simd registers, quaternions are { x, y, z, w } arrays of them.
+
+    /// Hamilton product lhs * rhs.
+    template <typename V>
+    inline void quaternion_multiply(const V (&lhs)[4], const V (&rhs)[4], V (&result)[4]) noexcept
+    {
+        V x = lhs[3] * rhs[0] + lhs[0] * rhs[3] + lhs[1] * rhs[2] - lhs[2] * rhs[1];
+        V y = lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3] + lhs[2] * rhs[0];
+        V z = lhs[3] * rhs[2] + lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[2] * rhs[3];
+        V w = lhs[3] * rhs[3] - lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2];
+
+        result[0] = x;
+        result[1] = y;
+        result[2] = z;
+        result[3] = w;
+    }
+
+    /// Splits rotations as q = swing * twist, twist being a rotation about the given unit axis.
+    template <typename V>
+    inline void swing_twist(const V (&q)[4], const V (&axis)[3], V (&swing)[4], V (&twist)[4]) noexcept
+    {
+        auto d     = q[0] * axis[0] + q[1] * axis[1] + q[2] * axis[2];
+        auto n2    = d * d + q[3] * q[3];
+        auto valid = n2 > V { std::numeric_limits<float>::epsilon() * std::numeric_limits<float>::epsilon() };
+        auto scale = select(valid, V { 1.0f } / sqrt(n2), V { 0.0f });
+
+        twist[0] = d * scale * axis[0];
+        twist[1] = d * scale * axis[1];
+        twist[2] = d * scale * axis[2];
+        twist[3] = select(valid, q[3] * scale, V { 1.0f });
+
+        V inverse[4] = { -twist[0], -twist[1], -twist[2], twist[3] };
+
+        quaternion_multiply(q, inverse, swing);
+    }
+
+    /// Clamps the angles of twists about the given unit axis, the limits being half angles in [-pi/2, pi/2].
+    template <typename V>
+    inline void clamp_twist(V (&twist)[4], const V (&axis)[3], const V& lower, const V& upper) noexcept
+    {
+        // q and -q are the same rotation, the one with w >= 0 has its half angle in [-pi/2, pi/2]
+        auto sign = select(twist[3] < V { 0.0f }, V { -1.0f }, V { 1.0f });
+        auto d    = twist[0] * axis[0] + twist[1] * axis[1] + twist[2] * axis[2];
+        auto half = fast::detail::atan2<fast::precision::high>(sign * d, sign * twist[3]);
+        auto s    = V { };
+        auto c    = V { };
+
+        fast::detail::sincos<fast::precision::high>(min(max(half, lower), upper), s, c);
+
+        twist[0] = axis[0] * s;
+        twist[1] = axis[1] * s;
+        twist[2] = axis[2] * s;
+        twist[3] = c;
+    }
+
+    /// Clamps the angles of swings to a cone, given the half angle of the cone, in [0, pi/2], and its sine and cosine.
+    template <typename V>
+    inline void clamp_cone(V (&swing)[4], const V& limit, const V& sin_limit, const V& cos_limit) noexcept
+    {
+        auto sign    = select(swing[3] < V { 0.0f }, V { -1.0f }, V { 1.0f });
+        auto s       = sqrt(swing[0] * swing[0] + swing[1] * swing[1] + swing[2] * swing[2]);
+        auto half    = fast::detail::atan2<fast::precision::high>(s, sign * swing[3]);
+        auto limited = half > limit;
+        auto scale   = sign * sin_limit / s;
+
+        swing[0] = select(limited, swing[0] * scale, swing[0]);
+        swing[1] = select(limited, swing[1] * scale, swing[1]);
+        swing[2] = select(limited, swing[2] * scale, swing[2]);
+        swing[3] = select(limited, cos_limit, swing[3]);
+    }
+
+    /// Spherical linear interpolation along the shortest path, the simd counterpart of quat::slerp.
+    template <typename V>
+    inline void slerp(const V (&from)[4], const V (&to)[4], const V& amount, V (&result)[4]) noexcept
+    {
+        auto cos   = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+        auto sign  = select(cos < V { 0.0f }, V { -1.0f }, V { 1.0f });
+        auto theta = fast::detail::acos<fast::precision::high>(min(abs(cos), V { 1.0f }));
+        auto sin   = sqrt(max(V { 1.0f } - cos * cos, V { 0.0f }));
+
+        V sin1;
+        V sin2;
+        V unused;
+
+        fast::detail::sincos<fast::precision::high>((V { 1.0f } - amount) * theta, sin1, unused);
+        fast::detail::sincos<fast::precision::high>(amount * theta, sin2, unused);
+
+        // Nearly equal rotations fall back to a linear interpolation
+        auto apart = sin > V { 0.005f };
+        auto w1    = select(apart, sin1 / sin, V { 1.0f } - amount);
+        auto w2    = select(apart, sin2 / sin, amount) * sign;
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            result[i] = from[i] * w1 + to[i] * w2;
+        }
+    }
+
+    /// Runs a kernel over quaternions, V::size() at a time; the remainder is padded with identities and goes through
+    /// the same kernel, so every element is computed the same way.
+    template <typename V, typename Kernel>
+    inline void for_each_quaternion(gsl::span<const basic_quaternion<float>> source
+                                  , gsl::span<basic_quaternion<float>>       result
+                                  , Kernel&&                                 kernel) noexcept
+    {
+        Expects(source.size() == result.size());
+
+        auto process = [&](const basic_quaternion<float>* input, basic_quaternion<float>* output)
+        {
+            V q[4];
+
+            deinterleave(input, q[0], q[1], q[2], q[3]);
+            kernel(q);
+            interleave(q[0], q[1], q[2], q[3], output);
+        };
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + V::size() <= count; i += V::size())
+        {
+            process(source.data() + i, result.data() + i);
+        }
+
+        if (i < count)
+        {
+            basic_quaternion<float> input[V::size()];
+            basic_quaternion<float> output[V::size()];
+
+            std::fill(std::begin(input), std::end(input), basic_quaternion<float>::identity());
+            std::copy(source.data() + i, source.data() + count, input);
+            process(input, output);
+            std::copy(output, output + (count - i), result.data() + i);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // KEYFRAMES
+
+    /// Locates a time in a sequence of at least two increasing key times.
+    /// \param key_times the key times.
+    /// \param time the time to locate.
+    /// \param segment the segment of the previous call, a hint where to start looking; updated to the index of the key
+    ///        starting the segment containing the time, in [0, key_times.size() - 2].
+    /// \returns the position of the time inside the segment, in [0, 1]; times outside the keys are clamped.
+    inline float locate(gsl::span<const float> key_times, float time, std::size_t& segment) noexcept
+    {
+        auto last = static_cast<std::size_t>(key_times.size()) - 2;
+
+        segment = std::min(segment, last);
+
+        // Playback moves forward a key at a time, anything else falls back to a binary search
+        if (time < key_times[segment] || (segment < last && time >= key_times[segment + 2]))
+        {
+            auto next = std::upper_bound(key_times.begin() + 1, key_times.end() - 1, time);
+
+            segment = static_cast<std::size_t>(next - key_times.begin()) - 1;
+        }
+        else if (segment < last && time >= key_times[segment + 1])
+        {
+            ++segment;
+        }
+
+        auto start  = key_times[segment];
+        auto length = key_times[segment + 1] - start;
+
+        return std::clamp(length > 0.0f ? (time - start) / length : 0.0f, 0.0f, 1.0f);
+    }
+}
 
 namespace scener::math::quat 
 {
@@ -35,7 +473,7 @@ namespace scener::math::quat
     template <typename T = float>
     constexpr T length(const basic_quaternion<T>& q) noexcept
     {
-        return std::sqrt(length_squared(q));
+        return math::sqrt(length_squared(q));
     }
 
     /// Returns the conjugate of a specified quaternion.
@@ -60,14 +498,12 @@ namespace scener::math::quat
         // The quaternion in terms of axis-angle is:
         // q = cos(a/2) + i ( x * sin(a/2)) + j (y * sin(a/2)) + k ( z * sin(a/2))
 
-        auto theta = angle * T(0.5);
-        auto rads  = theta.value;
-        auto rSin  = std::sin(rads);
+        auto [sin, cos] = math::sincos(angle.value * T(0.5));
 
-        return { axis_of_rotation.x * rSin
-               , axis_of_rotation.y * rSin
-               , axis_of_rotation.z * rSin
-               , std::cos(rads) };
+        return { axis_of_rotation.x * sin
+               , axis_of_rotation.y * sin
+               , axis_of_rotation.z * sin
+               , cos };
     }
 
     /// Creates a Quaternion from a rotation Matrix.
@@ -82,7 +518,7 @@ namespace scener::math::quat
 
         if (tr > T(0))
         {
-            T s      = std::sqrt(tr + T(1));
+            T s      = math::sqrt(tr + T(1));
             result.w = s * T(0.5);
             s        = T(0.5) / s;
             result.x = (matrix.m23 - matrix.m32) * s;
@@ -93,7 +529,7 @@ namespace scener::math::quat
         {
             if ((matrix.m11 >= matrix.m22) && (matrix.m11 >= matrix.m33))
             {
-                T s      = std::sqrt(1 + matrix.m11 - matrix.m22 - matrix.m33);
+                T s      = math::sqrt(1 + matrix.m11 - matrix.m22 - matrix.m33);
                 T s2     = T(0.5) / s;
                 result.w = (matrix.m23 - matrix.m32) * s2;
                 result.x = T(0.5) * s;
@@ -102,7 +538,7 @@ namespace scener::math::quat
             }
             else if (matrix.m22 > matrix.m33)
             {
-                T s      = std::sqrt(1 + matrix.m22 - matrix.m11 - matrix.m33);
+                T s      = math::sqrt(1 + matrix.m22 - matrix.m11 - matrix.m33);
                 T s2     = T(0.5) / s;
                 result.w = (matrix.m31 - matrix.m13) * s2;
                 result.x = (matrix.m21 + matrix.m12) * s2;
@@ -111,7 +547,7 @@ namespace scener::math::quat
             }
             else
             {
-                T s      = std::sqrt(1 + matrix.m33 - matrix.m11 - matrix.m22);
+                T s      = math::sqrt(1 + matrix.m33 - matrix.m11 - matrix.m22);
                 T s2     = T(0.5) / s;
                 result.w = (matrix.m12 - matrix.m21) * s2;
                 result.x = (matrix.m31 + matrix.m13) * s2;
@@ -133,20 +569,49 @@ namespace scener::math::quat
                                                            , const basic_radians<T>& pitch
                                                            , const basic_radians<T>& roll) noexcept
     {
-        // http://www.j3d.org/matrix_faq/matrfaq_latest.html#Q60
-        // VECTOR3 vx = { 1, 0, 0 }, vy = { 0, 1, 0 }, vz = { 0, 0, 1 };
-        // QUATERNION qx, qy, qz, qt;
-        // quaternion_from_axisangle( qx, &vx, rx );
-        // quaternion_from_axisangle( qy, &vy, ry );
-        // quaternion_from_axisangle( qz, &vz, rz );
-        // quaternion_multiply( &qt, &qx, &qy );
-        // quaternion_multiply( &q,  &qt, &qz );
+        // qy * qx * qz expanded from the half angles, with one sincos per angle and no quaternion products.
+        auto [sy, cy] = math::sincos(yaw.value * T(0.5));
+        auto [sp, cp] = math::sincos(pitch.value * T(0.5));
+        auto [sr, cr] = math::sincos(roll.value * T(0.5));
+
+        return { cy * sp * cr + sy * cp * sr
+               , sy * cp * cr - cy * sp * sr
+               , cy * cp * sr - sy * sp * cr
+               , cy * cp * cr + sy * sp * sr };
+    }
+
+    /// Creates a quaternion from a set of Euler angles.
+    /// \param angles the three angles, in radians, in the order given by the sequence.
+    /// \param order the sequence of axes the angles rotate about.
+    /// \returns the unit quaternion of the rotation.
+    template <typename T = float>
+    constexpr basic_quaternion<T> create_from_euler(const basic_vector3<T>& angles, euler_order order) noexcept
+    {
+        auto [si, ci] = math::sincos(angles.x * T(0.5));
+        auto [sj, cj] = math::sincos(angles.y * T(0.5));
+        auto [sh, ch] = math::sincos(angles.z * T(0.5));
 
-        auto qy = create_from_axis_angle(basic_vector3<T>::unit_y(), yaw);
-        auto qx = create_from_axis_angle(basic_vector3<T>::unit_x(), pitch);
-        auto qz = create_from_axis_angle(basic_vector3<T>::unit_z(), roll);
+        T q[4] = { };
 
-        return (qy * qx) * qz; // yaw * pitch * roll
+        detail::euler_to_quaternion<T>(detail::axes_of(order), si, ci, sj, cj, sh, ch, q);
+
+        return { q[0], q[1], q[2], q[3] };
+    }
+
+    /// Gets the Euler angles of the rotation of the given quaternion.
+    /// \param q the quaternion, which does not need to be of unit length.
+    /// \param order the sequence of axes of the result.
+    /// \returns the three angles, in radians, in the order given by the sequence. The middle angle is in [-pi/2, pi/2]
+    ///          for Tait-Bryan sequences and in [0, pi] for proper Euler ones, the others in [-pi, pi]. In gimbal lock
+    ///          the last angle is zero.
+    template <typename T = float>
+    inline basic_vector3<T> to_euler(const basic_quaternion<T>& q, euler_order order) noexcept
+    {
+        T m[3][3] = { };
+
+        detail::quaternion_to_rotation<T>(q.x, q.y, q.z, q.w, m);
+
+        return detail::euler_from_rotation(detail::axes_of(order), m);
     }
 
     /// Calculates the dot product oof two quaternions.
@@ -198,7 +663,7 @@ namespace scener::math::quat
     /// \param quaternion2 second quaternion
     /// \param amount Value indicating how far to interpolate between the quaternions.
     /// \returns the result of the interpolation.
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T> lerp(const basic_quaternion<T>& quaternion1
                                      , const basic_quaternion<T>& quaternion2
                                      , S                          amount) noexcept
@@ -219,7 +684,7 @@ namespace scener::math::quat
     /// \param quaternion2 second quaternion
     /// \param amount Value indicating how far to interpolate between the quaternions.
     /// \returns the result of the interpolation.
-    template <typename T, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_quaternion<T> slerp(const basic_quaternion<T>& quaternion1
                                       , const basic_quaternion<T>& quaternion2
                                       , S                          amount) noexcept
@@ -236,13 +701,13 @@ namespace scener::math::quat
             flip     = true;
         }
 
-        auto theta    = std::acos(cosTheta);
-        auto sinTheta = std::sin(theta);
+        auto theta    = math::acos(cosTheta);
+        auto sinTheta = math::sin(theta);
 
         if (sinTheta > T(0.005))
         {
-            w1 = std::sin((T(1) - amount) * theta) / sinTheta;
-            w2 = std::sin(amount * theta) / sinTheta;
+            w1 = math::sin((T(1) - amount) * theta) / sinTheta;
+            w2 = math::sin(amount * theta) / sinTheta;
         }
         else
         {
@@ -258,6 +723,644 @@ namespace scener::math::quat
 
         return (quaternion1 * w1 + quaternion2 * w2);
     }
+
+    /// Creates the shortest arc rotation that takes a direction onto another.
+    /// \param from the initial direction, of non zero length.
+    /// \param to the final direction, of non zero length.
+    /// \returns the unit quaternion rotating from onto to; for opposite directions, half a turn about an axis
+    ///          orthogonal to from.
+    template <typename T = float>
+    inline basic_quaternion<T> create_from_to(const basic_vector3<T>& from, const basic_vector3<T>& to) noexcept
+    {
+        // (from x to, |from| |to| + from . to) is (sin(a/2) axis, cos(a/2)) scaled by 2 |from| |to| cos(a/2)
+        auto axis  = vector::cross(from, to);
+        T    scale = std::sqrt(vector::length_squared(from) * vector::length_squared(to));
+        T    w     = scale + vector::dot(from, to);
+
+        if (w <= scale * 16 * std::numeric_limits<T>::epsilon())
+        {
+            axis = (std::abs(from.x) > std::abs(from.z)) ? basic_vector3<T> { -from.y, from.x, T(0) }
+                                                          : basic_vector3<T> { T(0), -from.z, from.y };
+            w    = T(0);
+        }
+
+        return normalize(basic_quaternion<T> { axis.x, axis.y, axis.z, w });
+    }
+
+    /// Splits a rotation into a twist about the given axis followed by a swing, which moves the axis.
+    /// \param rotation the unit quaternion to split.
+    /// \param axis the unit twist axis.
+    /// \returns the swing and the twist, in this order, rotation being swing * twist. When the rotation turns the axis
+    ///          half a turn the twist is undefined and the identity is returned for it.
+    template <typename T = float>
+    inline std::pair<basic_quaternion<T>, basic_quaternion<T>> swing_twist(const basic_quaternion<T>& rotation
+                                                                         , const basic_vector3<T>&    axis) noexcept
+    {
+        // The twist is the rotation projected onto the axis (Dobrowolski, "Swing-twist decomposition in Clifford
+        // algebra").
+        T d     = rotation.x * axis.x + rotation.y * axis.y + rotation.z * axis.z;
+        T n2    = d * d + rotation.w * rotation.w;
+        T tiny  = std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon();
+        T scale = (n2 > tiny) ? T(1) / std::sqrt(n2) : T(0);
+
+        auto twist = basic_quaternion<T> { d * scale * axis.x
+                                         , d * scale * axis.y
+                                         , d * scale * axis.z
+                                         , (n2 > tiny) ? rotation.w * scale : T(1) };
+
+        return { rotation * conjugate(twist), twist };
+    }
+
+    /// Limits the twist of a rotation about the given axis, keeping its swing.
+    /// \param rotation the unit quaternion to limit.
+    /// \param axis the unit twist axis.
+    /// \param lower the lower twist limit, in [-pi, pi].
+    /// \param upper the upper twist limit, in [lower, pi].
+    /// \returns the rotation with its twist angle clamped to [lower, upper].
+    template <typename T = float>
+    inline basic_quaternion<T> clamp_twist(const basic_quaternion<T>& rotation
+                                         , const basic_vector3<T>&    axis
+                                         , const basic_radians<T>&    lower
+                                         , const basic_radians<T>&    upper) noexcept
+    {
+        auto [swing, twist] = swing_twist(rotation, axis);
+
+        // q and -q are the same rotation, the one with w >= 0 has its angle in [-pi, pi]
+        T sign  = (twist.w < T(0)) ? T(-1) : T(1);
+        T angle = 2 * std::atan2(sign * (twist.x * axis.x + twist.y * axis.y + twist.z * axis.z), sign * twist.w);
+
+        return swing * create_from_axis_angle(axis, basic_radians<T> { std::clamp(angle, lower.value, upper.value) });
+    }
+
+    /// Limits a rotation to a hinge: the swing is dropped and the angle about the hinge axis clamped.
+    /// \param rotation the unit quaternion to limit.
+    /// \param axis the unit hinge axis.
+    /// \param lower the lower angle limit, in [-pi, pi].
+    /// \param upper the upper angle limit, in [lower, pi].
+    /// \returns the twist of the rotation about the axis, with its angle clamped to [lower, upper].
+    template <typename T = float>
+    inline basic_quaternion<T> clamp_hinge(const basic_quaternion<T>& rotation
+                                         , const basic_vector3<T>&    axis
+                                         , const basic_radians<T>&    lower
+                                         , const basic_radians<T>&    upper) noexcept
+    {
+        return clamp_twist(swing_twist(rotation, axis).second, axis, lower, upper);
+    }
+
+    /// Limits the swing of a rotation to a cone around the given axis, keeping its twist.
+    /// \param rotation the unit quaternion to limit.
+    /// \param axis the unit axis of the cone, which is also the twist axis.
+    /// \param limit the largest angle between the axis and the rotated axis, in [0, pi].
+    /// \returns the rotation with its swing clamped to the cone.
+    template <typename T = float>
+    inline basic_quaternion<T> clamp_cone(const basic_quaternion<T>& rotation
+                                        , const basic_vector3<T>&    axis
+                                        , const basic_radians<T>&    limit) noexcept
+    {
+        auto [swing, twist] = swing_twist(rotation, axis);
+
+        T sign = (swing.w < T(0)) ? T(-1) : T(1);
+        T s    = std::sqrt(swing.x * swing.x + swing.y * swing.y + swing.z * swing.z);
+
+        if (2 * std::atan2(s, sign * swing.w) > limit.value)
+        {
+            auto [sin_limit, cos_limit] = math::sincos(limit.value * T(0.5));
+            T    scale                  = sign * sin_limit / s;
+
+            swing = { swing.x * scale, swing.y * scale, swing.z * scale, cos_limit };
+        }
+
+        return swing * twist;
+    }
+
+    /// Calculates the exponential of a quaternion.
+    /// \param q the quaternion.
+    /// \returns e raised to q; for a pure quaternion (0, a v), with v of unit length, the rotation by 2a about v.
+    template <typename T = float>
+    inline basic_quaternion<T> exp(const basic_quaternion<T>& q) noexcept
+    {
+        // e^(w + v) = e^w (cos |v| + v / |v| sin |v|)
+        T angle = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+        T scale = std::exp(q.w);
+
+        auto [sin, cos] = math::sincos(angle);
+
+        T s = (angle > std::numeric_limits<T>::epsilon()) ? scale * sin / angle : scale;
+
+        return { q.x * s, q.y * s, q.z * s, scale * cos };
+    }
+
+    /// Calculates the natural logarithm of a quaternion.
+    /// \param q the quaternion, of non zero length.
+    /// \returns the logarithm of q; for the rotation by 2a about the unit axis v, the pure quaternion (0, a v).
+    template <typename T = float>
+    inline basic_quaternion<T> log(const basic_quaternion<T>& q) noexcept
+    {
+        // ln(w + v) = ln |q| + v / |v| atan2(|v|, w)
+        T length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+        T norm   = std::sqrt(length * length + q.w * q.w);
+        T s      = (length > std::numeric_limits<T>::epsilon()) ? std::atan2(length, q.w) / length : T(1) / norm;
+
+        return { q.x * s, q.y * s, q.z * s, std::log(norm) };
+    }
+
+    /// Raises a unit quaternion to the given power, scaling the angle of its rotation.
+    /// \param q the unit quaternion.
+    /// \param exponent the exponent.
+    /// \returns the rotation about the axis of q by exponent times its angle.
+    template <typename T = float>
+    inline basic_quaternion<T> pow(const basic_quaternion<T>& q, T exponent) noexcept
+    {
+        return exp(log(q) * exponent);
+    }
+
+    /// Calculates the inner control point of a key for SQUAD interpolation.
+    /// \param previous the previous key, or current for the first one.
+    /// \param current the key.
+    /// \param next the next key, or current for the last one.
+    /// \returns the control point of current, q exp(-(log(q^-1 next) + log(q^-1 previous)) / 4).
+    template <typename T = float>
+    inline basic_quaternion<T> squad_control_point(const basic_quaternion<T>& previous
+                                                 , const basic_quaternion<T>& current
+                                                 , const basic_quaternion<T>& next) noexcept
+    {
+        // The neighbours are taken on the side of current, so the logarithms measure the short way round
+        auto inverse = conjugate(current);
+        auto p       = log(inverse * ((dot(current, previous) < T(0)) ? -previous : previous));
+        auto n       = log(inverse * ((dot(current, next) < T(0)) ? -next : next));
+
+        return current * exp((p + n) * T(-0.25));
+    }
+
+    /// Interpolates between two keys with spherical quadrangle interpolation (SQUAD), which is C1 continuous across
+    /// keys when the control points come from squad_control_point.
+    /// \param quaternion1 the first key.
+    /// \param quaternion2 the second key.
+    /// \param control1 the control point of the first key.
+    /// \param control2 the control point of the second key.
+    /// \param amount value indicating how far to interpolate between the keys, in [0, 1].
+    /// \returns the result of the interpolation.
+    template <typename T = float>
+    inline basic_quaternion<T> squad(const basic_quaternion<T>& quaternion1
+                                   , const basic_quaternion<T>& quaternion2
+                                   , const basic_quaternion<T>& control1
+                                   , const basic_quaternion<T>& control2
+                                   , T                          amount) noexcept
+    {
+        return slerp(slerp(quaternion1, quaternion2, amount)
+                   , slerp(control1, control2, amount)
+                   , T(2) * amount * (T(1) - amount));
+    }
+
+    /// Calculates the Bezier control points of a key, taking the tangent of a Catmull-Rom spline through the keys.
+    /// \param previous the previous key, or current for the first one.
+    /// \param current the key.
+    /// \param next the next key, or current for the last one.
+    /// \returns the incoming and the outgoing control points of current, in this order.
+    template <typename T = float>
+    inline std::pair<basic_quaternion<T>, basic_quaternion<T>> bezier_control_points(const basic_quaternion<T>& previous
+                                                                                   , const basic_quaternion<T>& current
+                                                                                   , const basic_quaternion<T>& next)
+        noexcept
+    {
+        // The tangent (log(q^-1 next) - log(q^-1 previous)) / 2 in the tangent space of current, a third of it to each
+        // side as for cubic Bezier curves
+        auto inverse = conjugate(current);
+        auto p       = log(inverse * ((dot(current, previous) < T(0)) ? -previous : previous));
+        auto n       = log(inverse * ((dot(current, next) < T(0)) ? -next : next));
+        auto tangent = (n - p) * (T(1) / T(6));
+
+        return { current * exp(-tangent), current * exp(tangent) };
+    }
+
+    /// Interpolates along a cubic Bezier curve of quaternions, evaluated with De Casteljau's algorithm over slerp.
+    /// \param quaternion1 the first key.
+    /// \param control1 the outgoing control point of the first key.
+    /// \param control2 the incoming control point of the second key.
+    /// \param quaternion2 the second key.
+    /// \param amount value indicating how far to interpolate between the keys, in [0, 1].
+    /// \returns the result of the interpolation.
+    template <typename T = float>
+    inline basic_quaternion<T> bezier(const basic_quaternion<T>& quaternion1
+                                    , const basic_quaternion<T>& control1
+                                    , const basic_quaternion<T>& control2
+                                    , const basic_quaternion<T>& quaternion2
+                                    , T                          amount) noexcept
+    {
+        auto a = slerp(quaternion1, control1, amount);
+        auto b = slerp(control1, control2, amount);
+        auto c = slerp(control2, quaternion2, amount);
+
+        return slerp(slerp(a, b, amount), slerp(b, c, amount), amount);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // BATCH OPERATIONS
+
+    /// Creates quaternions from sets of Euler angles, as create_from_euler(angles[i], order), evaluating the sines and
+    /// cosines with fast::sincos.
+    /// \param angles the sets of angles, in radians.
+    /// \param order the sequence of axes the angles rotate about.
+    /// \param result the quaternions, of the same size as angles.
+    inline void create_from_euler(gsl::span<const basic_vector3<float>> angles
+                                , euler_order                           order
+                                , gsl::span<basic_quaternion<float>>    result) noexcept
+    {
+        Expects(angles.size() == result.size());
+
+        using lanes = fast::detail::lanes;
+
+        auto axes = detail::axes_of(order);
+        auto half = lanes { 0.5f };
+
+        auto kernel = [&](const basic_vector3<float>* source, basic_quaternion<float>* destination)
+        {
+            lanes a, b, c, si, ci, sj, cj, sh, ch;
+            lanes q[4];
+
+            detail::deinterleave(source, a, b, c);
+
+            fast::detail::sincos<fast::precision::high>(a * half, si, ci);
+            fast::detail::sincos<fast::precision::high>(b * half, sj, cj);
+            fast::detail::sincos<fast::precision::high>(c * half, sh, ch);
+
+            detail::euler_to_quaternion(axes, si, ci, sj, cj, sh, ch, q);
+            detail::interleave(q[0], q[1], q[2], q[3], destination);
+        };
+
+        auto        count = static_cast<std::size_t>(angles.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(angles.data() + i, result.data() + i);
+        }
+
+        if (i < count)
+        {
+            // The remainder goes through the same kernel, so every element is computed the same way
+            basic_vector3<float>    source[lanes::size()] = { };
+            basic_quaternion<float> destination[lanes::size()];
+
+            std::copy(angles.data() + i, angles.data() + count, source);
+            kernel(source, destination);
+            std::copy(destination, destination + (count - i), result.data() + i);
+        }
+    }
+
+    /// Gets the Euler angles of the rotations of quaternions, as to_euler(source[i], order), evaluating the arc
+    /// tangents with fast::atan2.
+    /// \param source the quaternions.
+    /// \param order the sequence of axes of the result.
+    /// \param angles the sets of angles, in radians, of the same size as source.
+    inline void to_euler(gsl::span<const basic_quaternion<float>> source
+                       , euler_order                              order
+                       , gsl::span<basic_vector3<float>>          angles) noexcept
+    {
+        Expects(source.size() == angles.size());
+
+        using lanes = fast::detail::lanes;
+
+        auto axes = detail::axes_of(order);
+
+        auto kernel = [&](const basic_quaternion<float>* quaternions, basic_vector3<float>* destination)
+        {
+            lanes x, y, z, w, a, b, c;
+            lanes m[3][3];
+
+            detail::deinterleave(quaternions, x, y, z, w);
+            detail::quaternion_to_rotation(x, y, z, w, m);
+            detail::euler_from_rotation(axes, m, a, b, c);
+            detail::interleave(a, b, c, destination);
+        };
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(source.data() + i, angles.data() + i);
+        }
+
+        if (i < count)
+        {
+            // Padded with identities, so the unused lanes stay finite
+            basic_quaternion<float> quaternions[lanes::size()];
+            basic_vector3<float>    destination[lanes::size()];
+
+            std::fill(std::begin(quaternions), std::end(quaternions), basic_quaternion<float>::identity());
+            std::copy(source.data() + i, source.data() + count, quaternions);
+            kernel(quaternions, destination);
+            std::copy(destination, destination + (count - i), angles.data() + i);
+        }
+    }
+
+    /// Creates the shortest arc rotations that take directions onto others, as create_from_to(from[i], to[i]).
+    /// \param from the initial directions, of non zero length.
+    /// \param to the final directions, of non zero length, of the same size as from.
+    /// \param result the unit quaternions, of the same size as from.
+    inline void create_from_to(gsl::span<const basic_vector3<float>> from
+                             , gsl::span<const basic_vector3<float>> to
+                             , gsl::span<basic_quaternion<float>>    result) noexcept
+    {
+        Expects(from.size() == to.size() && from.size() == result.size());
+
+        using lanes = fast::detail::lanes;
+
+        auto kernel = [](const basic_vector3<float>* a, const basic_vector3<float>* b, basic_quaternion<float>* q)
+        {
+            lanes ax, ay, az, bx, by, bz;
+
+            detail::deinterleave(a, ax, ay, az);
+            detail::deinterleave(b, bx, by, bz);
+
+            auto zero     = lanes { 0.0f };
+            auto scale    = sqrt((ax * ax + ay * ay + az * az) * (bx * bx + by * by + bz * bz));
+            auto w        = scale + ax * bx + ay * by + az * bz;
+            auto opposite = w <= scale * lanes { 16 * std::numeric_limits<float>::epsilon() };
+            auto use_x    = abs(ax) > abs(az);
+            auto x        = select(opposite, select(use_x, -ay, zero), ay * bz - az * by);
+            auto y        = select(opposite, select(use_x, ax, -az), az * bx - ax * bz);
+            auto z        = select(opposite, select(use_x, zero, ay), ax * by - ay * bx);
+
+            w = select(opposite, zero, w);
+
+            auto length = sqrt(x * x + y * y + z * z + w * w);
+
+            detail::interleave(x / length, y / length, z / length, w / length, q);
+        };
+
+        auto        count = static_cast<std::size_t>(from.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(from.data() + i, to.data() + i, result.data() + i);
+        }
+
+        if (i < count)
+        {
+            // Padded with unit vectors, so the unused lanes stay finite
+            basic_vector3<float>    a[lanes::size()];
+            basic_vector3<float>    b[lanes::size()];
+            basic_quaternion<float> q[lanes::size()];
+
+            std::fill(std::begin(a), std::end(a), basic_vector3<float>::unit_x());
+            std::fill(std::begin(b), std::end(b), basic_vector3<float>::unit_x());
+            std::copy(from.data() + i, from.data() + count, a);
+            std::copy(to.data() + i, to.data() + count, b);
+            kernel(a, b, q);
+            std::copy(q, q + (count - i), result.data() + i);
+        }
+    }
+
+    /// Splits rotations into twists about the given axis followed by swings, as swing_twist(rotations[i], axis).
+    /// \param rotations the unit quaternions to split.
+    /// \param axis the unit twist axis.
+    /// \param swing the swings, of the same size as rotations.
+    /// \param twist the twists, of the same size as rotations.
+    inline void swing_twist(gsl::span<const basic_quaternion<float>> rotations
+                          , const basic_vector3<float>&              axis
+                          , gsl::span<basic_quaternion<float>>       swing
+                          , gsl::span<basic_quaternion<float>>       twist) noexcept
+    {
+        Expects(rotations.size() == swing.size() && rotations.size() == twist.size());
+
+        using lanes = fast::detail::lanes;
+
+        lanes a[3] = { lanes { axis.x }, lanes { axis.y }, lanes { axis.z } };
+
+        auto kernel = [&](const basic_quaternion<float>* source, basic_quaternion<float>* s, basic_quaternion<float>* t)
+        {
+            lanes q[4];
+            lanes sw[4];
+            lanes tw[4];
+
+            detail::deinterleave(source, q[0], q[1], q[2], q[3]);
+            detail::swing_twist(q, a, sw, tw);
+            detail::interleave(sw[0], sw[1], sw[2], sw[3], s);
+            detail::interleave(tw[0], tw[1], tw[2], tw[3], t);
+        };
+
+        auto        count = static_cast<std::size_t>(rotations.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            kernel(rotations.data() + i, swing.data() + i, twist.data() + i);
+        }
+
+        if (i < count)
+        {
+            basic_quaternion<float> source[lanes::size()];
+            basic_quaternion<float> s[lanes::size()];
+            basic_quaternion<float> t[lanes::size()];
+
+            std::fill(std::begin(source), std::end(source), basic_quaternion<float>::identity());
+            std::copy(rotations.data() + i, rotations.data() + count, source);
+            kernel(source, s, t);
+            std::copy(s, s + (count - i), swing.data() + i);
+            std::copy(t, t + (count - i), twist.data() + i);
+        }
+    }
+
+    /// Limits the twists of rotations about the given axis, as clamp_twist(rotations[i], axis, lower, upper).
+    /// \param rotations the unit quaternions to limit.
+    /// \param axis the unit twist axis.
+    /// \param lower the lower twist limit, in [-pi, pi].
+    /// \param upper the upper twist limit, in [lower, pi].
+    /// \param result the limited rotations, of the same size as rotations; may be rotations itself.
+    inline void clamp_twist(gsl::span<const basic_quaternion<float>> rotations
+                          , const basic_vector3<float>&              axis
+                          , const basic_radians<float>&              lower
+                          , const basic_radians<float>&              upper
+                          , gsl::span<basic_quaternion<float>>       result) noexcept
+    {
+        using lanes = fast::detail::lanes;
+
+        lanes a[3] = { lanes { axis.x }, lanes { axis.y }, lanes { axis.z } };
+        auto  l    = lanes { lower.value * 0.5f };
+        auto  u    = lanes { upper.value * 0.5f };
+
+        detail::for_each_quaternion<lanes>(rotations, result, [&](lanes (&q)[4])
+        {
+            lanes s[4];
+            lanes t[4];
+
+            detail::swing_twist(q, a, s, t);
+            detail::clamp_twist(t, a, l, u);
+            detail::quaternion_multiply(s, t, q);
+        });
+    }
+
+    /// Limits rotations to a hinge, as clamp_hinge(rotations[i], axis, lower, upper).
+    /// \param rotations the unit quaternions to limit.
+    /// \param axis the unit hinge axis.
+    /// \param lower the lower angle limit, in [-pi, pi].
+    /// \param upper the upper angle limit, in [lower, pi].
+    /// \param result the limited rotations, of the same size as rotations; may be rotations itself.
+    inline void clamp_hinge(gsl::span<const basic_quaternion<float>> rotations
+                          , const basic_vector3<float>&              axis
+                          , const basic_radians<float>&              lower
+                          , const basic_radians<float>&              upper
+                          , gsl::span<basic_quaternion<float>>       result) noexcept
+    {
+        using lanes = fast::detail::lanes;
+
+        lanes a[3] = { lanes { axis.x }, lanes { axis.y }, lanes { axis.z } };
+        auto  l    = lanes { lower.value * 0.5f };
+        auto  u    = lanes { upper.value * 0.5f };
+
+        detail::for_each_quaternion<lanes>(rotations, result, [&](lanes (&q)[4])
+        {
+            lanes s[4];
+            lanes t[4];
+
+            detail::swing_twist(q, a, s, t);
+            detail::clamp_twist(t, a, l, u);
+
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                q[k] = t[k];
+            }
+        });
+    }
+
+    /// Limits the swings of rotations to a cone around the given axis, as clamp_cone(rotations[i], axis, limit).
+    /// \param rotations the unit quaternions to limit.
+    /// \param axis the unit axis of the cone, which is also the twist axis.
+    /// \param limit the largest angle between the axis and the rotated axis, in [0, pi].
+    /// \param result the limited rotations, of the same size as rotations; may be rotations itself.
+    inline void clamp_cone(gsl::span<const basic_quaternion<float>> rotations
+                         , const basic_vector3<float>&              axis
+                         , const basic_radians<float>&              limit
+                         , gsl::span<basic_quaternion<float>>       result) noexcept
+    {
+        using lanes = fast::detail::lanes;
+
+        auto [sin_limit, cos_limit] = math::sincos(limit.value * 0.5f);
+
+        lanes a[3] = { lanes { axis.x }, lanes { axis.y }, lanes { axis.z } };
+        auto  h    = lanes { limit.value * 0.5f };
+        auto  s    = lanes { sin_limit };
+        auto  c    = lanes { cos_limit };
+
+        detail::for_each_quaternion<lanes>(rotations, result, [&](lanes (&q)[4])
+        {
+            lanes sw[4];
+            lanes tw[4];
+
+            detail::swing_twist(q, a, sw, tw);
+            detail::clamp_cone(sw, h, s, c);
+            detail::quaternion_multiply(sw, tw, q);
+        });
+    }
+
+    /// Calculates the SQUAD control points of a sequence of keys, as squad_control_point(keys[i - 1], keys[i],
+    /// keys[i + 1]); the first and the last keys stand in for their missing neighbours.
+    /// \param keys the keys.
+    /// \param control_points the control points, of the same size as keys.
+    inline void squad_control_points(gsl::span<const basic_quaternion<float>> keys
+                                   , gsl::span<basic_quaternion<float>>       control_points) noexcept
+    {
+        Expects(keys.size() == control_points.size());
+
+        auto count = static_cast<std::size_t>(keys.size());
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            control_points[i] = squad_control_point(keys[(i > 0) ? i - 1 : i]
+                                                  , keys[i]
+                                                  , keys[std::min(i + 1, count - 1)]);
+        }
+    }
+
+    /// Calculates the Bezier control points of a sequence of keys, as bezier_control_points(keys[i - 1], keys[i],
+    /// keys[i + 1]); the first and the last keys stand in for their missing neighbours.
+    /// \param keys the keys.
+    /// \param incoming the incoming control points, of the same size as keys.
+    /// \param outgoing the outgoing control points, of the same size as keys.
+    inline void bezier_control_points(gsl::span<const basic_quaternion<float>> keys
+                                    , gsl::span<basic_quaternion<float>>       incoming
+                                    , gsl::span<basic_quaternion<float>>       outgoing) noexcept
+    {
+        Expects(keys.size() == incoming.size() && keys.size() == outgoing.size());
+
+        auto count = static_cast<std::size_t>(keys.size());
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::tie(incoming[i], outgoing[i]) = bezier_control_points(keys[(i > 0) ? i - 1 : i]
+                                                                     , keys[i]
+                                                                     , keys[std::min(i + 1, count - 1)]);
+        }
+    }
+
+    /// Evaluates a SQUAD spline at the given times.
+    /// \param keys the keys, at least one.
+    /// \param control_points the control points of the keys, as given by squad_control_points.
+    /// \param key_times the increasing times of the keys, of the same size as keys.
+    /// \param times the times to evaluate, clamped to the times of the keys; fastest when increasing.
+    /// \param result the interpolated rotations, of the same size as times.
+    inline void squad(gsl::span<const basic_quaternion<float>> keys
+                    , gsl::span<const basic_quaternion<float>> control_points
+                    , gsl::span<const float>                   key_times
+                    , gsl::span<const float>                   times
+                    , gsl::span<basic_quaternion<float>>       result) noexcept
+    {
+        Expects(!keys.empty() && keys.size() == control_points.size() && keys.size() == key_times.size());
+        Expects(times.size() == result.size());
+
+        if (keys.size() == 1)
+        {
+            std::fill(result.begin(), result.end(), keys[0]);
+            return;
+        }
+
+        std::size_t segment = 0;
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(times.size()); ++i)
+        {
+            auto amount = detail::locate(key_times, times[i], segment);
+
+            result[i] = squad(keys[segment], keys[segment + 1]
+                            , control_points[segment], control_points[segment + 1]
+                            , amount);
+        }
+    }
+
+    /// Evaluates a cubic Bezier spline at the given times.
+    /// \param keys the keys, at least one.
+    /// \param incoming the incoming control points of the keys, as given by bezier_control_points.
+    /// \param outgoing the outgoing control points of the keys, as given by bezier_control_points.
+    /// \param key_times the increasing times of the keys, of the same size as keys.
+    /// \param times the times to evaluate, clamped to the times of the keys; fastest when increasing.
+    /// \param result the interpolated rotations, of the same size as times.
+    inline void bezier(gsl::span<const basic_quaternion<float>> keys
+                     , gsl::span<const basic_quaternion<float>> incoming
+                     , gsl::span<const basic_quaternion<float>> outgoing
+                     , gsl::span<const float>                   key_times
+                     , gsl::span<const float>                   times
+                     , gsl::span<basic_quaternion<float>>       result) noexcept
+    {
+        Expects(!keys.empty() && keys.size() == incoming.size() && keys.size() == outgoing.size());
+        Expects(keys.size() == key_times.size() && times.size() == result.size());
+
+        if (keys.size() == 1)
+        {
+            std::fill(result.begin(), result.end(), keys[0]);
+            return;
+        }
+
+        std::size_t segment = 0;
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(times.size()); ++i)
+        {
+            auto amount = detail::locate(key_times, times[i], segment);
+
+            result[i] = bezier(keys[segment], outgoing[segment], incoming[segment + 1], keys[segment + 1], amount);
+        }
+    }
 }
 
 #endif // SCENER_MATH_BASIC_QUATERNION_OPERATIONS_HPP
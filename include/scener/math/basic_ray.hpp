@@ -12,7 +12,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Defines a ray.
-    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_ray
     {
     public:
@@ -4,6 +4,8 @@
 #ifndef SCENER_MATH_BASIC_RAY_OPERATIONS_HPP
 #define SCENER_MATH_BASIC_RAY_OPERATIONS_HPP
 
+#include <optional>
+
 #include "scener/math/basic_ray.hpp"
 
 #include "scener/math/bounding_frustrum.hpp"
@@ -14,8 +16,16 @@
 
 namespace scener::math
 {
+    // -----------------------------------------------------------------------------------------------------------------
+    // INTERSECTION DISTANCE
+
+    /// Checks whether the given ray intersects a basic_bounding_box and returns the distance at which it does.
+    /// \param ray_ the ray.
+    /// \param box_ the basic_bounding_box to check for intersection with.
+    /// \returns distance at which the ray enters the box, 0 if the ray starts inside it, or an empty value
+    ///          if there is no intersection.
     template <typename T>
-    constexpr bool intersects(const basic_ray<T>& ray_, const basic_bounding_box<T>& box_) noexcept
+    constexpr std::optional<T> intersection_distance(const basic_ray<T>& ray_, const basic_bounding_box<T>& box_) noexcept
     {
         // Reference: http://www.gamedev.net/page/resources/_/technical/math-and-physics/intersection-math-algorithms-learn-to-derive-r3033
         auto tmin = (box_.min - ray_.position) / ray_.direction;
@@ -27,60 +37,185 @@ namespace scener::math
         auto enter = std::max(std::max(tnear.x, T(0)), std::max(tnear.y, tnear.z));
         auto exit  = std::min(tfar.x, std::min(tfar.y, tfar.z));
 
-        return (enter - exit);
-    }
+        if (enter > exit)
+        {
+            return std::nullopt;
+        }
 
-    //template <typename T>
-    //bool intersects(const BoundingFrustum& frustum) noexcept
-    //{
-    //    throw std::runtime_error("Not implemented");
-    //}
+        return enter;
+    }
 
+    /// Checks whether the given ray intersects a basic_bounding_sphere and returns the distance at which it does.
+    /// \param ray_ the ray, its direction must be a unit vector.
+    /// \param sphere the basic_bounding_sphere to check for intersection with.
+    /// \returns distance at which the ray enters the sphere, 0 if the ray starts inside it, or an empty value
+    ///          if there is no intersection.
     template <typename T>
-    constexpr bool intersects(const basic_ray<T>& ray_, const basic_bounding_sphere<T>& sphere) noexcept
+    constexpr std::optional<T> intersection_distance(const basic_ray<T>& ray_, const basic_bounding_sphere<T>& sphere) noexcept
     {
         // Reference: http://www.gamedev.net/page/resources/_/technical/math-and-physics/intersection-math-algorithms-learn-to-derive-r3033
-        auto rad2 = sphere.radius * sphere.radius;
+        auto rad2 = T(sphere.radius * sphere.radius);
         auto l    = sphere.center - ray_.position;
-        auto tPX  = vector::dot(l, ray_.direction);
+        auto lsq  = vector::dot(l, l);
+
+        if (lsq <= rad2)
+        {
+            return T(0);
+        }
+
+        auto tPX = vector::dot(l, ray_.direction);
 
         if (tPX < T(0))
         {
-            return false;
+            return std::nullopt;
         }
 
-        auto dsq = vector::dot(l, l) - tPX * tPX;
+        auto dsq = lsq - tPX * tPX;
 
         if (dsq > rad2)
         {
-            return false;
+            return std::nullopt;
         }
 
-        auto thit = std::sqrt(rad2 - dsq);
-        auto t    = tPX - thit;
+        return tPX - math::sqrt(rad2 - dsq);
+    }
+
+    /// Checks whether the given ray intersects a basic_plane and returns the distance at which it does.
+    /// \param ray_ the ray.
+    /// \param plane the basic_plane to check for intersection with.
+    /// \returns distance at which the ray hits the plane, or an empty value if the ray is parallel to the plane
+    ///          or points away from it.
+    template <typename T>
+    constexpr std::optional<T> intersection_distance(const basic_ray<T>& ray_, const basic_plane<T>& plane) noexcept
+    {
+        // Reference: http://www.gamedev.net/page/resources/_/technical/math-and-physics/intersection-math-algorithms-learn-to-derive-r3033
+        auto denom = vector::dot(plane.normal, ray_.direction);
+
+        if (denom == T(0)) // ray and plane are parallel so there is no intersection
+        {
+            return std::nullopt;
+        }
+
+        auto t = -(vector::dot(ray_.position, plane.normal) + plane.d) / denom;
 
         if (t < T(0))
         {
-            t = tPX + thit;
+            return std::nullopt;
         }
 
-        return (t < T(0));
+        return t;
     }
 
+    /// Checks whether the given ray intersects a basic_bounding_frustrum and returns the distance at which it does.
+    /// \param ray_ the ray.
+    /// \param frustrum the basic_bounding_frustrum to check for intersection with.
+    /// \returns distance at which the ray enters the frustrum, 0 if the ray starts inside it, or an empty value
+    ///          if there is no intersection.
     template <typename T>
-    constexpr bool intersects(const basic_ray<T>& ray_, const basic_plane<T>& plane) noexcept
+    std::optional<T> intersection_distance(const basic_ray<T>& ray_, const basic_bounding_frustrum<T>& frustrum) noexcept
     {
-        // Reference: http://www.gamedev.net/page/resources/_/technical/math-and-physics/intersection-math-algorithms-learn-to-derive-r3033
-        auto denom = vector::dot(plane.normal, ray_.direction);
+        // The frustrum planes point inwards, so the ray is clipped against each of them keeping
+        // the parametric interval [enter, exit] where it lies on the inner side of all the planes.
+        T enter = T(0);
+        T exit  = max_value<T>;
+
+        for (const auto& p : frustrum.planes())
+        {
+            auto distance = vector::dot(p.normal, ray_.position) + p.d;
+            auto denom    = vector::dot(p.normal, ray_.direction);
+
+            if (denom == T(0))
+            {
+                // parallel to the plane, either fully inside or fully outside of it
+                if (distance < T(0))
+                {
+                    return std::nullopt;
+                }
+                continue;
+            }
+
+            auto t = -distance / denom;
+
+            if (denom > T(0))
+            {
+                enter = std::max(enter, t);
+            }
+            else
+            {
+                exit = std::min(exit, t);
+            }
+
+            if (enter > exit)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return enter;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // INTERSECTION TESTS
 
-        if (std::abs(denom) == T(0)) // ray and plane are parallel so there is no intersection
+    /// Checks whether the given ray intersects a basic_bounding_box.
+    /// \param ray_ the ray.
+    /// \param box_ the basic_bounding_box to check for intersection with.
+    /// \returns true if the ray intersects the box; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_ray<T>& ray_, const basic_bounding_box<T>& box_) noexcept
+    {
+        return intersection_distance(ray_, box_).has_value();
+    }
+
+    /// Checks whether the given ray intersects a basic_bounding_frustrum.
+    /// \param ray_ the ray.
+    /// \param frustrum the basic_bounding_frustrum to check for intersection with.
+    /// \returns true if the ray intersects the frustrum; false otherwise.
+    template <typename T>
+    bool intersects(const basic_ray<T>& ray_, const basic_bounding_frustrum<T>& frustrum) noexcept
+    {
+        return intersection_distance(ray_, frustrum).has_value();
+    }
+
+    /// Checks whether the given ray intersects a basic_bounding_sphere.
+    /// \param ray_ the ray, its direction must be a unit vector.
+    /// \param sphere the basic_bounding_sphere to check for intersection with.
+    /// \returns true if the ray intersects the sphere; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_ray<T>& ray_, const basic_bounding_sphere<T>& sphere) noexcept
+    {
+        // Same as intersection_distance but without solving for the hit point, so no square root is needed.
+        auto rad2 = T(sphere.radius * sphere.radius);
+        auto l    = sphere.center - ray_.position;
+        auto lsq  = vector::dot(l, l);
+
+        if (lsq <= rad2)
+        {
+            return true;
+        }
+
+        auto tPX = vector::dot(l, ray_.direction);
+
+        if (tPX < T(0))
         {
             return false;
         }
 
-        auto t = -(vector::dot(ray_.position, plane.normal) + plane.d) / denom;
+        return (lsq - tPX * tPX <= rad2);
+    }
+
+    /// Checks whether the given ray intersects a basic_plane.
+    /// \param ray_ the ray.
+    /// \param plane the basic_plane to check for intersection with.
+    /// \returns true if the ray intersects the plane; false otherwise.
+    template <typename T>
+    constexpr bool intersects(const basic_ray<T>& ray_, const basic_plane<T>& plane) noexcept
+    {
+        // t = -distance / denom is positive only when both terms have opposite signs, so there is no need to divide.
+        auto denom    = vector::dot(plane.normal, ray_.direction);
+        auto distance = vector::dot(ray_.position, plane.normal) + plane.d;
 
-        return (t > T(0));
+        return (denom != T(0) && distance * denom <= T(0));
     }
 }
 
@@ -0,0 +1,184 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_SHADOW_CASCADES_HPP
+#define SCENER_MATH_BASIC_SHADOW_CASCADES_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include <gsl/assert>
+
+#include "scener/math/basic_math.hpp"
+#include "scener/math/basic_matrix_operations.hpp"
+#include "scener/math/basic_vector_operations.hpp"
+#include "scener/math/basic_vector_transforms.hpp"
+#include "scener/math/bounding_frustrum.hpp"
+
+namespace scener::math::cascade
+{
+    /// Array holding the eight corners of a frustum, in the order returned by get_corners.
+    template <typename T>
+    using corner_array = std::array<basic_vector3<T>, basic_bounding_frustrum<T>::corner_count>;
+
+    /// Computes the split distances of a cascaded shadow map using the practical split scheme, which blends the
+    /// logarithmic and uniform split distributions.
+    ///
+    /// Reference: Zhang et al. "Parallel-Split Shadow Maps for Large-scale Virtual Environments"
+    /// \param near distance to the near plane of the camera.
+    /// \param far distance to the far plane of the camera.
+    /// \param lambda weight of the logarithmic distribution, 0 gives uniform splits and 1 logarithmic splits.
+    /// \returns the Count + 1 split distances, starting at the near distance and ending at the far distance.
+    template <std::size_t Count, typename T = float>
+    std::array<T, Count + 1> compute_splits(T near, T far, T lambda) noexcept
+    {
+        static_assert(Count > 0, "At least one cascade is required");
+
+        Expects(near > T(0) && near < far);
+        Expects(lambda >= T(0) && lambda <= T(1));
+
+        std::array<T, Count + 1> splits;
+
+        auto ratio = far / near;
+        auto range = far - near;
+
+        splits[0] = near;
+
+        for (std::size_t i = 1; i < Count; ++i)
+        {
+            auto fraction    = T(i) / T(Count);
+            auto logarithmic = near * std::pow(ratio, fraction);
+            auto uniform     = near + range * fraction;
+
+            splits[i] = lerp(uniform, logarithmic, lambda);
+        }
+
+        splits[Count] = far;
+
+        return splits;
+    }
+
+    /// Computes the corners of a slice of a frustum, given the corners of the whole frustum.
+    ///
+    /// View depth varies linearly along the frustum edges, so the slice corners are interpolated between the near and
+    /// far corners with no matrix inversion.
+    /// \param corners the corners of the frustum, as returned by get_corners.
+    /// \param near distance to the near plane of the frustum.
+    /// \param far distance to the far plane of the frustum.
+    /// \param split_near distance to the near plane of the slice.
+    /// \param split_far distance to the far plane of the slice.
+    /// \returns the corners of the slice.
+    template <typename T = float>
+    constexpr corner_array<T> split_corners(const corner_array<T>& corners, T near, T far, T split_near, T split_far) noexcept
+    {
+        corner_array<T> result;
+
+        auto inv_range = T(1) / (far - near);
+        auto t0        = (split_near - near) * inv_range;
+        auto t1        = (split_far  - near) * inv_range;
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            auto edge = corners[i + 4] - corners[i];
+
+            result[i]     = corners[i] + edge * t0;
+            result[i + 4] = corners[i] + edge * t1;
+        }
+
+        return result;
+    }
+
+    /// Creates the frustum bounding a slice of a perspective frustum.
+    ///
+    /// The depth range of the source projection is remapped in clip space, so the view and the shape of the
+    /// projection do not need to be known. The source frustum is expected to come from a right-handed perspective
+    /// projection, as built by matrix::create_perspective_field_of_view, with the given near and far distances.
+    /// \param frustrum the source frustum.
+    /// \param near distance to the near plane of the source frustum.
+    /// \param far distance to the far plane of the source frustum.
+    /// \param split_near distance to the near plane of the slice.
+    /// \param split_far distance to the far plane of the slice.
+    /// \returns the frustum of the slice.
+    template <typename T = float>
+    basic_bounding_frustrum<T> create_split_frustrum(const basic_bounding_frustrum<T>& frustrum
+                                                   , T                                 near
+                                                   , T                                 far
+                                                   , T                                 split_near
+                                                   , T                                 split_far) noexcept
+    {
+        Expects(near < far && split_near < split_far);
+
+        // Perspective depth is z' = a * z + b with w' = -z, in view space. Since z = -w' the remapped depth
+        // a' * z + b' equals (b' / b) * z' + (a * b' / b - a') * w', which only involves clip space values.
+        auto a       = far / (near - far);
+        auto b       = near * far / (near - far);
+        auto split_a = split_far / (split_near - split_far);
+        auto split_b = split_near * split_far / (split_near - split_far);
+
+        auto remap = basic_matrix4<T>::identity();
+
+        remap.m33 = split_b / b;
+        remap.m43 = a * split_b / b - split_a;
+
+        return { frustrum.matrix() * remap };
+    }
+
+    /// Creates an orthographic projection that bounds the given corners as seen from a directional light.
+    ///
+    /// The projection covers the bounding sphere of the corners, so its size, and with it the size of a shadow map
+    /// texel in world units, stays the same as the camera moves and turns. Its origin is snapped to whole texels, so
+    /// the texel grid stays fixed in light space and the shadow edges do not shimmer.
+    /// \param corners the corners of the volume to cover, usually the corners of a cascade.
+    /// \param light_view the view matrix of the light.
+    /// \param resolution the width and height in texels of the shadow map, at least two.
+    /// \param caster_distance extra distance towards the light included in the depth range, so occluders lying
+    ///                        outside of the volume still cast shadows into it.
+    /// \returns the orthographic projection matrix, to be combined with the light view matrix.
+    template <typename T = float>
+    basic_matrix4<T> create_light_projection(const corner_array<T>&  corners
+                                           , const basic_matrix4<T>& light_view
+                                           , std::uint32_t           resolution
+                                           , T                       caster_distance = T(0)) noexcept
+    {
+        Expects(resolution > 1);
+
+        auto center = corners[0];
+
+        for (std::size_t i = 1; i < corners.size(); ++i)
+        {
+            center += corners[i];
+        }
+
+        center /= T(corners.size());
+
+        auto radius = T(0);
+
+        for (const auto& corner : corners)
+        {
+            radius = std::max(radius, vector::distance(center, corner));
+        }
+
+        // Reference: https://docs.microsoft.com/en-us/windows/desktop/dxtecharts/common-techniques-to-improve-shadow-depth-maps
+        // Rounding the radius up keeps rounding noise in the corners from changing the size of the projection
+        radius = std::ceil(radius * T(16)) / T(16);
+
+        // Snapping moves the origin by less than a texel, the extent has one texel more than the sphere to cover it
+        auto texel  = (radius * T(2)) / T(resolution - 1);
+        auto extent = texel * T(resolution);
+        auto origin = vector::transform(center, light_view);
+        auto left   = std::floor((origin.x - radius) / texel) * texel;
+        auto bottom = std::floor((origin.y - radius) / texel) * texel;
+
+        // The light looks down its negative z axis
+        return matrix::create_orthographic_off_center(left
+                                                    , left + extent
+                                                    , bottom
+                                                    , bottom + extent
+                                                    , -(origin.z + radius) - caster_distance
+                                                    , -(origin.z - radius));
+    }
+}
+
+#endif // SCENER_MATH_BASIC_SHADOW_CASCADES_HPP
@@ -6,12 +6,14 @@
 
 #include <type_traits>
 
+#include "scener/math/type_traits.hpp"
+
 namespace scener::math 
 {
     // -----------------------------------------------------------------------------------------------------------------
     // TEMPLATES
 
-    template <typename T, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     class basic_size
     {
     public:
@@ -0,0 +1,483 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_SPATIAL_HASH_GRID_HPP
+#define SCENER_MATH_BASIC_SPATIAL_HASH_GRID_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gsl/assert>
+
+#include "scener/math/bounding_box.hpp"
+#include "scener/math/bounding_sphere.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Uniform grid broadphase over basic_bounding_box volumes, with cells stored in a hash table.
+    ///
+    /// Every object is linked into each of the cells its bounds overlap. Cell entries come from a single pool
+    /// shared by all the buckets, so inserting, moving or removing objects does not allocate once the pool has grown
+    /// to its working size. Moving an object only touches the cells it leaves and enters, and no work is done at all
+    /// while it stays within the same cells.
+    ///
+    /// Objects overlapping more than oversized_cell_count cells are not linked into cells, they are kept in a separate
+    /// list that is tested against every query and every other object instead. Cell coordinates are clamped to
+    /// [-2^30, 2^30], so bounds of any finite size are supported.
+    template <typename T, typename = typename std::enable_if_t<std::is_floating_point_v<T>>>
+    class basic_spatial_hash_grid final
+    {
+    public:
+        /// Identifies an object stored in the grid.
+        using handle_type = std::uint32_t;
+
+        /// Value used to represent an invalid object handle.
+        constexpr static handle_type invalid_handle = std::numeric_limits<handle_type>::max();
+
+        /// Largest number of cells an object is linked into, larger objects are kept in a separate list.
+        constexpr static std::uint64_t oversized_cell_count = 4096;
+
+    public:
+        /// Initializes a new instance of the basic_spatial_hash_grid class.
+        /// \param cell_size the edge length of the grid cells, usually the size of a typical object.
+        /// \param bucket_count the number of hash buckets, rounded up to the next power of two.
+        basic_spatial_hash_grid(T cell_size, std::uint32_t bucket_count = 4096)
+            : _inv_cell_size { T(1) / cell_size }
+            , _buckets       ( ceil_power_of_two(bucket_count), invalid_handle )
+            , _entries       { }
+            , _objects       { }
+            , _oversized     { }
+            , _free_entry    { invalid_handle }
+            , _free_object   { invalid_handle }
+            , _count         { 0 }
+        {
+            Expects(cell_size > T(0));
+        }
+
+    public:
+        /// Gets the number of objects stored in the grid.
+        /// \returns the number of objects stored in the grid.
+        std::size_t size() const noexcept
+        {
+            return _count;
+        }
+
+        /// Gets the bounds of the given object.
+        /// \param handle the object handle.
+        /// \returns the bounds of the given object.
+        const basic_bounding_box<T>& bounds(handle_type handle) const noexcept
+        {
+            Expects(is_alive(handle));
+
+            return _objects[handle].box;
+        }
+
+        /// Inserts a new object in the grid.
+        /// \param box the object bounds.
+        /// \returns the handle of the new object.
+        handle_type insert(const basic_bounding_box<T>& box)
+        {
+            Expects(is_finite(box));
+
+            handle_type handle = _free_object;
+
+            if (handle != invalid_handle)
+            {
+                _free_object = _objects[handle].next_free;
+                _objects[handle].box = box;
+            }
+            else
+            {
+                handle = static_cast<handle_type>(_objects.size());
+                _objects.push_back({ box, { }, invalid_handle, false });
+            }
+
+            auto& record = _objects[handle];
+
+            record.range     = cells_of(box);
+            record.next_free = invalid_handle;
+            record.alive     = true;
+
+            link(handle, record.range);
+
+            ++_count;
+
+            return handle;
+        }
+
+        /// Updates the bounds of an object, relinking it only when it moves into a different set of cells.
+        /// \param handle the object handle.
+        /// \param box the new object bounds.
+        void update(handle_type handle, const basic_bounding_box<T>& box)
+        {
+            Expects(is_alive(handle) && is_finite(box));
+
+            auto& record = _objects[handle];
+            auto  range  = cells_of(box);
+
+            record.box = box;
+
+            if (range.min == record.range.min && range.max == record.range.max)
+            {
+                return;
+            }
+
+            unlink(handle, record.range);
+            link(handle, range);
+
+            record.range = range;
+        }
+
+        /// Removes an object from the grid.
+        /// \param handle the object handle.
+        void remove(handle_type handle) noexcept
+        {
+            Expects(is_alive(handle));
+
+            auto& record = _objects[handle];
+
+            unlink(handle, record.range);
+
+            record.alive     = false;
+            record.next_free = _free_object;
+            _free_object     = handle;
+
+            --_count;
+        }
+
+        /// Removes all the objects from the grid, keeping the allocated storage.
+        void clear() noexcept
+        {
+            std::fill(_buckets.begin(), _buckets.end(), invalid_handle);
+
+            _entries.clear();
+            _objects.clear();
+            _oversized.clear();
+
+            _free_entry  = invalid_handle;
+            _free_object = invalid_handle;
+            _count       = 0;
+        }
+
+    public:
+        /// Invokes the given function once for every object whose bounds intersect the given box.
+        /// \param box the query volume.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(const basic_bounding_box<T>& box, Function&& fn) const
+        {
+            Expects(is_finite(box));
+
+            query_cells(box, [&] (const basic_bounding_box<T>& bounds) -> bool { return intersects(box, bounds); }, fn);
+        }
+
+        /// Invokes the given function once for every object whose bounds intersect the given sphere.
+        /// \param sphere the query volume.
+        /// \param fn function invoked with the handle of each object found.
+        template <typename Function>
+        void query(const basic_bounding_sphere<T>& sphere, Function&& fn) const
+        {
+            Expects(std::isfinite(sphere.center.x) && std::isfinite(sphere.center.y) && std::isfinite(sphere.center.z)
+                 && std::isfinite(sphere.radius));
+
+            auto extent = basic_vector3<T> { T(sphere.radius) };
+            auto box    = basic_bounding_box<T> { sphere.center - extent, sphere.center + extent };
+
+            query_cells(box, [&] (const basic_bounding_box<T>& bounds) -> bool { return intersects(bounds, sphere); }, fn);
+        }
+
+        /// Invokes the given function once for every pair of objects whose bounds intersect.
+        /// \param fn function invoked with the handles of both objects, the lowest handle first.
+        template <typename Function>
+        void for_each_pair(Function&& fn) const
+        {
+            for (auto head : _buckets)
+            {
+                for (auto i = head; i != invalid_handle; i = _entries[i].next)
+                {
+                    const auto& lhs = _entries[i];
+
+                    for (auto j = lhs.next; j != invalid_handle; j = _entries[j].next)
+                    {
+                        const auto& rhs = _entries[j];
+
+                        if (!(lhs.cell == rhs.cell))
+                        {
+                            continue;
+                        }
+
+                        const auto& a = _objects[lhs.object].box;
+                        const auto& b = _objects[rhs.object].box;
+
+                        // Objects sharing several cells are only reported from the cell holding the lowest corner of
+                        // their overlap, which both of them are guaranteed to be linked into.
+                        if (intersects(a, b) && cell_of(vector::max(a.min, b.min)) == lhs.cell)
+                        {
+                            fn(std::min(lhs.object, rhs.object), std::max(lhs.object, rhs.object));
+                        }
+                    }
+                }
+            }
+
+            for (auto lhs : _oversized)
+            {
+                const auto& a = _objects[lhs].box;
+
+                for (handle_type rhs = 0; rhs < _objects.size(); ++rhs)
+                {
+                    const auto& other = _objects[rhs];
+
+                    // Pairs of oversized objects are reported once, from the lowest handle
+                    if (!other.alive || rhs == lhs || (rhs < lhs && is_oversized(other.range)))
+                    {
+                        continue;
+                    }
+
+                    if (intersects(a, other.box))
+                    {
+                        fn(std::min(lhs, rhs), std::max(lhs, rhs));
+                    }
+                }
+            }
+        }
+
+    private:
+        using cell_type = basic_vector3<std::int32_t>;
+
+        struct cell_range
+        {
+            cell_type min;
+            cell_type max;
+        };
+
+        struct entry
+        {
+            cell_type     cell;
+            handle_type   object;
+            std::uint32_t next;
+        };
+
+        struct object_record
+        {
+            basic_bounding_box<T> box;
+            cell_range            range;
+            handle_type           next_free;
+            bool                  alive;
+        };
+
+    private:
+        static std::uint32_t ceil_power_of_two(std::uint32_t value) noexcept
+        {
+            std::uint32_t result = 1;
+
+            while (result < value)
+            {
+                result <<= 1;
+            }
+
+            return result;
+        }
+
+        static bool is_finite(const basic_bounding_box<T>& box) noexcept
+        {
+            return std::isfinite(box.min.x) && std::isfinite(box.min.y) && std::isfinite(box.min.z)
+                && std::isfinite(box.max.x) && std::isfinite(box.max.y) && std::isfinite(box.max.z);
+        }
+
+        static bool is_oversized(const cell_range& range) noexcept
+        {
+            // Every edge spans at most 2^31 + 1 cells, so the running count never overflows
+            std::uint64_t count = 1;
+
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                count *= std::uint64_t(std::int64_t(range.max[axis]) - range.min[axis] + 1);
+
+                if (count > oversized_cell_count)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool is_alive(handle_type handle) const noexcept
+        {
+            return (handle < _objects.size() && _objects[handle].alive);
+        }
+
+        std::int32_t cell_of(T value) const noexcept
+        {
+            constexpr T limit = T(1 << 30);
+
+            // Clamping before the conversion keeps huge coordinates, and infinite query extents, in range
+            return static_cast<std::int32_t>(std::clamp(std::floor(value * _inv_cell_size), -limit, limit));
+        }
+
+        cell_type cell_of(const basic_vector3<T>& position) const noexcept
+        {
+            return { cell_of(position.x), cell_of(position.y), cell_of(position.z) };
+        }
+
+        cell_range cells_of(const basic_bounding_box<T>& box) const noexcept
+        {
+            return { cell_of(box.min), cell_of(box.max) };
+        }
+
+        std::uint32_t bucket_of(const cell_type& cell) const noexcept
+        {
+            // Reference: Teschner et al. "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+            auto hash = (static_cast<std::uint32_t>(cell.x) * 73856093u)
+                      ^ (static_cast<std::uint32_t>(cell.y) * 19349663u)
+                      ^ (static_cast<std::uint32_t>(cell.z) * 83492791u);
+
+            return hash & static_cast<std::uint32_t>(_buckets.size() - 1);
+        }
+
+        template <typename Function>
+        void for_each_cell(const cell_range& range, Function&& fn) const
+        {
+            for (auto z = range.min.z; z <= range.max.z; ++z)
+            {
+                for (auto y = range.min.y; y <= range.max.y; ++y)
+                {
+                    for (auto x = range.min.x; x <= range.max.x; ++x)
+                    {
+                        fn(cell_type { x, y, z });
+                    }
+                }
+            }
+        }
+
+        void link(handle_type handle, const cell_range& range)
+        {
+            if (is_oversized(range))
+            {
+                _oversized.push_back(handle);
+                return;
+            }
+
+            for_each_cell(range, [&] (const cell_type& cell) -> void
+            {
+                auto bucket = bucket_of(cell);
+                auto index  = _free_entry;
+
+                if (index != invalid_handle)
+                {
+                    _free_entry = _entries[index].next;
+                }
+                else
+                {
+                    index = static_cast<std::uint32_t>(_entries.size());
+                    _entries.push_back({ });
+                }
+
+                _entries[index]  = { cell, handle, _buckets[bucket] };
+                _buckets[bucket] = index;
+            });
+        }
+
+        void unlink(handle_type handle, const cell_range& range) noexcept
+        {
+            if (is_oversized(range))
+            {
+                auto it = std::find(_oversized.begin(), _oversized.end(), handle);
+
+                *it = _oversized.back();
+                _oversized.pop_back();
+                return;
+            }
+
+            for_each_cell(range, [&] (const cell_type& cell) -> void
+            {
+                auto* slot = &_buckets[bucket_of(cell)];
+
+                while (*slot != invalid_handle)
+                {
+                    auto& current = _entries[*slot];
+
+                    if (current.object == handle && current.cell == cell)
+                    {
+                        auto index = *slot;
+
+                        *slot        = current.next;
+                        current.next = _free_entry;
+                        _free_entry  = index;
+                        break;
+                    }
+
+                    slot = &current.next;
+                }
+            });
+        }
+
+        template <typename Predicate, typename Function>
+        void query_cells(const basic_bounding_box<T>& box, Predicate&& predicate, Function& fn) const
+        {
+            auto range = cells_of(box);
+
+            if (is_oversized(range))
+            {
+                // Walking the cells of a large query costs more than testing every object
+                for (handle_type handle = 0; handle < _objects.size(); ++handle)
+                {
+                    if (_objects[handle].alive && predicate(_objects[handle].box))
+                    {
+                        fn(handle);
+                    }
+                }
+
+                return;
+            }
+
+            for (auto handle : _oversized)
+            {
+                if (predicate(_objects[handle].box))
+                {
+                    fn(handle);
+                }
+            }
+
+            for_each_cell(range, [&] (const cell_type& cell) -> void
+            {
+                for (auto i = _buckets[bucket_of(cell)]; i != invalid_handle; i = _entries[i].next)
+                {
+                    const auto& current = _entries[i];
+                    const auto& bounds  = _objects[current.object].box;
+
+                    // Report each object only from the cell holding the lowest corner of its overlap with the query
+                    if (current.cell == cell
+                     && predicate(bounds)
+                     && cell_of(vector::max(box.min, bounds.min)) == cell)
+                    {
+                        fn(current.object);
+                    }
+                }
+            });
+        }
+
+    private:
+        T                          _inv_cell_size;
+        std::vector<std::uint32_t> _buckets;
+        std::vector<entry>         _entries;
+        std::vector<object_record> _objects;
+        std::vector<handle_type>   _oversized;
+        std::uint32_t              _free_entry;
+        handle_type                _free_object;
+        std::size_t                _count;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using spatial_hash_grid = basic_spatial_hash_grid<float>;
+}
+
+#endif // SCENER_MATH_BASIC_SPATIAL_HASH_GRID_HPP
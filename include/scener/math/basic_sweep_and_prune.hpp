@@ -0,0 +1,373 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BASIC_SWEEP_AND_PRUNE_HPP
+#define SCENER_MATH_BASIC_SWEEP_AND_PRUNE_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <gsl/assert>
+
+#include "scener/math/bounding_box.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Sweep and prune broadphase over basic_bounding_box volumes.
+    ///
+    /// Keeps the box endpoints sorted along each axis and re-sorts them with insertion sort, which runs in near
+    /// linear time when objects move coherently between updates. Overlapping pairs are tracked as endpoints swap
+    /// places, so only the pairs that start or stop overlapping are reported.
+    ///
+    /// Changes made through insert, update and remove are applied by the next call to update_pairs.
+    template <typename T, typename = typename std::enable_if_t<std::is_floating_point_v<T>>>
+    class basic_sweep_and_prune final
+    {
+    public:
+        /// Identifies an object stored in the broadphase.
+        using handle_type = std::uint32_t;
+
+        /// Value used to represent an invalid object handle.
+        constexpr static handle_type invalid_handle = std::numeric_limits<handle_type>::max();
+
+    public:
+        /// Initializes a new instance of the basic_sweep_and_prune class.
+        basic_sweep_and_prune() noexcept
+            : _axes             { }
+            , _objects          { }
+            , _pairs            { }
+            , _touched          { }
+            , _pending_removals { }
+            , _free_object      { invalid_handle }
+            , _count            { 0 }
+        {
+        }
+
+    public:
+        /// Gets the number of objects stored in the broadphase.
+        /// \returns the number of objects stored in the broadphase.
+        std::size_t size() const noexcept
+        {
+            return _count;
+        }
+
+        /// Gets the bounds of the given object.
+        /// \param handle the object handle.
+        /// \returns the bounds of the given object.
+        const basic_bounding_box<T>& bounds(handle_type handle) const noexcept
+        {
+            Expects(is_alive(handle));
+
+            return _objects[handle].box;
+        }
+
+        /// Inserts a new object.
+        /// \param box the object bounds.
+        /// \returns the handle of the new object.
+        handle_type insert(const basic_bounding_box<T>& box)
+        {
+            handle_type handle = _free_object;
+
+            if (handle != invalid_handle)
+            {
+                _free_object = _objects[handle].next_free;
+                _objects[handle].box = box;
+            }
+            else
+            {
+                handle = static_cast<handle_type>(_objects.size());
+                _objects.push_back({ box, { }, invalid_handle, false });
+            }
+
+            auto& record = _objects[handle];
+
+            record.next_free = invalid_handle;
+            record.alive     = true;
+
+            // The new endpoints are appended past every other endpoint, and sorted into place by update_pairs
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                auto& endpoints = _axes[axis];
+
+                record.index[axis][0] = static_cast<std::uint32_t>(endpoints.size());
+                endpoints.push_back({ max_value<T>, handle << 1 });
+
+                record.index[axis][1] = static_cast<std::uint32_t>(endpoints.size());
+                endpoints.push_back({ max_value<T>, (handle << 1) | 1 });
+            }
+
+            store_endpoints(record);
+
+            ++_count;
+
+            return handle;
+        }
+
+        /// Updates the bounds of an object.
+        /// \param handle the object handle.
+        /// \param box the new object bounds.
+        void update(handle_type handle, const basic_bounding_box<T>& box) noexcept
+        {
+            Expects(is_alive(handle));
+
+            auto& record = _objects[handle];
+
+            record.box = box;
+
+            store_endpoints(record);
+        }
+
+        /// Removes an object, its handle is not recycled until the next call to update_pairs.
+        /// \param handle the object handle.
+        void remove(handle_type handle)
+        {
+            Expects(is_alive(handle));
+
+            auto& record = _objects[handle];
+
+            // Moving the endpoints past every other endpoint ends most of the overlaps of the object when sorting,
+            // update_pairs drops the ones left with objects that also reach the maximum value
+            record.box   = { basic_vector3<T> { max_value<T> }, basic_vector3<T> { max_value<T> } };
+            record.alive = false;
+
+            store_endpoints(record);
+
+            _pending_removals.push_back(handle);
+
+            --_count;
+        }
+
+    public:
+        /// Sorts the endpoint arrays and reports the overlapping pairs that changed since the previous call.
+        /// \param added function invoked with the handles of every pair that started overlapping.
+        /// \param removed function invoked with the handles of every pair that stopped overlapping.
+        template <typename AddedFunction, typename RemovedFunction>
+        void update_pairs(AddedFunction&& added, RemovedFunction&& removed)
+        {
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                sort_axis(axis);
+            }
+
+            if (!_pending_removals.empty())
+            {
+                remove_dead_pairs();
+                remove_dead_endpoints();
+            }
+
+            for (auto handle : _pending_removals)
+            {
+                _objects[handle].next_free = _free_object;
+                _free_object = handle;
+            }
+
+            _pending_removals.clear();
+
+            for (const auto& change : _touched)
+            {
+                bool overlapping = (_pairs.count(change.first) != 0);
+
+                if (overlapping && !change.second)
+                {
+                    added(first_of(change.first), second_of(change.first));
+                }
+                else if (!overlapping && change.second)
+                {
+                    removed(first_of(change.first), second_of(change.first));
+                }
+            }
+
+            _touched.clear();
+        }
+
+        /// Invokes the given function once for every overlapping pair found by the last call to update_pairs.
+        /// \param fn function invoked with the handles of both objects, the lowest handle first.
+        template <typename Function>
+        void for_each_pair(Function&& fn) const
+        {
+            for (auto key : _pairs)
+            {
+                fn(first_of(key), second_of(key));
+            }
+        }
+
+    private:
+        struct endpoint
+        {
+            T             value;
+            std::uint32_t data;   // object handle << 1 | 1 for max endpoints, 0 for min endpoints
+        };
+
+        struct object_record
+        {
+            basic_bounding_box<T>                       box;
+            std::array<std::array<std::uint32_t, 2>, 3> index;
+            handle_type                                 next_free;
+            bool                                        alive;
+        };
+
+    private:
+        static handle_type first_of(std::uint64_t key) noexcept
+        {
+            return static_cast<handle_type>(key >> 32);
+        }
+
+        static handle_type second_of(std::uint64_t key) noexcept
+        {
+            return static_cast<handle_type>(key & 0xFFFFFFFF);
+        }
+
+        static std::uint64_t key_of(handle_type lhs, handle_type rhs) noexcept
+        {
+            return (lhs < rhs) ? (std::uint64_t(lhs) << 32) | rhs : (std::uint64_t(rhs) << 32) | lhs;
+        }
+
+        static bool less(const endpoint& lhs, const endpoint& rhs) noexcept
+        {
+            // On ties min endpoints go first, so touching boxes are considered to overlap
+            return (lhs.value < rhs.value) || (lhs.value == rhs.value && (lhs.data & 1) < (rhs.data & 1));
+        }
+
+        bool is_alive(handle_type handle) const noexcept
+        {
+            return (handle < _objects.size() && _objects[handle].alive);
+        }
+
+        void store_endpoints(const object_record& record) noexcept
+        {
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                _axes[axis][record.index[axis][0]].value = record.box.min[axis];
+                _axes[axis][record.index[axis][1]].value = record.box.max[axis];
+            }
+        }
+
+        bool overlaps(handle_type lhs, handle_type rhs) const noexcept
+        {
+            const auto& a = _objects[lhs];
+            const auto& b = _objects[rhs];
+
+            // Branch free test over the three axes, the sorting axis is already known to overlap
+            return (a.alive & b.alive)
+                 & (a.box.min.x <= b.box.max.x) & (b.box.min.x <= a.box.max.x)
+                 & (a.box.min.y <= b.box.max.y) & (b.box.min.y <= a.box.max.y)
+                 & (a.box.min.z <= b.box.max.z) & (b.box.min.z <= a.box.max.z);
+        }
+
+        void touch(std::uint64_t key)
+        {
+            _touched.emplace(key, _pairs.count(key) != 0);
+        }
+
+        void remove_dead_pairs()
+        {
+            // Objects whose bounds reach the maximum value, or infinity, may not have been sorted past the endpoints
+            // of the removed objects
+            for (auto it = _pairs.begin(); it != _pairs.end(); )
+            {
+                if (_objects[first_of(*it)].alive && _objects[second_of(*it)].alive)
+                {
+                    ++it;
+                }
+                else
+                {
+                    touch(*it);
+                    it = _pairs.erase(it);
+                }
+            }
+        }
+
+        void remove_dead_endpoints() noexcept
+        {
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                auto&       endpoints = _axes[axis];
+                std::size_t count     = 0;
+
+                for (const auto& current : endpoints)
+                {
+                    auto& record = _objects[current.data >> 1];
+
+                    if (record.alive)
+                    {
+                        record.index[axis][current.data & 1] = static_cast<std::uint32_t>(count);
+                        endpoints[count++] = current;
+                    }
+                }
+
+                endpoints.erase(endpoints.begin() + count, endpoints.end());
+            }
+        }
+
+        void sort_axis(std::size_t axis)
+        {
+            auto& endpoints = _axes[axis];
+
+            for (std::size_t i = 1; i < endpoints.size(); ++i)
+            {
+                auto        current = endpoints[i];
+                auto        j       = i;
+                handle_type handle  = current.data >> 1;
+
+                while (j > 0 && less(current, endpoints[j - 1]))
+                {
+                    const auto& previous = endpoints[j - 1];
+                    handle_type other    = previous.data >> 1;
+
+                    if ((current.data & 1) == 0 && (previous.data & 1) == 1)
+                    {
+                        // A min endpoint moved below a max endpoint, the objects may start overlapping
+                        if (overlaps(handle, other))
+                        {
+                            auto key = key_of(handle, other);
+
+                            touch(key);
+                            _pairs.insert(key);
+                        }
+                    }
+                    else if ((current.data & 1) == 1 && (previous.data & 1) == 0)
+                    {
+                        // A max endpoint moved below a min endpoint, the objects no longer overlap
+                        auto key = key_of(handle, other);
+
+                        if (_pairs.count(key) != 0)
+                        {
+                            touch(key);
+                            _pairs.erase(key);
+                        }
+                    }
+
+                    endpoints[j] = previous;
+                    _objects[other].index[axis][previous.data & 1] = static_cast<std::uint32_t>(j);
+                    --j;
+                }
+
+                endpoints[j] = current;
+                _objects[handle].index[axis][current.data & 1] = static_cast<std::uint32_t>(j);
+            }
+        }
+
+    private:
+        std::array<std::vector<endpoint>, 3>     _axes;
+        std::vector<object_record>               _objects;
+        std::unordered_set<std::uint64_t>        _pairs;
+        std::unordered_map<std::uint64_t, bool>  _touched;
+        std::vector<handle_type>                 _pending_removals;
+        handle_type                              _free_object;
+        std::size_t                              _count;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using sweep_and_prune = basic_sweep_and_prune<float>;
+}
+
+#endif // SCENER_MATH_BASIC_SWEEP_AND_PRUNE_HPP
@@ -36,7 +36,7 @@ namespace scener::math
     // TEMPLATES
 
     /// Represents a generic vector.
-    template <typename T, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<T>>>
+    template <typename T, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<T>>>
     struct basic_vector
     {
         using traits_type            = basic_vector_traits<T, Dimension>;
@@ -931,7 +931,7 @@ namespace scener::math
     // OPERATORS (WITH SCALARS)
 
     /// Multiplication assignment operator for multipliying basic_vector instances against an scalar value.
-    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension>& operator*=(basic_vector<T, Dimension>& lhs, const S& rhs) noexcept
     {
         std::transform(lhs.begin(), lhs.end(), lhs.begin(), std::bind(std::multiplies<T>(), std::placeholders::_1, rhs));
@@ -940,7 +940,7 @@ namespace scener::math
     }
 
     /// Multiplication operator for multipliying basic_vector instances against an scalar value.
-    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> operator*(const basic_vector<T, Dimension>& lhs, const S& rhs) noexcept
     {
         auto result = lhs;
@@ -951,13 +951,13 @@ namespace scener::math
     }
 
     /// Multiplication operator for multipliying basic_vector instances against an scalar value.
-    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> operator*(const S& lhs, const basic_vector<T, Dimension>& rhs) noexcept
     {
         return rhs * lhs;
     }
 
-    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension>& operator/=(basic_vector<T, Dimension>& lhs, const S& rhs) noexcept
     {
         std::transform(lhs.begin(), lhs.end(), lhs.begin(), std::bind(std::divides<T>(), std::placeholders::_1, rhs));
@@ -965,7 +965,7 @@ namespace scener::math
         return lhs;
     }
 
-    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> operator/(const basic_vector<T, Dimension>& lhs, const S& rhs) noexcept
     {
         auto vector = lhs;
@@ -6,10 +6,55 @@
 
 #include <numeric>
 
+#include <gsl/assert>
+#include <gsl/span>
+
 #include "scener/math/algorithm.hpp"
 #include "scener/math/basic_vector.hpp"
 #include "scener/math/basic_angle.hpp"
 #include "scener/math/functional.hpp"
+#include "scener/math/simd.hpp"
+
+namespace scener::math::detail
+{
+    /// Loads the components of V::size() consecutive 3D vectors into separate x, y and z registers.
+    template <typename V>
+    inline void deinterleave(const basic_vector3<float>* source, V& x, V& y, V& z) noexcept
+    {
+        float vx[V::size()];
+        float vy[V::size()];
+        float vz[V::size()];
+
+        for (std::size_t i = 0; i < V::size(); ++i)
+        {
+            vx[i] = source[i].x;
+            vy[i] = source[i].y;
+            vz[i] = source[i].z;
+        }
+
+        x = V::load(vx);
+        y = V::load(vy);
+        z = V::load(vz);
+    }
+
+    /// Stores x, y and z registers as V::size() consecutive 3D vectors.
+    template <typename V>
+    inline void interleave(const V& x, const V& y, const V& z, basic_vector3<float>* destination) noexcept
+    {
+        float vx[V::size()];
+        float vy[V::size()];
+        float vz[V::size()];
+
+        x.store(vx);
+        y.store(vy);
+        z.store(vz);
+
+        for (std::size_t i = 0; i < V::size(); ++i)
+        {
+            destination[i] = { vx[i], vy[i], vz[i] };
+        }
+    }
+}
 
 namespace scener::math::vector
 {
@@ -36,7 +81,7 @@ namespace scener::math::vector
     /// \param amount2 the normalized barycentric (areal) coordinate b3, equal to the weighting factor for vertex 3,
     ///                the coordinate of which is specified in value3.
     /// \returns the cartesian coordinate.
-    template <typename T = float, std::size_t Dimension, typename S, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, std::size_t Dimension, typename S, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> barycentric(const basic_vector<T, Dimension>& value1
                                                    , const basic_vector<T, Dimension>& value2
                                                    , const basic_vector<T, Dimension>& value3
@@ -58,7 +103,7 @@ namespace scener::math::vector
     /// \param value4 the fourth position in the interpolation.
     /// \param amount weighting factor.
     /// \returns the interpolation result.
-    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> catmull_rom(const basic_vector<T, Dimension>& value1
                                                    , const basic_vector<T, Dimension>& value2
                                                    , const basic_vector<T, Dimension>& value3
@@ -115,7 +160,7 @@ namespace scener::math::vector
     /// \param tangent2 source tangent 2.
     /// \param amount weighting factor.
     /// \returns the interpolation result.
-    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> hermite(const basic_vector<T, Dimension>& value1
                                                , const basic_vector<T, Dimension>& tangent1
                                                , const basic_vector<T, Dimension>& value2
@@ -135,7 +180,7 @@ namespace scener::math::vector
     /// \param value2 second vector.
     /// \param amount value between 0 and 1 indicating the weight of value2.
     /// \returns the linear interpolation of the two vectors.
-    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> lerp(const basic_vector<T, Dimension>& value1
                                             , const basic_vector<T, Dimension>& value2
                                             , S                                 amount) noexcept
@@ -207,7 +252,7 @@ namespace scener::math::vector
     /// \param value2 second vector
     /// \param amount weighting value.
     /// \returns the linear interpolation of the two vectors.
-    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<std::is_arithmetic_v<S>>>
+    template <typename T = float, typename S, std::size_t Dimension, typename = typename std::enable_if_t<is_arithmetic_like_v<S>>>
     constexpr basic_vector<T, Dimension> smooth_step(const basic_vector<T, Dimension>& value1
                                                    , const basic_vector<T, Dimension>& value2
                                                    , S                                 amount) noexcept
@@ -261,7 +306,7 @@ namespace scener::math::vector
         //
         // |a| = sqrt(x^2 + y^2 + z^2)
 
-        return std::sqrt(length_squared(vector));
+        return math::sqrt(length_squared(vector));
     }
 
     /// Retrieves the angle required to rotate the first specified vector structure into the second specified vector structure.
@@ -272,7 +317,7 @@ namespace scener::math::vector
     constexpr basic_radians<T> angle_between(const basic_vector<T, Dimension>& left
                                            , const basic_vector<T, Dimension>& right) noexcept
     {
-        return { std::acos(dot(left, right) / std::sqrt(length_squared(left) * length_squared(right))) };
+        return { math::acos(dot(left, right) / math::sqrt(length_squared(left) * length_squared(right))) };
     }
 
     /// Calculates the distance between two vectors.
@@ -325,6 +370,70 @@ namespace scener::math::vector
                , (lhs.z * rhs.x) - (lhs.x * rhs.z)
                , (lhs.x * rhs.y) - (lhs.y * rhs.x) };
     }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // BATCH OPERATIONS
+
+    /// Calculates the dot products of 3D vectors pairwise, as dot(lhs[i], rhs[i]).
+    /// \param lhs the first vectors.
+    /// \param rhs the second vectors, of the same size as lhs.
+    /// \param result the dot products, of the same size as lhs.
+    inline void dot(gsl::span<const basic_vector3<float>> lhs
+                  , gsl::span<const basic_vector3<float>> rhs
+                  , gsl::span<float>                      result) noexcept
+    {
+        Expects(lhs.size() == rhs.size() && lhs.size() == result.size());
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+
+        auto        count = static_cast<std::size_t>(lhs.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            lanes lx, ly, lz, rx, ry, rz;
+
+            math::detail::deinterleave(lhs.data() + i, lx, ly, lz);
+            math::detail::deinterleave(rhs.data() + i, rx, ry, rz);
+
+            (lx * rx + ly * ry + lz * rz).store(result.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            result[i] = dot(lhs[i], rhs[i]);
+        }
+    }
+
+    /// Normalizes 3D vectors.
+    /// \param source the vectors to normalize.
+    /// \param destination the unit length vectors, of the same size as the source; may be the source itself.
+    inline void normalize(gsl::span<const basic_vector3<float>> source
+                        , gsl::span<basic_vector3<float>>       destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            lanes x, y, z;
+
+            math::detail::deinterleave(source.data() + i, x, y, z);
+
+            auto length = sqrt(x * x + y * y + z * z);
+
+            math::detail::interleave(x / length, y / length, z / length, destination.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            destination[i] = normalize(source[i]);
+        }
+    }
 }
 
 #endif // SCENER_MATH_VECTOR_OPERATIONS_HPP
@@ -4,8 +4,62 @@
 #ifndef SCENER_MATH_BASIC_VECTOR_TRANSFORMS_HPP
 #define SCENER_MATH_BASIC_VECTOR_TRANSFORMS_HPP
 
+#include <array>
+#include <cstddef>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/aligned.hpp"
 #include "scener/math/basic_matrix_operations.hpp"
 #include "scener/math/basic_quaternion.hpp"
+#include "scener/math/basic_quaternion_operations.hpp"
+#include "scener/math/simd.hpp"
+
+namespace scener::math::detail
+{
+    /// Transforms four component vectors of floats by the given matrix, evaluating the products and sums of the scalar
+    /// operator; the results can differ from it in the last bits where the compiler fuses the scalar ones.
+    template <typename Flags>
+    inline void transform(gsl::span<const basic_vector4<float>> source
+                        , const basic_matrix4<float>&           matrix
+                        , gsl::span<basic_vector4<float>>       destination
+                        , Flags                                 flags) noexcept
+    {
+        using row_type = simd<float, 4>;
+
+        auto r1 = row_type::load(matrix.data());
+        auto r2 = row_type::load(matrix.data() + 4);
+        auto r3 = row_type::load(matrix.data() + 8);
+        auto r4 = row_type::load(matrix.data() + 12);
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            auto value  = row_type::load(source[i].data(), flags);
+            auto result = shuffle<0, 0, 0, 0>(value) * r1;
+
+            result = result + shuffle<1, 1, 1, 1>(value) * r2;
+            result = result + shuffle<2, 2, 2, 2>(value) * r3;
+            result = result + shuffle<3, 3, 3, 3>(value) * r4;
+
+            result.store(destination[i].data(), flags);
+        }
+    }
+
+    /// Rotates vectors given as separate x, y and z values by quaternions given as { x, y, z, w }, as
+    /// v + 2w (q x v) + 2 q x (q x v); the same polynomial as transforming by matrix::create_from_quaternion(q).
+    template <typename V>
+    constexpr void rotate(const V (&q)[4], V& x, V& y, V& z) noexcept
+    {
+        V tx = V(2.0f) * (q[1] * z - q[2] * y);
+        V ty = V(2.0f) * (q[2] * x - q[0] * z);
+        V tz = V(2.0f) * (q[0] * y - q[1] * x);
+
+        x = x + q[3] * tx + (q[1] * tz - q[2] * ty);
+        y = y + q[3] * ty + (q[2] * tx - q[0] * tz);
+        z = z + q[3] * tz + (q[0] * ty - q[1] * tx);
+    }
+}
 
 namespace scener::math::vector
 {
@@ -43,6 +97,155 @@ namespace scener::math::vector
         return (position * matrix);
     }
 
+    /// Transforms an array of 3D vectors by the given matrix.
+    ///
+    /// The components are processed as separate x, y and z streams, so the loops map directly onto SIMD lanes and
+    /// the whole array is transformed with no per-vector shuffling.
+    /// \param positions the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \returns the transformed vectors, divided by the resulting w component.
+    template <typename T = float, std::size_t Count>
+    constexpr std::array<basic_vector3<T>, Count> transform(const std::array<basic_vector3<T>, Count>& positions
+                                                          , const basic_matrix4<T>&                   matrix) noexcept
+    {
+        T x[Count] = { };
+        T y[Count] = { };
+        T z[Count] = { };
+        T w[Count] = { };
+
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            x[i] = positions[i].x;
+            y[i] = positions[i].y;
+            z[i] = positions[i].z;
+        }
+
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            T vx = (x[i] * matrix.m11) + (y[i] * matrix.m21) + (z[i] * matrix.m31) + matrix.m41;
+            T vy = (x[i] * matrix.m12) + (y[i] * matrix.m22) + (z[i] * matrix.m32) + matrix.m42;
+            T vz = (x[i] * matrix.m13) + (y[i] * matrix.m23) + (z[i] * matrix.m33) + matrix.m43;
+            T vw = (x[i] * matrix.m14) + (y[i] * matrix.m24) + (z[i] * matrix.m34) + matrix.m44;
+
+            w[i] = T(1) / vw;
+            x[i] = vx * w[i];
+            y[i] = vy * w[i];
+            z[i] = vz * w[i];
+        }
+
+        std::array<basic_vector3<T>, Count> result;
+
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            result[i] = { x[i], y[i], z[i] };
+        }
+
+        return result;
+    }
+
+    /// Transforms 3D vectors by the given matrix.
+    ///
+    /// As the array overload does, the components are processed as separate x, y and z streams; the vectors are
+    /// loaded four at a time into a register per component.
+    /// \param positions the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \param destination the transformed vectors, divided by the resulting w component; of the same size as the source
+    ///        and may be the source itself.
+    inline void transform(gsl::span<const basic_vector3<float>> positions
+                        , const basic_matrix4<float>&           matrix
+                        , gsl::span<basic_vector3<float>>       destination) noexcept
+    {
+        Expects(positions.size() == destination.size());
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+
+        auto        count = static_cast<std::size_t>(positions.size());
+        std::size_t i     = 0;
+
+        // The lanes evaluate the expression of the scalar loop below, up to the products and sums the compiler fuses
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            lanes px, py, pz;
+
+            math::detail::deinterleave(positions.data() + i, px, py, pz);
+
+            auto vx = px * lanes { matrix.m11 } + py * lanes { matrix.m21 }
+                    + pz * lanes { matrix.m31 } + lanes { matrix.m41 };
+            auto vy = px * lanes { matrix.m12 } + py * lanes { matrix.m22 }
+                    + pz * lanes { matrix.m32 } + lanes { matrix.m42 };
+            auto vz = px * lanes { matrix.m13 } + py * lanes { matrix.m23 }
+                    + pz * lanes { matrix.m33 } + lanes { matrix.m43 };
+            auto vw = px * lanes { matrix.m14 } + py * lanes { matrix.m24 }
+                    + pz * lanes { matrix.m34 } + lanes { matrix.m44 };
+
+            vw = lanes { 1.0f } / vw;
+
+            math::detail::interleave(vx * vw, vy * vw, vz * vw, destination.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            auto  p  = positions[i];
+            float vx = (p.x * matrix.m11) + (p.y * matrix.m21) + (p.z * matrix.m31) + matrix.m41;
+            float vy = (p.x * matrix.m12) + (p.y * matrix.m22) + (p.z * matrix.m32) + matrix.m42;
+            float vz = (p.x * matrix.m13) + (p.y * matrix.m23) + (p.z * matrix.m33) + matrix.m43;
+            float vw = 1.0f / ((p.x * matrix.m14) + (p.y * matrix.m24) + (p.z * matrix.m34) + matrix.m44);
+
+            destination[i] = { vx * vw, vy * vw, vz * vw };
+        }
+    }
+
+    /// Transforms four component vectors by the given matrix.
+    ///
+    /// Aligned loads and stores are used when both arrays are 16 bytes aligned, as they are when stored in
+    /// aligned_vector4 values or in containers using aligned_allocator.
+    /// \param source the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \param destination the transformed vectors, of the same size as the source; may be the source itself.
+    inline void transform(gsl::span<const basic_vector4<float>> source
+                        , const basic_matrix4<float>&           matrix
+                        , gsl::span<basic_vector4<float>>       destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        if (math::detail::is_aligned(source.data(), 16) && math::detail::is_aligned(destination.data(), 16))
+        {
+            math::detail::transform(source, matrix, destination, math::detail::vector_aligned);
+        }
+        else
+        {
+            math::detail::transform(source, matrix, destination, math::detail::element_aligned);
+        }
+    }
+
+    /// Transforms 3D vectors by the given matrix, with the given executor.
+    /// \param executor the executor running the batch.
+    /// \param positions the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \param destination the transformed vectors, of the same size as the source; may be the source itself.
+    template <typename Executor, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void transform(Executor&&                            executor
+                 , gsl::span<const basic_vector3<float>> positions
+                 , const basic_matrix4<float>&           matrix
+                 , gsl::span<basic_vector3<float>>       destination)
+    {
+        parallel_batch(executor, [&](auto s, auto d) { transform(s, matrix, d); }, positions, destination);
+    }
+
+    /// Transforms four component vectors by the given matrix, with the given executor.
+    /// \param executor the executor running the batch.
+    /// \param source the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \param destination the transformed vectors, of the same size as the source; may be the source itself.
+    template <typename Executor, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void transform(Executor&&                            executor
+                 , gsl::span<const basic_vector4<float>> source
+                 , const basic_matrix4<float>&           matrix
+                 , gsl::span<basic_vector4<float>>       destination)
+    {
+        parallel_batch(executor, [&](auto s, auto d) { transform(s, matrix, d); }, source, destination);
+    }
+
     // -----------------------------------------------------------------------------------------------------------------
     // TRANSFORM: VECTOR by QUATERNION
 
@@ -53,7 +256,15 @@ namespace scener::math::vector
     template <typename T = float>
     constexpr basic_vector2<T> transform(const basic_vector2<T>& vector, const basic_quaternion<T>& rotation) noexcept
     {
-        return (transform(vector, matrix::create_from_quaternion(rotation)));
+        const T q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+        T x = vector.x;
+        T y = vector.y;
+        T z = 0;
+
+        math::detail::rotate(q, x, y, z);
+
+        return { x, y };
     }
 
     /// Transforms a vector by the specified quaternion rotation value.
@@ -63,7 +274,15 @@ namespace scener::math::vector
     template <typename T = float>
     constexpr basic_vector3<T> transform(const basic_vector3<T>& vector, const basic_quaternion<T>& rotation) noexcept
     {
-        return (vector * matrix::create_from_quaternion(rotation));
+        const T q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+        T x = vector.x;
+        T y = vector.y;
+        T z = vector.z;
+
+        math::detail::rotate(q, x, y, z);
+
+        return { x, y, z };
     }
 
     /// Transforms a four-dimensional vector by a specified quaternion.
@@ -73,7 +292,107 @@ namespace scener::math::vector
     template <typename T = float>
     constexpr basic_vector4<T> transform(const basic_vector4<T>& value, const basic_quaternion<T>& rotation) noexcept
     {
-        return (value * matrix::create_from_quaternion(rotation));
+        const T q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+        T x = value.x;
+        T y = value.y;
+        T z = value.z;
+
+        math::detail::rotate(q, x, y, z);
+
+        return { x, y, z, value.w };
+    }
+
+    /// Rotates 3D vectors by the given quaternion.
+    /// \param source the vectors to rotate.
+    /// \param rotation the rotation to apply.
+    /// \param destination the rotated vectors, of the same size as the source; may be the source itself.
+    inline void transform(gsl::span<const basic_vector3<float>> source
+                        , const basic_quaternion<float>&        rotation
+                        , gsl::span<basic_vector3<float>>       destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+
+        const lanes q[4] = { lanes { rotation.x }, lanes { rotation.y }, lanes { rotation.z }, lanes { rotation.w } };
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            lanes x, y, z;
+
+            math::detail::deinterleave(source.data() + i, x, y, z);
+            math::detail::rotate(q, x, y, z);
+            math::detail::interleave(x, y, z, destination.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            destination[i] = transform(source[i], rotation);
+        }
+    }
+
+    /// Rotates 3D vectors by quaternions pairwise, as transform(source[i], rotations[i]).
+    /// \param source the vectors to rotate.
+    /// \param rotations the rotations to apply, of the same size as the source.
+    /// \param destination the rotated vectors, of the same size as the source; may be the source itself.
+    inline void transform(gsl::span<const basic_vector3<float>>    source
+                        , gsl::span<const basic_quaternion<float>> rotations
+                        , gsl::span<basic_vector3<float>>          destination) noexcept
+    {
+        Expects(source.size() == rotations.size() && source.size() == destination.size());
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+
+        auto        count = static_cast<std::size_t>(source.size());
+        std::size_t i     = 0;
+
+        for (; i + lanes::size() <= count; i += lanes::size())
+        {
+            lanes x, y, z;
+            lanes q[4];
+
+            math::detail::deinterleave(source.data() + i, x, y, z);
+            math::detail::deinterleave(rotations.data() + i, q[0], q[1], q[2], q[3]);
+            math::detail::rotate(q, x, y, z);
+            math::detail::interleave(x, y, z, destination.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            destination[i] = transform(source[i], rotations[i]);
+        }
+    }
+
+    /// Rotates 3D vectors by the given quaternion, with the given executor.
+    /// \param executor the executor running the batch.
+    /// \param source the vectors to rotate.
+    /// \param rotation the rotation to apply.
+    /// \param destination the rotated vectors, of the same size as the source; may be the source itself.
+    template <typename Executor, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void transform(Executor&&                            executor
+                 , gsl::span<const basic_vector3<float>> source
+                 , const basic_quaternion<float>&        rotation
+                 , gsl::span<basic_vector3<float>>       destination)
+    {
+        parallel_batch(executor, [&](auto s, auto d) { transform(s, rotation, d); }, source, destination);
+    }
+
+    /// Rotates 3D vectors by quaternions pairwise, with the given executor.
+    /// \param executor the executor running the batch.
+    /// \param source the vectors to rotate.
+    /// \param rotations the rotations to apply, of the same size as the source.
+    /// \param destination the rotated vectors, of the same size as the source; may be the source itself.
+    template <typename Executor, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void transform(Executor&&                               executor
+                 , gsl::span<const basic_vector3<float>>    source
+                 , gsl::span<const basic_quaternion<float>> rotations
+                 , gsl::span<basic_vector3<float>>          destination)
+    {
+        parallel_batch(executor, [](auto s, auto r, auto d) { transform(s, r, d); }, source, rotations, destination);
     }
 
     // -----------------------------------------------------------------------------------------------------------------
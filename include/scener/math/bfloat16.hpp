@@ -0,0 +1,272 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_BFLOAT16_HPP
+#define SCENER_MATH_BFLOAT16_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_vector.hpp"
+#include "scener/math/type_traits.hpp"
+
+namespace scener::math
+{
+    /// Represents a brain floating point (bfloat16) number: the upper half of a single precision number, with its
+    /// eight exponent bits and seven mantissa bits.
+    ///
+    /// bfloat16 is a storage type: arithmetic is carried out in single precision through the implicit conversions to
+    /// and from float, and the result is rounded back to bfloat16 when stored.
+    class bfloat16 final
+    {
+    public:
+        /// Creates a bfloat16 number from its binary representation.
+        /// \param bits the binary representation of the number.
+        /// \returns the bfloat16 number.
+        constexpr static bfloat16 from_bits(std::uint16_t bits) noexcept
+        {
+            bfloat16 value { };
+
+            value._bits = bits;
+
+            return value;
+        }
+
+    public:
+        /// Initializes a new instance of the bfloat16 class.
+        bfloat16() noexcept = default;
+
+        /// Initializes a new instance of the bfloat16 class with the given value, rounded to the nearest bfloat16
+        /// number.
+        /// \param value the single precision value.
+        bfloat16(float value) noexcept
+            : _bits { to_bits(value) }
+        {
+        }
+
+    public:
+        /// Gets the binary representation of the number.
+        /// \returns the binary representation of the number.
+        constexpr std::uint16_t bits() const noexcept
+        {
+            return _bits;
+        }
+
+    public:
+        /// Converts the number to single precision, the conversion is exact.
+        operator float() const noexcept
+        {
+            std::uint32_t bits = std::uint32_t(_bits) << 16;
+            float         result;
+
+            std::memcpy(&result, &bits, sizeof(result));
+
+            return result;
+        }
+
+    private:
+        static std::uint16_t to_bits(float value) noexcept
+        {
+            std::uint32_t bits;
+
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            if ((bits & 0x7FFFFFFF) > 0x7F800000)
+            {
+                // NaN, truncating could turn it into infinity so keep it quiet
+                return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
+            }
+
+            // Round to nearest, ties to even. Values rounding past the largest number overflow to infinity.
+            bits += 0x7FFF + ((bits >> 16) & 1);
+
+            return static_cast<std::uint16_t>(bits >> 16);
+        }
+
+    private:
+        std::uint16_t _bits;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TRAITS
+
+    template <>
+    struct is_arithmetic_like<bfloat16> : std::true_type
+    {
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // CONVERSIONS
+
+    /// Converts single precision values to bfloat16, rounding to the nearest value.
+    /// \param source the single precision values.
+    /// \param destination the bfloat16 values, of the same size as the source.
+    inline void convert(gsl::span<const float> source, gsl::span<bfloat16> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto bias  = _mm_set1_epi32(0x7FFF);
+        const auto one   = _mm_set1_epi32(1);
+        const auto quiet = _mm_set1_epi32(0x00400000);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value0 = _mm_loadu_ps(source.data() + i);
+            auto value1 = _mm_loadu_ps(source.data() + i + 4);
+
+            auto round = [&] (__m128 value) -> __m128i
+            {
+                auto bits    = _mm_castps_si128(value);
+                auto nan     = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+                auto rounded = _mm_add_epi32(bits, _mm_add_epi32(bias, _mm_and_si128(_mm_srli_epi32(bits, 16), one)));
+                auto result  = _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(bits, quiet)), _mm_andnot_si128(nan, rounded));
+
+                // The arithmetic shift keeps the upper halves within the signed 16 bits range, so packing is exact
+                return _mm_srai_epi32(result, 16);
+            };
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_packs_epi32(round(value0), round(value1)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = bfloat16 { source[i] };
+        }
+    }
+
+    /// Converts bfloat16 values to single precision.
+    /// \param source the bfloat16 values.
+    /// \param destination the single precision values, of the same size as the source.
+    inline void convert(gsl::span<const bfloat16> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto zero = _mm_setzero_si128();
+
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+            // Interleaving with zeros places every value in the upper half of a 32 bits lane
+            _mm_storeu_ps(destination.data() + i,     _mm_castsi128_ps(_mm_unpacklo_epi16(zero, value)));
+            _mm_storeu_ps(destination.data() + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, value)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = source[i];
+        }
+    }
+
+    /// Converts single precision vectors to bfloat16, rounding to the nearest value.
+    /// \param source the single precision vectors.
+    /// \param destination the bfloat16 vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void convert(gsl::span<const basic_vector<float, Dimension>> source
+               , gsl::span<basic_vector<bfloat16, Dimension>>    destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<float, Dimension>) == Dimension * sizeof(float));
+        static_assert(sizeof(basic_vector<bfloat16, Dimension>) == Dimension * sizeof(bfloat16));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<bfloat16*>(destination.data());
+
+        convert(gsl::span<const float> { input, source.size() * Dimension }
+              , gsl::span<bfloat16> { output, destination.size() * Dimension });
+    }
+
+    /// Converts bfloat16 vectors to single precision.
+    /// \param source the bfloat16 vectors.
+    /// \param destination the single precision vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void convert(gsl::span<const basic_vector<bfloat16, Dimension>> source
+               , gsl::span<basic_vector<float, Dimension>>          destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<float, Dimension>) == Dimension * sizeof(float));
+        static_assert(sizeof(basic_vector<bfloat16, Dimension>) == Dimension * sizeof(bfloat16));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const bfloat16*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        convert(gsl::span<const bfloat16> { input, source.size() * Dimension }
+              , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using vector2bf = basic_vector2<bfloat16>;
+    using vector3bf = basic_vector3<bfloat16>;
+    using vector4bf = basic_vector4<bfloat16>;
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<scener::math::bfloat16>
+    {
+        using bfloat16 = scener::math::bfloat16;
+
+    public:
+        static constexpr bool               is_specialized    = true;
+        static constexpr bool               is_signed         = true;
+        static constexpr bool               is_integer        = false;
+        static constexpr bool               is_exact          = false;
+        static constexpr bool               has_infinity      = true;
+        static constexpr bool               has_quiet_NaN     = true;
+        static constexpr bool               has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm        = denorm_present;
+        static constexpr bool               has_denorm_loss   = false;
+        static constexpr float_round_style  round_style       = round_to_nearest;
+        static constexpr bool               is_iec559         = false;
+        static constexpr bool               is_bounded        = true;
+        static constexpr bool               is_modulo         = false;
+        static constexpr int                digits            = 8;
+        static constexpr int                digits10          = 2;
+        static constexpr int                max_digits10      = 4;
+        static constexpr int                radix             = 2;
+        static constexpr int                min_exponent      = -125;
+        static constexpr int                min_exponent10    = -37;
+        static constexpr int                max_exponent      = 128;
+        static constexpr int                max_exponent10    = 38;
+        static constexpr bool               traps             = false;
+        static constexpr bool               tinyness_before   = false;
+
+        static constexpr bfloat16 min() noexcept           { return bfloat16::from_bits(0x0080); }
+        static constexpr bfloat16 lowest() noexcept        { return bfloat16::from_bits(0xFF7F); }
+        static constexpr bfloat16 max() noexcept           { return bfloat16::from_bits(0x7F7F); }
+        static constexpr bfloat16 epsilon() noexcept       { return bfloat16::from_bits(0x3C00); }
+        static constexpr bfloat16 round_error() noexcept   { return bfloat16::from_bits(0x3F00); }
+        static constexpr bfloat16 infinity() noexcept      { return bfloat16::from_bits(0x7F80); }
+        static constexpr bfloat16 quiet_NaN() noexcept     { return bfloat16::from_bits(0x7FC0); }
+        static constexpr bfloat16 signaling_NaN() noexcept { return bfloat16::from_bits(0x7FA0); }
+        static constexpr bfloat16 denorm_min() noexcept    { return bfloat16::from_bits(0x0001); }
+    };
+}
+
+#endif // SCENER_MATH_BFLOAT16_HPP
@@ -0,0 +1,475 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_COLOR_SPACE_HPP
+#define SCENER_MATH_COLOR_SPACE_HPP
+
+#include <cstddef>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_color.hpp"
+#include "scener/math/simd.hpp"
+
+namespace scener::math
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // TEMPLATES
+
+    /// Colors stored as a structure of arrays, one span per channel.
+    ///
+    /// The channels are named after RGB; for other color spaces they hold the channels in the order of the space name,
+    /// so HSV values keep hue in r, saturation in g and value in b. Alpha is never touched by color space conversions.
+    template <typename T>
+    struct basic_color_planes final
+    {
+    public:
+        /// Initializes a new instance of the basic_color_planes structure.
+        /// \param rr the red channel.
+        /// \param gg the green channel.
+        /// \param bb the blue channel.
+        constexpr basic_color_planes(gsl::span<T> rr, gsl::span<T> gg, gsl::span<T> bb) noexcept
+            : r { rr }
+            , g { gg }
+            , b { bb }
+        {
+        }
+
+        /// Initializes a new instance of the basic_color_planes structure from planes of a compatible type.
+        /// \param other the planes to view.
+        template <typename U>
+        constexpr basic_color_planes(const basic_color_planes<U>& other) noexcept
+            : r { other.r }
+            , g { other.g }
+            , b { other.b }
+        {
+        }
+
+    public:
+        /// Gets the number of colors.
+        /// \returns the number of colors.
+        constexpr std::size_t size() const noexcept
+        {
+            return r.size();
+        }
+
+    public:
+        gsl::span<T> r;
+        gsl::span<T> g;
+        gsl::span<T> b;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using color_planes       = basic_color_planes<float>;
+    using const_color_planes = basic_color_planes<const float>;
+
+    namespace detail::color_kernels
+    {
+        // The kernels are written once against simd values, so the batch path over four colors and the single color
+        // path evaluate exactly the same expression.
+
+        using lanes = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+        using lane  = math::detail::simd<float, 1, math::detail::simd_abi::scalar>;
+
+        /// Rounds every lane down, for lanes below 2^31 in magnitude.
+        template <typename V>
+        inline V floor(const V& value) noexcept
+        {
+            auto result = round(value);
+
+            return select(value < result, result - V { 1.0f }, result);
+        }
+
+        /// Multiplies a color by a 3x3 row major matrix.
+        template <typename V>
+        inline void transform(V& r, V& g, V& b, const float (&m)[9]) noexcept
+        {
+            auto x = V { m[0] } * r + V { m[1] } * g + V { m[2] } * b;
+            auto y = V { m[3] } * r + V { m[4] } * g + V { m[5] } * b;
+            auto z = V { m[6] } * r + V { m[7] } * g + V { m[8] } * b;
+
+            r = x;
+            g = y;
+            b = z;
+        }
+
+        /// Computes the hue, in [0, 1), of a color given its largest channel and the range of its channels.
+        template <typename V>
+        inline V hue(const V& r, const V& g, const V& b, const V& maximum, const V& delta) noexcept
+        {
+            auto zero  = V { 0.0f };
+            auto range = select(delta == zero, V { 1.0f }, delta);
+            auto h     = select(maximum == r
+                              , (g - b) / range
+                              , select(maximum == g, (b - r) / range + V { 2.0f }, (r - g) / range + V { 4.0f }));
+
+            h = select(h < zero, h + V { 6.0f }, h);
+
+            return select(delta == zero, zero, h / V { 6.0f });
+        }
+
+        /// Wraps a hue to [0, 1) and scales it by the number of sectors.
+        template <typename V>
+        inline V sector(const V& h, float sectors) noexcept
+        {
+            return (h - floor(h)) * V { sectors };
+        }
+
+        /// Wraps a value in [0, 2 * period) to [0, period).
+        template <typename V>
+        inline V wrap(const V& value, float period) noexcept
+        {
+            auto p = V { period };
+
+            return select(value < p, value, value - p);
+        }
+
+        template <typename V>
+        inline void rgb_to_hsv(V& r, V& g, V& b) noexcept
+        {
+            auto maximum = max(max(r, g), b);
+            auto delta   = maximum - min(min(r, g), b);
+            auto h       = hue(r, g, b, maximum, delta);
+            auto zero    = V { 0.0f };
+
+            r = h;
+            g = select(zero < maximum, delta / select(zero < maximum, maximum, V { 1.0f }), zero);
+            b = maximum;
+        }
+
+        template <typename V>
+        inline void hsv_to_rgb(V& h, V& s, V& v) noexcept
+        {
+            // f(n) = v - v * s * clamp(min(k, 4 - k), 0, 1), k = (n + 6 * h) mod 6
+            auto h6     = sector(h, 6.0f);
+            auto chroma = v * s;
+            auto zero   = V { 0.0f };
+            auto one    = V { 1.0f };
+            auto four   = V { 4.0f };
+            auto kr     = wrap(h6 + V { 5.0f }, 6.0f);
+            auto kg     = wrap(h6 + V { 3.0f }, 6.0f);
+            auto kb     = wrap(h6 + one, 6.0f);
+            auto value  = v;
+
+            h = value - chroma * max(zero, min(min(kr, four - kr), one));
+            s = value - chroma * max(zero, min(min(kg, four - kg), one));
+            v = value - chroma * max(zero, min(min(kb, four - kb), one));
+        }
+
+        template <typename V>
+        inline void rgb_to_hsl(V& r, V& g, V& b) noexcept
+        {
+            auto maximum   = max(max(r, g), b);
+            auto minimum   = min(min(r, g), b);
+            auto delta     = maximum - minimum;
+            auto h         = hue(r, g, b, maximum, delta);
+            auto one       = V { 1.0f };
+            auto l         = (maximum + minimum) * V { 0.5f };
+            auto divisor   = one - abs((l + l) - one);
+            auto is_grey   = delta == V { 0.0f };
+
+            r = h;
+            g = select(is_grey, V { 0.0f }, delta / select(is_grey, one, divisor));
+            b = l;
+        }
+
+        template <typename V>
+        inline void hsl_to_rgb(V& h, V& s, V& l) noexcept
+        {
+            // f(n) = l - a * clamp(min(k - 3, 9 - k), -1, 1), k = (n + 12 * h) mod 12, a = s * min(l, 1 - l)
+            auto h12   = sector(h, 12.0f);
+            auto one   = V { 1.0f };
+            auto three = V { 3.0f };
+            auto nine  = V { 9.0f };
+            auto a     = s * min(l, one - l);
+            auto kr    = h12;
+            auto kg    = wrap(h12 + V { 8.0f }, 12.0f);
+            auto kb    = wrap(h12 + V { 4.0f }, 12.0f);
+            auto value = l;
+            auto minus = V { -1.0f };
+
+            h = value - a * max(minus, min(min(kr - three, nine - kr), one));
+            s = value - a * max(minus, min(min(kg - three, nine - kg), one));
+            l = value - a * max(minus, min(min(kb - three, nine - kb), one));
+        }
+
+        template <typename V>
+        inline void rgb_to_ycocg(V& r, V& g, V& b) noexcept
+        {
+            auto rb = (r + b) * V { 0.25f };
+            auto gg = g * V { 0.5f };
+            auto co = (r - b) * V { 0.5f };
+
+            r = rb + gg;
+            g = co;
+            b = gg - rb;
+        }
+
+        template <typename V>
+        inline void ycocg_to_rgb(V& y, V& co, V& cg) noexcept
+        {
+            auto t = y - cg;
+            auto r = t + co;
+            auto b = t - co;
+
+            co = y + cg;
+            y  = r;
+            cg = b;
+        }
+
+        /// Applies a kernel to every color of a structure of arrays, four colors at a time.
+        template <typename Kernel>
+        inline void for_each(const_color_planes source, color_planes destination, Kernel kernel) noexcept
+        {
+            Expects(source.g.size() == source.size() && source.b.size() == source.size());
+            Expects(destination.r.size() == source.size()
+                 && destination.g.size() == source.size()
+                 && destination.b.size() == source.size());
+
+            std::size_t count = source.size();
+            std::size_t i     = 0;
+
+            for (; i + lanes::size() <= count; i += lanes::size())
+            {
+                auto r = lanes::load(source.r.data() + i);
+                auto g = lanes::load(source.g.data() + i);
+                auto b = lanes::load(source.b.data() + i);
+
+                kernel(r, g, b);
+
+                r.store(destination.r.data() + i);
+                g.store(destination.g.data() + i);
+                b.store(destination.b.data() + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                auto r = lane { source.r[i] };
+                auto g = lane { source.g[i] };
+                auto b = lane { source.b[i] };
+
+                kernel(r, g, b);
+
+                destination.r[i] = r[0];
+                destination.g[i] = g[0];
+                destination.b[i] = b[0];
+            }
+        }
+
+        /// Applies a kernel to a single color, alpha is kept as is.
+        template <typename Kernel>
+        inline basic_color<float> apply(const basic_color<float>& value, Kernel kernel) noexcept
+        {
+            auto r = lane { value.r };
+            auto g = lane { value.g };
+            auto b = lane { value.b };
+
+            kernel(r, g, b);
+
+            return { r[0], g[0], b[0], value.a };
+        }
+
+        /// Linear sRGB to CIE XYZ, D65 white point.
+        inline constexpr float rgb_to_xyz_matrix[9] = { 0.4124564f, 0.3575761f, 0.1804375f
+                                                      , 0.2126729f, 0.7151522f, 0.0721750f
+                                                      , 0.0193339f, 0.1191920f, 0.9503041f };
+
+        /// CIE XYZ to linear sRGB, D65 white point.
+        inline constexpr float xyz_to_rgb_matrix[9] = {  3.2404542f, -1.5371385f, -0.4985314f
+                                                      , -0.9692660f,  1.8760108f,  0.0415560f
+                                                      ,  0.0556434f, -0.2040259f,  1.0572252f };
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // CONVERSIONS
+
+    /// Converts a color from RGB to HSV, with hue, saturation and value in [0, 1] for colors in [0, 1].
+    /// Alpha is kept as is.
+    /// \param value the RGB color.
+    /// \returns the HSV color.
+    inline basic_color<float> rgb_to_hsv(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_hsv(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as rgb_to_hsv does for a single color.
+    /// \param source the RGB colors.
+    /// \param destination the HSV colors, of the same size as the source; may be the source itself.
+    inline void rgb_to_hsv(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_hsv(r, g, b);
+        });
+    }
+
+    /// Converts a color from HSV to RGB, the hue wraps around.
+    /// Alpha is kept as is.
+    /// \param value the HSV color.
+    /// \returns the RGB color.
+    inline basic_color<float> hsv_to_rgb(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::hsv_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as hsv_to_rgb does for a single color.
+    /// \param source the HSV colors.
+    /// \param destination the RGB colors, of the same size as the source; may be the source itself.
+    inline void hsv_to_rgb(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::hsv_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts a color from RGB to HSL, with hue, saturation and lightness in [0, 1] for colors in [0, 1].
+    /// Alpha is kept as is.
+    /// \param value the RGB color.
+    /// \returns the HSL color.
+    inline basic_color<float> rgb_to_hsl(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_hsl(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as rgb_to_hsl does for a single color.
+    /// \param source the RGB colors.
+    /// \param destination the HSL colors, of the same size as the source; may be the source itself.
+    inline void rgb_to_hsl(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_hsl(r, g, b);
+        });
+    }
+
+    /// Converts a color from HSL to RGB, the hue wraps around.
+    /// Alpha is kept as is.
+    /// \param value the HSL color.
+    /// \returns the RGB color.
+    inline basic_color<float> hsl_to_rgb(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::hsl_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as hsl_to_rgb does for a single color.
+    /// \param source the HSL colors.
+    /// \param destination the RGB colors, of the same size as the source; may be the source itself.
+    inline void hsl_to_rgb(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::hsl_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts a color from RGB to YCoCg, with luma in [0, 1] and both chroma channels in [-0.5, 0.5] for colors in
+    /// [0, 1].
+    /// Alpha is kept as is.
+    /// \param value the RGB color.
+    /// \returns the YCoCg color.
+    inline basic_color<float> rgb_to_ycocg(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_ycocg(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as rgb_to_ycocg does for a single color.
+    /// \param source the RGB colors.
+    /// \param destination the YCoCg colors, of the same size as the source; may be the source itself.
+    inline void rgb_to_ycocg(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::rgb_to_ycocg(r, g, b);
+        });
+    }
+
+    /// Converts a color from YCoCg to RGB.
+    /// Alpha is kept as is.
+    /// \param value the YCoCg color.
+    /// \returns the RGB color.
+    inline basic_color<float> ycocg_to_rgb(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::ycocg_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as ycocg_to_rgb does for a single color.
+    /// \param source the YCoCg colors.
+    /// \param destination the RGB colors, of the same size as the source; may be the source itself.
+    inline void ycocg_to_rgb(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::ycocg_to_rgb(r, g, b);
+        });
+    }
+
+    /// Converts a color from linear sRGB to CIE XYZ, D65 white point.
+    /// Alpha is kept as is.
+    /// \param value the linear RGB color.
+    /// \returns the XYZ color.
+    inline basic_color<float> rgb_to_xyz(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::transform(r, g, b, detail::color_kernels::rgb_to_xyz_matrix);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as rgb_to_xyz does for a single color.
+    /// \param source the linear RGB colors.
+    /// \param destination the XYZ colors, of the same size as the source; may be the source itself.
+    inline void rgb_to_xyz(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::transform(r, g, b, detail::color_kernels::rgb_to_xyz_matrix);
+        });
+    }
+
+    /// Converts a color from CIE XYZ to linear sRGB, D65 white point.
+    /// Alpha is kept as is.
+    /// \param value the XYZ color.
+    /// \returns the linear RGB color.
+    inline basic_color<float> xyz_to_rgb(const basic_color<float>& value) noexcept
+    {
+        return detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::transform(r, g, b, detail::color_kernels::xyz_to_rgb_matrix);
+        });
+    }
+
+    /// Converts colors stored as a structure of arrays, as xyz_to_rgb does for a single color.
+    /// \param source the XYZ colors.
+    /// \param destination the linear RGB colors, of the same size as the source; may be the source itself.
+    inline void xyz_to_rgb(const_color_planes source, color_planes destination) noexcept
+    {
+        detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::color_kernels::transform(r, g, b, detail::color_kernels::xyz_to_rgb_matrix);
+        });
+    }
+}
+
+#endif // SCENER_MATH_COLOR_SPACE_HPP
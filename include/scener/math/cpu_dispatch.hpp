@@ -0,0 +1,108 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_CPU_DISPATCH_HPP
+#define SCENER_MATH_CPU_DISPATCH_HPP
+
+#include <cstdint>
+
+#include <gsl/span>
+
+#include "scener/math/bounding_box.hpp"
+#include "scener/math/bounding_frustrum.hpp"
+#include "scener/math/bounding_sphere.hpp"
+#include "scener/math/matrix.hpp"
+#include "scener/math/quaternion.hpp"
+#include "scener/math/vector.hpp"
+
+/// Batch kernels built for several instruction sets, chosen at run time from the features of the CPU.
+///
+/// Unlike the rest of the library these functions are not header-only: they are defined in the scener-math-dispatch
+/// library, where every kernel is compiled once per instruction set so a single binary runs the widest one the CPU
+/// and operating system support.
+namespace scener::math::dispatch
+{
+    /// Instruction sets the kernels are built for, from the narrowest to the widest.
+    enum class instruction_set : std::uint32_t
+    {
+        scalar = 0,     ///< Portable C++.
+        sse2   = 1,     ///< SSE2, the x86-64 baseline; SSE3 to SSE4.2 add nothing the kernels use.
+        avx2   = 2,     ///< AVX2 with FMA.
+        avx512 = 3      ///< AVX-512 foundation.
+    };
+
+    /// Gets the name of an instruction set.
+    /// \param value the instruction set.
+    /// \returns the name of the instruction set.
+    constexpr const char* to_string(instruction_set value) noexcept
+    {
+        switch (value)
+        {
+        case instruction_set::sse2:
+            return "sse2";
+        case instruction_set::avx2:
+            return "avx2";
+        case instruction_set::avx512:
+            return "avx512";
+        default:
+            return "scalar";
+        }
+    }
+
+    /// Gets the widest instruction set supported by the CPU, the operating system and the library build.
+    /// \returns the widest supported instruction set.
+    instruction_set supported_instruction_set() noexcept;
+
+    /// Gets the instruction set the kernels currently run with, the widest supported one unless selected otherwise.
+    /// \returns the instruction set the kernels run with.
+    instruction_set selected_instruction_set() noexcept;
+
+    /// Selects the instruction set the kernels run with, for testing and benchmarking; requests wider than the
+    /// supported instruction set fall back to it. Not meant to be called while kernels run on other threads.
+    /// \param value the requested instruction set.
+    /// \returns the selected instruction set.
+    instruction_set select_instruction_set(instruction_set value) noexcept;
+
+    /// Transforms four component vectors by the given matrix.
+    /// \param source the vectors to transform.
+    /// \param matrix the transformation matrix.
+    /// \param destination the transformed vectors, of the same size as the source; may be the source itself.
+    void transform(gsl::span<const vector4> source, const matrix4& matrix, gsl::span<vector4> destination) noexcept;
+
+    /// Multiplies matrices pairwise, as lhs[i] * rhs[i].
+    /// \param lhs the matrices on the left of the products.
+    /// \param rhs the matrices on the right of the products, of the same size as lhs.
+    /// \param result the products, of the same size as lhs; may be either operand.
+    void multiply(gsl::span<const matrix4> lhs, gsl::span<const matrix4> rhs, gsl::span<matrix4> result) noexcept;
+
+    /// Normalizes 3D vectors.
+    /// \param source the vectors to normalize.
+    /// \param destination the unit length vectors, of the same size as the source; may be the source itself.
+    void normalize(gsl::span<const vector3> source, gsl::span<vector3> destination) noexcept;
+
+    /// Interpolates quaternions pairwise, as quat::slerp(from[i], to[i], amount[i]).
+    /// \param from the start rotations.
+    /// \param to the end rotations, of the same size as from.
+    /// \param amount the interpolation amounts, of the same size as from.
+    /// \param result the interpolated rotations, of the same size as from.
+    void slerp(gsl::span<const quaternion> from
+             , gsl::span<const quaternion> to
+             , gsl::span<const float>      amount
+             , gsl::span<quaternion>       result) noexcept;
+
+    /// Computes the axis aligned box bounding a set of points.
+    /// \param points the points, at least one.
+    /// \returns the bounding box.
+    bounding_box bounds(gsl::span<const vector3> points) noexcept;
+
+    /// Culls bounding spheres against a frustum.
+    /// \param spheres the spheres to cull.
+    /// \param frustrum the frustum.
+    /// \param visible set to 1 for every sphere inside or intersecting the frustum, and to 0 for the others; of the
+    ///        same size as spheres.
+    void cull(gsl::span<const bounding_sphere> spheres
+            , const bounding_frustrum&         frustrum
+            , gsl::span<std::uint8_t>          visible) noexcept;
+}
+
+#endif // SCENER_MATH_CPU_DISPATCH_HPP
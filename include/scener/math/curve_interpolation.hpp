@@ -0,0 +1,21 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_CURVE_INTERPOLATION_HPP
+#define SCENER_MATH_CURVE_INTERPOLATION_HPP
+
+#include <cstdint>
+
+namespace scener::math
+{
+    /// Defines how the values of an animation curve are interpolated between two keys.
+    enum class curve_interpolation : std::uint32_t
+    {
+        step        = 0 ///< Holds the value of a key until the next one.
+      , linear      = 1 ///< Linear interpolation, slerp for rotations.
+      , hermite     = 2 ///< Cubic hermite spline, with a tangent given for every key.
+      , catmull_rom = 3 ///< Catmull-Rom spline through the keys.
+    };
+}
+
+#endif // SCENER_MATH_CURVE_INTERPOLATION_HPP
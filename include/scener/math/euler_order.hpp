@@ -0,0 +1,69 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_EULER_ORDER_HPP
+#define SCENER_MATH_EULER_ORDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scener::math
+{
+    /// Sequence of axes of a set of Euler angles.
+    ///
+    /// The name lists the axes in the order the rotations are applied, around the fixed axes of the coordinate
+    /// system: xyz rotates about x first, then about y and last about z, the same rotation as the intrinsic
+    /// z, y', x'' sequence. The angles of a set are stored in that same order; create_from_yaw_pitch_roll(yaw, pitch,
+    /// roll) is the zxy sequence with the angles { roll, pitch, yaw }.
+    enum class euler_order : std::uint32_t
+    {
+        xyz = 0  ///< Tait-Bryan angles, x, y and z.
+      , xzy = 1  ///< Tait-Bryan angles, x, z and y.
+      , yxz = 2  ///< Tait-Bryan angles, y, x and z.
+      , yzx = 3  ///< Tait-Bryan angles, y, z and x.
+      , zxy = 4  ///< Tait-Bryan angles, z, x and y.
+      , zyx = 5  ///< Tait-Bryan angles, z, y and x.
+      , xyx = 6  ///< Proper Euler angles, x, y and x.
+      , xzx = 7  ///< Proper Euler angles, x, z and x.
+      , yxy = 8  ///< Proper Euler angles, y, x and y.
+      , yzy = 9  ///< Proper Euler angles, y, z and y.
+      , zxz = 10 ///< Proper Euler angles, z, x and z.
+      , zyz = 11 ///< Proper Euler angles, z, y and z.
+    };
+
+    namespace detail
+    {
+        /// Axes of an Euler sequence, following Shoemake's "Euler Angle Conversion" (Graphics Gems IV): i and j are
+        /// the first two axes and k the remaining one; odd sequences are those where (i, j, k) is not a cyclic
+        /// permutation of (x, y, z), repeated ones rotate about i again at the end.
+        struct euler_axes
+        {
+            std::size_t i;
+            std::size_t j;
+            std::size_t k;
+            bool        odd;
+            bool        repeated;
+        };
+
+        constexpr euler_axes axes_of(euler_order order) noexcept
+        {
+            switch (order)
+            {
+            case euler_order::xyz: return { 0, 1, 2, false, false };
+            case euler_order::xzy: return { 0, 2, 1, true , false };
+            case euler_order::yxz: return { 1, 0, 2, true , false };
+            case euler_order::yzx: return { 1, 2, 0, false, false };
+            case euler_order::zxy: return { 2, 0, 1, false, false };
+            case euler_order::zyx: return { 2, 1, 0, true , false };
+            case euler_order::xyx: return { 0, 1, 2, false, true  };
+            case euler_order::xzx: return { 0, 2, 1, true , true  };
+            case euler_order::yxy: return { 1, 0, 2, true , true  };
+            case euler_order::yzy: return { 1, 2, 0, false, true  };
+            case euler_order::zxz: return { 2, 0, 1, false, true  };
+            default:               return { 2, 1, 0, true , true  };
+            }
+        }
+    }
+}
+
+#endif // SCENER_MATH_EULER_ORDER_HPP
@@ -0,0 +1,432 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_EXECUTOR_HPP
+#define SCENER_MATH_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+/// Executors run the batch operations of the library over ranges of items.
+///
+/// An executor is any type with a member parallel_for(count, grain, function) that calls function(begin, end) on
+/// disjoint ranges covering [0, count), and returns once every call has returned. Range bounds are multiples of grain,
+/// or count, so a range holds one or more whole chunks; serial execution is a single range. The function never throws.
+namespace scener::math
+{
+    /// Number of bytes, source and destination together, a batch operation processes per chunk: chunks stay well within
+    /// the L2 cache of a core while being large enough to amortize the scheduling.
+    constexpr std::size_t executor_chunk_bytes = 64 * 1024;
+
+    namespace detail
+    {
+        struct range_function
+        {
+            void operator()(std::size_t, std::size_t) const noexcept
+            {
+            }
+        };
+
+        template <typename T, typename = void>
+        struct is_executor : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_executor<T, std::void_t<decltype(std::declval<T&>().parallel_for(std::size_t(0)
+                                                                                  , std::size_t(0)
+                                                                                  , range_function { }))>>
+            : std::true_type
+        {
+        };
+
+        /// Gets whether the calling thread is running chunks of a parallel_for, where nested calls run serially.
+        inline bool& in_parallel_for() noexcept
+        {
+            thread_local bool value = false;
+
+            return value;
+        }
+    }
+
+    /// Checks whether a type meets the executor requirements.
+    template <typename T>
+    constexpr bool is_executor_v = detail::is_executor<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+    /// Non-owning reference to a callable taking a chunk index.
+    class chunk_function final
+    {
+    public:
+        /// Initializes a new instance of the chunk_function class.
+        /// \param function the callable, which must outlive the chunk_function.
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, chunk_function>>>
+        chunk_function(F& function) noexcept
+            : _context { &function }
+            , _invoke  { [](void* context, std::size_t chunk) { (*static_cast<F*>(context))(chunk); } }
+        {
+        }
+
+    public:
+        /// Runs the given chunk.
+        /// \param chunk the chunk index.
+        void operator()(std::size_t chunk) const
+        {
+            _invoke(_context, chunk);
+        }
+
+    private:
+        void* _context;
+        void (*_invoke)(void*, std::size_t);
+    };
+
+    /// Runs every range on the calling thread, in a single call.
+    struct serial_executor final
+    {
+        /// Calls the function once over the whole range.
+        /// \param count the number of items.
+        /// \param grain unused.
+        /// \param function the function to call with the range bounds.
+        template <typename F>
+        void parallel_for(std::size_t count, std::size_t grain, F&& function) const
+        {
+            static_cast<void>(grain);
+
+            if (count != 0)
+            {
+                function(std::size_t(0), count);
+            }
+        }
+    };
+
+    /// Adapts a user provided scheduler, such as the job system of an engine, to the executor requirements.
+    ///
+    /// The dispatch callable is called as dispatch(chunk_count, task), with task a chunk_function, and must call
+    /// task(chunk) exactly once for every chunk in [0, chunk_count), on any thread, returning when all of them have
+    /// returned. Inputs of a single chunk are run on the calling thread without reaching the scheduler.
+    template <typename Dispatch>
+    class executor_adapter final
+    {
+    public:
+        /// Initializes a new instance of the executor_adapter class.
+        /// \param dispatch the scheduler entry point.
+        explicit executor_adapter(Dispatch dispatch)
+            : _dispatch { std::move(dispatch) }
+        {
+        }
+
+    public:
+        /// Runs the function over chunks of the range through the scheduler.
+        /// \param count the number of items.
+        /// \param grain the number of items per chunk.
+        /// \param function the function to call with the bounds of every chunk.
+        template <typename F>
+        void parallel_for(std::size_t count, std::size_t grain, F&& function)
+        {
+            grain = std::max<std::size_t>(grain, 1);
+
+            if (count <= grain)
+            {
+                serial_executor { }.parallel_for(count, grain, function);
+                return;
+            }
+
+            auto task = [&](std::size_t chunk)
+            {
+                function(chunk * grain, std::min(count, (chunk + 1) * grain));
+            };
+
+            _dispatch((count + grain - 1) / grain, chunk_function { task });
+        }
+
+    private:
+        Dispatch _dispatch;
+    };
+
+    /// Runs ranges on a pool of worker threads and on the calling thread.
+    ///
+    /// Every participant starts on its own contiguous share of the chunks, taking them from the front, and once done
+    /// steals single chunks from the back of the shares of the others. The shares are claimed with atomic operations
+    /// only; the pool lock is taken to start and finish a parallel_for, never per chunk. Calls made from inside a chunk
+    /// run serially, and calls from different threads run one after the other.
+    class thread_pool_executor final
+    {
+    public:
+        /// Initializes a new instance of the thread_pool_executor class.
+        /// \param concurrency the number of threads running chunks, counting the thread calling parallel_for.
+        explicit thread_pool_executor(std::size_t concurrency = std::max(1u, std::thread::hardware_concurrency()))
+            : _shares     { std::make_unique<share[]>(std::max<std::size_t>(concurrency, 1)) }
+            , _threads    { }
+            , _job        { nullptr }
+            , _generation { 0 }
+            , _running    { 0 }
+            , _stop       { false }
+        {
+            for (std::size_t i = 1; i < concurrency; ++i)
+            {
+                _threads.emplace_back([this, i] { work(i); });
+            }
+        }
+
+        thread_pool_executor(const thread_pool_executor&) = delete;
+        thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+        /// Stops and joins the worker threads.
+        ~thread_pool_executor()
+        {
+            {
+                std::lock_guard<std::mutex> lock { _mutex };
+
+                _stop = true;
+            }
+
+            _wake.notify_all();
+
+            for (auto& thread : _threads)
+            {
+                thread.join();
+            }
+        }
+
+    public:
+        /// Gets the number of threads running chunks, counting the thread calling parallel_for.
+        /// \returns the number of threads running chunks.
+        std::size_t concurrency() const noexcept
+        {
+            return _threads.size() + 1;
+        }
+
+        /// Runs the function over chunks of the range on the pool threads.
+        /// \param count the number of items.
+        /// \param grain the number of items per chunk.
+        /// \param function the function to call with the bounds of every chunk.
+        template <typename F>
+        void parallel_for(std::size_t count, std::size_t grain, F&& function)
+        {
+            grain = std::max<std::size_t>(grain, 1);
+
+            if (count <= grain || _threads.empty() || detail::in_parallel_for())
+            {
+                serial_executor { }.parallel_for(count, grain, function);
+                return;
+            }
+
+            auto chunks = (count + grain - 1) / grain;
+
+            Expects(chunks <= 0xFFFFFFFFu);
+
+            auto task = [&](std::size_t chunk)
+            {
+                function(chunk * grain, std::min(count, (chunk + 1) * grain));
+            };
+
+            job current { chunk_function { task } };
+
+            std::lock_guard<std::mutex> submit { _submit };
+
+            auto participants = concurrency();
+
+            for (std::size_t i = 0; i < participants; ++i)
+            {
+                _shares[i].bounds.store(pack(chunks * i / participants, chunks * (i + 1) / participants)
+                                      , std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock { _mutex };
+
+                _job     = &current;
+                _running = _threads.size();
+                ++_generation;
+            }
+
+            _wake.notify_all();
+
+            run(0);
+
+            std::unique_lock<std::mutex> lock { _mutex };
+
+            _done.wait(lock, [this] { return _running == 0; });
+            _job = nullptr;
+        }
+
+    private:
+        struct job
+        {
+            chunk_function task;
+        };
+
+        /// The chunks left of a participant, [begin, end) packed as begin in the low bits and end in the high bits.
+        struct alignas(64) share
+        {
+            std::atomic<std::uint64_t> bounds { 0 };
+        };
+
+        static std::uint64_t pack(std::size_t begin, std::size_t end) noexcept
+        {
+            return std::uint64_t(begin) | (std::uint64_t(end) << 32);
+        }
+
+        /// Claims the first chunk of a share, when Front, or the last one.
+        template <bool Front>
+        bool claim(share& target, std::size_t& chunk) noexcept
+        {
+            auto bounds = target.bounds.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                auto begin = std::size_t(bounds & 0xFFFFFFFFu);
+                auto end   = std::size_t(bounds >> 32);
+
+                if (begin >= end)
+                {
+                    return false;
+                }
+
+                auto next = Front ? pack(begin + 1, end) : pack(begin, end - 1);
+
+                if (target.bounds.compare_exchange_weak(bounds, next, std::memory_order_acq_rel))
+                {
+                    chunk = Front ? begin : end - 1;
+                    return true;
+                }
+            }
+        }
+
+        void run(std::size_t index) noexcept
+        {
+            auto& in_parallel_for = detail::in_parallel_for();
+            auto  participants    = concurrency();
+            auto  task            = _job->task;
+            auto  chunk           = std::size_t(0);
+
+            in_parallel_for = true;
+
+            while (claim<true>(_shares[index], chunk))
+            {
+                task(chunk);
+            }
+
+            for (std::size_t i = 1; i < participants; ++i)
+            {
+                auto& victim = _shares[(index + i) % participants];
+
+                while (claim<false>(victim, chunk))
+                {
+                    task(chunk);
+                }
+            }
+
+            in_parallel_for = false;
+        }
+
+        void work(std::size_t index) noexcept
+        {
+            auto generation = std::uint64_t(0);
+
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock { _mutex };
+
+                    _wake.wait(lock, [&] { return _stop || _generation != generation; });
+
+                    if (_stop)
+                    {
+                        return;
+                    }
+
+                    generation = _generation;
+                }
+
+                run(index);
+
+                bool last;
+
+                {
+                    std::lock_guard<std::mutex> lock { _mutex };
+
+                    last = (--_running == 0);
+                }
+
+                if (last)
+                {
+                    _done.notify_one();
+                }
+            }
+        }
+
+    private:
+        std::unique_ptr<share[]> _shares;
+        std::vector<std::thread> _threads;
+        std::mutex               _submit;
+        std::mutex               _mutex;
+        std::condition_variable  _wake;
+        std::condition_variable  _done;
+        job*                     _job;
+        std::uint64_t            _generation;
+        std::size_t              _running;
+        bool                     _stop;
+    };
+
+    /// Runs a function over a range with the given executor, split in chunks of about executor_chunk_bytes; inputs
+    /// of a single chunk are run directly on the calling thread.
+    /// \param executor the executor.
+    /// \param count the number of items.
+    /// \param bytes_per_item the number of bytes read and written per item.
+    /// \param function the function to call with the bounds of every chunk.
+    template <typename Executor, typename F, typename = std::enable_if_t<is_executor_v<Executor>>>
+    void parallel_for(Executor&& executor, std::size_t count, std::size_t bytes_per_item, F&& function)
+    {
+        auto grain = std::max<std::size_t>(executor_chunk_bytes / std::max<std::size_t>(bytes_per_item, 1), 1);
+
+        if (count <= grain)
+        {
+            serial_executor { }.parallel_for(count, grain, function);
+        }
+        else
+        {
+            executor.parallel_for(count, grain, function);
+        }
+    }
+
+    /// Runs a batch operation over equally sized arrays with the given executor, calling it on matching subranges of
+    /// every array. Any batch operation of the library can be run this way, binding its non-array arguments in the
+    /// callable, for example parallel_batch(pool, [&](auto s, auto d) { vector::transform(s, matrix, d); }, s, d).
+    /// \param executor the executor.
+    /// \param batch the batch operation, called with a span over the same subrange of every array.
+    /// \param arrays the arrays, of the same size.
+    template <typename    Executor
+            , typename    Batch
+            , typename... Arrays
+            , typename = std::enable_if_t<is_executor_v<Executor>>>
+    void parallel_batch(Executor&& executor, Batch&& batch, Arrays&&... arrays)
+    {
+        static_assert(sizeof...(Arrays) > 0, "at least one array is required");
+
+        auto views = std::make_tuple(gsl::span<std::remove_pointer_t<decltype(arrays.data())>>(arrays)...);
+        auto count = std::get<0>(views).size();
+        auto bytes = (sizeof(*arrays.data()) + ...);
+
+        Expects(((std::size_t(arrays.size()) == count) && ...));
+
+        parallel_for(executor, count, bytes, [&](std::size_t begin, std::size_t end)
+        {
+            std::apply([&](auto... view) { batch(view.subspan(begin, end - begin)...); }, views);
+        });
+    }
+}
+
+#endif // SCENER_MATH_EXECUTOR_HPP
@@ -0,0 +1,449 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_FAST_MATH_HPP
+#define SCENER_MATH_FAST_MATH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_angle.hpp"
+#include "scener/math/simd.hpp"
+
+/// Polynomial approximations of the elementary functions, for float, trading accuracy for speed.
+///
+/// Every function has a scalar form and a batch form over spans, which processes four values at a time with SSE on
+/// x86-64; both evaluate the same polynomials. The precision template argument selects the accuracy tier:
+///
+///   precision::low   errors around 1e-4, with shorter polynomials.
+///   precision::high  errors around 1e-7, close to the rounding error of float.
+///
+/// Errors are absolute for sincos, atan2 and acos and relative for exp and log. The approximations do not set errno
+/// nor raise floating point exceptions.
+namespace scener::math::fast
+{
+    /// Accuracy tiers of the approximations.
+    enum class precision : std::uint32_t
+    {
+        low
+      , high
+    };
+
+    namespace detail
+    {
+        using lanes  = math::detail::simd<float, 4, math::detail::simd_abi::fixed>;
+        using scalar = math::detail::simd<float, 1, math::detail::simd_abi::scalar>;
+
+        constexpr float pi_f        = 3.14159265358979323846f;
+        constexpr float pi_over_2_f = 1.57079632679489661923f;
+        constexpr float pi_over_4_f = 0.78539816339744830962f;
+        constexpr float infinity_f  = std::numeric_limits<float>::infinity();
+
+        /// Evaluates a polynomial with Horner's rule.
+        /// \param x the variable.
+        /// \param c the coefficients, highest degree first.
+        template <typename V, std::size_t N>
+        inline V polynomial(const V& x, const float (&c)[N]) noexcept
+        {
+            auto result = V { c[0] };
+
+            for (std::size_t i = 1; i < N; ++i)
+            {
+                result = fma(result, x, V { c[i] });
+            }
+
+            return result;
+        }
+
+        template <precision P, typename V>
+        inline void sincos(const V& x, V& sin, V& cos) noexcept
+        {
+            // x = k pi/2 + r, with pi/2 split in three parts (Cody and Waite) so k times each part is exact for
+            // |k| < 2^16
+            auto k = round(x * V { 0.636619772367581343f });
+            auto r = fma(k, V { -1.5703125f }, x);
+
+            r = fma(k, V { -4.837512969970703125e-4f }, r);
+            r = fma(k, V { -7.54978995489188216e-8f }, r);
+
+            auto z = r * r;
+            auto s = V { };
+            auto c = V { };
+
+            if constexpr (P == precision::high)
+            {
+                // Cephes sinf and cosf polynomials over [-pi/4, pi/4]
+                s = fma(polynomial(z, { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f }) * z, r, r);
+                c = polynomial(z, { 2.443315711809948e-5f
+                                  , -1.388731625493765e-3f
+                                  , 4.166664568298827e-2f
+                                  , -0.5f
+                                  , 1.0f });
+            }
+            else
+            {
+                s = fma(polynomial(z, { 8.153086e-3f, -1.6662838e-1f }) * z, r, r);
+                c = polynomial(z, { 4.048954e-2f, -4.9977654e-1f, 1.0f });
+            }
+
+            // Quadrant k mod 4, using floor(k / 4) = round(k / 4 - 3 / 8) for integral k
+            auto q       = k - V { 4.0f } * round(fma(k, V { 0.25f }, V { -0.375f }));
+            auto odd     = (q == V { 1.0f }) | (q == V { 3.0f });
+            auto ps      = select(odd, c, s);
+            auto pc      = select(odd, s, c);
+            auto invalid = !(abs(x) < V { infinity_f });
+            auto nan     = V { std::numeric_limits<float>::quiet_NaN() };
+
+            sin = select(invalid, nan, select(q >= V { 2.0f }, -ps, ps));
+            cos = select(invalid, nan, select((q == V { 1.0f }) | (q == V { 2.0f }), -pc, pc));
+        }
+
+        template <precision P, typename V>
+        inline V atan2(const V& y, const V& x) noexcept
+        {
+            // atan of the ratio of the smaller and the larger coordinate, in [0, 1], moved to the right octant after
+            auto ax = abs(x);
+            auto ay = abs(y);
+            auto hi = max(ax, ay);
+            auto t  = select(hi == V { 0.0f }, V { 0.0f }, min(ax, ay) / hi);
+            auto a  = V { };
+
+            if constexpr (P == precision::high)
+            {
+                // atan(t) = pi/4 + atan((t - 1) / (t + 1)) above tan(pi/8), then the Cephes atanf polynomial
+                auto reduce = t > V { 0.41421356237309504880f };
+
+                t = select(reduce, (t - V { 1.0f }) / (t + V { 1.0f }), t);
+
+                auto z = t * t;
+                auto p = polynomial(z, { 8.05374449538e-2f
+                                       , -1.38776856032e-1f
+                                       , 1.99777106478e-1f
+                                       , -3.33329491539e-1f });
+
+                a = fma(p * z, t, t) + select(reduce, V { pi_over_4_f }, V { 0.0f });
+            }
+            else
+            {
+                a = polynomial(t * t, { -3.9004239e-2f, 1.4629043e-1f, -3.2118543e-1f, 9.992148e-1f }) * t;
+            }
+
+            a = select(ay > ax, V { pi_over_2_f } - a, a);
+            a = select(x < V { 0.0f }, V { pi_f } - a, a);
+
+            return select(y < V { 0.0f }, -a, a);
+        }
+
+        template <precision P, typename V>
+        inline V acos(const V& x) noexcept
+        {
+            auto ax       = abs(x);
+            auto negative = x < V { 0.0f };
+
+            if constexpr (P == precision::high)
+            {
+                // acos(x) = pi/2 - asin(x) up to |x| = 1/2 and 2 asin(sqrt((1 - |x|) / 2)) above, with the Cephes
+                // asinf polynomial
+                auto big = ax > V { 0.5f };
+                auto z   = select(big, (V { 1.0f } - ax) * V { 0.5f }, x * x);
+                auto s   = select(big, sqrt(z), ax);
+                auto p   = polynomial(z, { 4.2163199048e-2f
+                                         , 2.4181311049e-2f
+                                         , 4.5470025998e-2f
+                                         , 7.4953002686e-2f
+                                         , 1.6666752422e-1f });
+                auto a   = fma(p * z, s, s);
+                auto lo  = select(negative, V { pi_over_2_f } + a, V { pi_over_2_f } - a);
+                auto hi  = select(negative, V { pi_f } - (a + a), a + a);
+
+                return select(big, hi, lo);
+            }
+            else
+            {
+                // Abramowitz and Stegun 4.4.45
+                auto p = polynomial(ax, { -0.0187293f, 0.0742610f, -0.2121144f, 1.5707288f });
+                auto a = sqrt(V { 1.0f } - ax) * p;
+
+                return select(negative, V { pi_f } - a, a);
+            }
+        }
+
+        template <precision P, typename V>
+        inline V exp(const V& x) noexcept
+        {
+            // x = n ln(2) + r, |r| <= ln(2) / 2, with ln(2) split in two parts; e^x = 2^n e^r
+            auto c = min(max(x, V { -103.97208f }), V { 88.72283f });
+            auto n = round(c * V { 1.44269504088896341f });
+            auto r = fma(n, V { -0.693359375f }, c);
+
+            r = fma(n, V { 2.12194440e-4f }, r);
+
+            auto p = V { };
+
+            if constexpr (P == precision::high)
+            {
+                // Cephes expf polynomial
+                p = polynomial(r, { 1.9875691500e-4f
+                                  , 1.3981999507e-3f
+                                  , 8.3334519073e-3f
+                                  , 4.1665795894e-2f
+                                  , 1.6666665459e-1f
+                                  , 5.0000001201e-1f });
+            }
+            else
+            {
+                p = polynomial(r, { 1.6662658e-1f, 5.0393738e-1f });
+            }
+
+            // n is in [-150, 128]: scaling in two steps keeps both powers of two normal
+            auto h      = round(n * V { 0.5f });
+            auto result = ldexp(ldexp(fma(p * r, r, r) + V { 1.0f }, h), n - h);
+
+            result = select(x > V { 88.72283f }, V { infinity_f }, result);
+            result = select(x < V { -103.97208f }, V { 0.0f }, result);
+
+            return select(x != x, x, result);
+        }
+
+        template <precision P, typename V>
+        inline V log(const V& x) noexcept
+        {
+            // x = m 2^e with m in [sqrt(1/2), sqrt(2)); log(x) = e ln(2) + log(m). Subnormals are scaled up first.
+            auto tiny  = x < V { std::numeric_limits<float>::min() };
+            auto v     = select(tiny, x * V { 8388608.0f }, x);
+            auto e     = V { };
+            auto m     = frexp(v, e);
+            auto small = m < V { 0.70710678118654752440f };
+
+            m = select(small, m + m, m);
+            e = select(small, e - V { 1.0f }, e) - select(tiny, V { 23.0f }, V { 0.0f });
+
+            auto f      = m - V { 1.0f };
+            auto result = V { };
+
+            if constexpr (P == precision::high)
+            {
+                // Cephes logf polynomial, with ln(2) split in two parts
+                auto z = f * f;
+                auto p = polynomial(f, { 7.0376836292e-2f
+                                       , -1.1514610310e-1f
+                                       , 1.1676998740e-1f
+                                       , -1.2420140846e-1f
+                                       , 1.4249322787e-1f
+                                       , -1.6668057665e-1f
+                                       , 2.0000714765e-1f
+                                       , -2.4999993993e-1f
+                                       , 3.3333331174e-1f });
+                auto y = fma(e, V { -2.12194440e-4f }, p * z * f);
+
+                result = fma(e, V { 0.693359375f }, f + fma(z, V { -0.5f }, y));
+            }
+            else
+            {
+                // log(m) = 2 atanh(s), s = (m - 1) / (m + 1)
+                auto s = f / (m + V { 1.0f });
+
+                result = fma(polynomial(s * s, { 6.817262e-1f, 1.9998882f }), s, e * V { 0.69314718055994530942f });
+            }
+
+            result = select(x == V { 0.0f }, V { -infinity_f }, result);
+            result = select(x == V { infinity_f }, x, result);
+
+            return select(!(x >= V { 0.0f }), V { std::numeric_limits<float>::quiet_NaN() }, result);
+        }
+
+        /// Applies a kernel to every value of the source, four values at a time.
+        template <typename Kernel>
+        inline void for_each(gsl::span<const float> source, gsl::span<float> destination, Kernel&& kernel) noexcept
+        {
+            Expects(source.size() == destination.size());
+
+            constexpr std::size_t width = lanes::size();
+
+            auto        count = static_cast<std::size_t>(source.size());
+            std::size_t i     = 0;
+
+            for (; i + width <= count; i += width)
+            {
+                kernel(lanes::load(source.data() + i)).store(destination.data() + i);
+            }
+
+            for (; i < count; ++i)
+            {
+                destination[i] = kernel(scalar { source[i] })[0];
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // SCALAR FUNCTIONS
+
+    /// Computes the sine and cosine of an angle.
+    /// \param x the angle, in radians; the error grows past |x| = 1e5.
+    /// \returns the sine and the cosine of the angle, in this order.
+    template <precision P = precision::high>
+    inline std::pair<float, float> sincos(float x) noexcept
+    {
+        auto s = detail::scalar { };
+        auto c = detail::scalar { };
+
+        detail::sincos<P>(detail::scalar { x }, s, c);
+
+        return { s[0], c[0] };
+    }
+
+    /// Computes the sine and cosine of an angle.
+    /// \param angle the angle; the error grows past 1e5 radians.
+    /// \returns the sine and the cosine of the angle, in this order.
+    template <precision P = precision::high, typename Unit>
+    inline std::pair<float, float> sincos(const basic_angle<float, Unit>& angle) noexcept
+    {
+        return sincos<P>(basic_radians<float>(angle).value);
+    }
+
+    /// Computes the angle of the point (x, y) from the positive x axis.
+    /// \param y the y coordinate.
+    /// \param x the x coordinate.
+    /// \returns the angle, in [-pi, pi]; zero when both coordinates are zero.
+    template <precision P = precision::high>
+    inline basic_radians<float> atan2(float y, float x) noexcept
+    {
+        return { detail::atan2<P>(detail::scalar { y }, detail::scalar { x })[0] };
+    }
+
+    /// Computes the arc cosine of a value.
+    /// \param x the value, in [-1, 1].
+    /// \returns the angle, in [0, pi]; not a number when x is outside [-1, 1].
+    template <precision P = precision::high>
+    inline basic_radians<float> acos(float x) noexcept
+    {
+        return { detail::acos<P>(detail::scalar { x })[0] };
+    }
+
+    /// Computes e raised to the given power.
+    /// \param x the exponent.
+    /// \returns e^x; zero below -103.97 and infinity above 88.72, where the result no longer fits a float.
+    template <precision P = precision::high>
+    inline float exp(float x) noexcept
+    {
+        return detail::exp<P>(detail::scalar { x })[0];
+    }
+
+    /// Computes the natural logarithm of a value.
+    /// \param x the value.
+    /// \returns the logarithm of x; minus infinity when x is zero and not a number when x is negative.
+    template <precision P = precision::high>
+    inline float log(float x) noexcept
+    {
+        return detail::log<P>(detail::scalar { x })[0];
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // BATCH FUNCTIONS
+
+    /// Computes the sine and cosine of every angle.
+    /// \param angles the angles, in radians.
+    /// \param sin the sines, of the same size as angles.
+    /// \param cos the cosines, of the same size as angles.
+    template <precision P = precision::high>
+    inline void sincos(gsl::span<const float> angles, gsl::span<float> sin, gsl::span<float> cos) noexcept
+    {
+        Expects(angles.size() == sin.size() && angles.size() == cos.size());
+
+        constexpr std::size_t width = detail::lanes::size();
+
+        auto        count = static_cast<std::size_t>(angles.size());
+        std::size_t i     = 0;
+
+        for (; i + width <= count; i += width)
+        {
+            auto s = detail::lanes { };
+            auto c = detail::lanes { };
+
+            detail::sincos<P>(detail::lanes::load(angles.data() + i), s, c);
+
+            s.store(sin.data() + i);
+            c.store(cos.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            std::tie(sin[i], cos[i]) = fast::sincos<P>(angles[i]);
+        }
+    }
+
+    /// Computes the sine and cosine of every angle.
+    /// \param angles the angles.
+    /// \param sin the sines, of the same size as angles.
+    /// \param cos the cosines, of the same size as angles.
+    template <precision P = precision::high>
+    inline void sincos(gsl::span<const basic_radians<float>> angles
+                     , gsl::span<float>                      sin
+                     , gsl::span<float>                      cos) noexcept
+    {
+        static_assert(sizeof(basic_radians<float>) == sizeof(float), "radians must be layout compatible with float");
+
+        sincos<P>(gsl::span<const float>(reinterpret_cast<const float*>(angles.data()), angles.size()), sin, cos);
+    }
+
+    /// Computes the angle of every point (x, y) from the positive x axis.
+    /// \param y the y coordinates.
+    /// \param x the x coordinates, of the same size as y.
+    /// \param result the angles in radians, of the same size as y; may be either input.
+    template <precision P = precision::high>
+    inline void atan2(gsl::span<const float> y, gsl::span<const float> x, gsl::span<float> result) noexcept
+    {
+        Expects(y.size() == x.size() && y.size() == result.size());
+
+        constexpr std::size_t width = detail::lanes::size();
+
+        auto        count = static_cast<std::size_t>(y.size());
+        std::size_t i     = 0;
+
+        for (; i + width <= count; i += width)
+        {
+            detail::atan2<P>(detail::lanes::load(y.data() + i), detail::lanes::load(x.data() + i))
+                .store(result.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            result[i] = fast::atan2<P>(y[i], x[i]).value;
+        }
+    }
+
+    /// Computes the arc cosine of every value.
+    /// \param source the values, in [-1, 1].
+    /// \param result the angles in radians, of the same size as source; may be the source itself.
+    template <precision P = precision::high>
+    inline void acos(gsl::span<const float> source, gsl::span<float> result) noexcept
+    {
+        detail::for_each(source, result, [](const auto& x) { return detail::acos<P>(x); });
+    }
+
+    /// Computes e raised to every value.
+    /// \param source the exponents.
+    /// \param result the powers, of the same size as source; may be the source itself.
+    template <precision P = precision::high>
+    inline void exp(gsl::span<const float> source, gsl::span<float> result) noexcept
+    {
+        detail::for_each(source, result, [](const auto& x) { return detail::exp<P>(x); });
+    }
+
+    /// Computes the natural logarithm of every value.
+    /// \param source the values.
+    /// \param result the logarithms, of the same size as source; may be the source itself.
+    template <precision P = precision::high>
+    inline void log(gsl::span<const float> source, gsl::span<float> result) noexcept
+    {
+        detail::for_each(source, result, [](const auto& x) { return detail::log<P>(x); });
+    }
+}
+
+#endif // SCENER_MATH_FAST_MATH_HPP
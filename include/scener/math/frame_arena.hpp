@@ -0,0 +1,266 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_FRAME_ARENA_HPP
+#define SCENER_MATH_FRAME_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <gsl/assert>
+#include <gsl/span>
+
+namespace scener::math
+{
+    /// Monotonic allocator for the temporary buffers of batch operations.
+    ///
+    /// Allocations bump a pointer in a single block and are never freed one by one: scratch_scope rewinds the arena
+    /// when a batch operation returns, and reset marks the end of a frame. Requests that do not fit in the block are
+    /// served from the heap and released on rewind; at the next reset the block grows to the peak usage seen so far, so
+    /// a steady workload stops reaching the heap after its first frame.
+    class frame_arena final
+    {
+    public:
+        /// Usage statistics of a frame arena.
+        struct statistics
+        {
+            std::size_t used        = 0;    ///< Bytes currently allocated, including padding.
+            std::size_t peak        = 0;    ///< Largest number of bytes allocated at once.
+            std::size_t capacity    = 0;    ///< Size in bytes of the arena block.
+            std::size_t allocations = 0;    ///< Allocations since the last reset.
+            std::size_t overflows   = 0;    ///< Allocations since the last reset served from the heap.
+            std::size_t frames      = 0;    ///< Number of resets.
+        };
+
+        /// A position in the arena to rewind to.
+        struct marker
+        {
+            std::size_t offset;
+            std::size_t overflow_count;
+            std::size_t used;
+        };
+
+    public:
+        /// Initializes a new instance of the frame_arena class.
+        /// \param capacity the initial size in bytes of the arena block.
+        explicit frame_arena(std::size_t capacity = 256 * 1024)
+            : _block    { nullptr }
+            , _offset   { 0 }
+            , _overflow { }
+            , _stats    { }
+        {
+            grow(capacity);
+        }
+
+        frame_arena(const frame_arena&) = delete;
+        frame_arena& operator=(const frame_arena&) = delete;
+
+        /// Releases all the memory owned by the arena.
+        ~frame_arena()
+        {
+            release_overflow(0);
+            release_block();
+        }
+
+    public:
+        /// Gets the arena usage statistics.
+        /// \returns the arena usage statistics.
+        const statistics& stats() const noexcept
+        {
+            return _stats;
+        }
+
+        /// Allocates uninitialized memory.
+        /// \param size the number of bytes to allocate.
+        /// \param alignment the alignment of the allocation, a power of two.
+        /// \returns a pointer to the allocated memory, valid until the arena is rewound past it or reset.
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+        {
+            Expects(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+            auto address = reinterpret_cast<std::uintptr_t>(_block) + _offset;
+            auto padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+
+            ++_stats.allocations;
+
+            if (padding + size <= _stats.capacity - _offset)
+            {
+                _offset += padding + size;
+
+                return track(reinterpret_cast<void*>(address + padding), padding + size);
+            }
+
+            auto result = ::operator new(std::max<std::size_t>(size, 1), std::align_val_t { alignment });
+
+            ++_stats.overflows;
+
+            try
+            {
+                _overflow.push_back({ result, size, alignment });
+            }
+            catch (...)
+            {
+                ::operator delete(result, std::align_val_t { alignment });
+                throw;
+            }
+
+            return track(result, size);
+        }
+
+        /// Allocates an uninitialized array of trivial objects.
+        /// \param count the number of objects.
+        /// \returns the allocated array, valid until the arena is rewound past it or reset.
+        template <typename T>
+        gsl::span<T> allocate(std::size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "the arena never runs destructors");
+
+            Expects(count <= (std::size_t(-1) / sizeof(T)));
+
+            return { static_cast<T*>(allocate(count * sizeof(T), alignof(T))), count };
+        }
+
+        /// Gets the current position in the arena.
+        /// \returns the current position in the arena.
+        marker mark() const noexcept
+        {
+            return { _offset, _overflow.size(), _stats.used };
+        }
+
+        /// Releases every allocation made after the given position was taken.
+        /// \param position a position taken with mark since the last reset.
+        void rewind(const marker& position) noexcept
+        {
+            Expects(position.offset <= _offset && position.overflow_count <= _overflow.size());
+
+            release_overflow(position.overflow_count);
+
+            _offset     = position.offset;
+            _stats.used = position.used;
+        }
+
+        /// Releases every allocation, at a frame boundary, and grows the arena block when the last frames did not fit.
+        void reset()
+        {
+            release_overflow(0);
+
+            _offset             = 0;
+            _stats.used         = 0;
+            _stats.allocations  = 0;
+            _stats.overflows    = 0;
+            _stats.frames      += 1;
+
+            if (_stats.peak > _stats.capacity)
+            {
+                grow(_stats.peak);
+            }
+        }
+
+    private:
+        struct overflow_block
+        {
+            void*       pointer;
+            std::size_t size;
+            std::size_t alignment;
+        };
+
+        static constexpr std::size_t block_alignment = 64;
+
+        void* track(void* pointer, std::size_t size) noexcept
+        {
+            _stats.used += size;
+            _stats.peak  = std::max(_stats.peak, _stats.used);
+
+            return pointer;
+        }
+
+        void grow(std::size_t capacity)
+        {
+            // Rounded to whole cache lines, with room for alignment padding
+            capacity = (capacity + 2 * block_alignment - 1) & ~(block_alignment - 1);
+
+            // Allocated before the old block is released, so a failed allocation leaves the arena as it was
+            auto block = static_cast<std::byte*>(::operator new(capacity, std::align_val_t { block_alignment }));
+
+            release_block();
+
+            _block          = block;
+            _stats.capacity = capacity;
+        }
+
+        void release_block() noexcept
+        {
+            ::operator delete(_block, std::align_val_t { block_alignment });
+
+            _block          = nullptr;
+            _stats.capacity = 0;
+        }
+
+        void release_overflow(std::size_t count) noexcept
+        {
+            while (_overflow.size() > count)
+            {
+                ::operator delete(_overflow.back().pointer, std::align_val_t { _overflow.back().alignment });
+                _overflow.pop_back();
+            }
+        }
+
+    private:
+        std::byte*                  _block;
+        std::size_t                 _offset;
+        std::vector<overflow_block> _overflow;
+        statistics                  _stats;
+    };
+
+    /// Rewinds an arena to the position it had when the scope was created.
+    class scratch_scope final
+    {
+    public:
+        /// Initializes a new instance of the scratch_scope class.
+        /// \param arena the arena to allocate from.
+        explicit scratch_scope(frame_arena& arena) noexcept
+            : _arena  { arena }
+            , _marker { arena.mark() }
+        {
+        }
+
+        scratch_scope(const scratch_scope&) = delete;
+        scratch_scope& operator=(const scratch_scope&) = delete;
+
+        /// Releases every allocation made through the arena since the scope was created.
+        ~scratch_scope()
+        {
+            _arena.rewind(_marker);
+        }
+
+    public:
+        /// Allocates an uninitialized array of trivial objects, released when the scope ends.
+        /// \param count the number of objects.
+        /// \returns the allocated array.
+        template <typename T>
+        gsl::span<T> allocate(std::size_t count)
+        {
+            return _arena.allocate<T>(count);
+        }
+
+    private:
+        frame_arena&        _arena;
+        frame_arena::marker _marker;
+    };
+
+    /// Gets the frame arena of the calling thread, used by batch operations for their temporary buffers.
+    /// Call reset on it once per frame to release the memory and collect its statistics.
+    /// \returns the frame arena of the calling thread.
+    inline frame_arena& thread_frame_arena()
+    {
+        thread_local frame_arena arena;
+
+        return arena;
+    }
+}
+
+#endif // SCENER_MATH_FRAME_ARENA_HPP
@@ -0,0 +1,323 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_HALF_HPP
+#define SCENER_MATH_HALF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_vector.hpp"
+#include "scener/math/type_traits.hpp"
+
+namespace scener::math
+{
+    /// Represents an IEEE 754 half precision (binary16) floating point number.
+    ///
+    /// half is a storage type: arithmetic is carried out in single precision through the implicit conversions to and
+    /// from float, and the result is rounded back to half precision when stored.
+    class half final
+    {
+    public:
+        /// Creates a half precision number from its binary representation.
+        /// \param bits the binary representation of the number.
+        /// \returns the half precision number.
+        constexpr static half from_bits(std::uint16_t bits) noexcept
+        {
+            half value { };
+
+            value._bits = bits;
+
+            return value;
+        }
+
+    public:
+        /// Initializes a new instance of the half class.
+        half() noexcept = default;
+
+        /// Initializes a new instance of the half class with the given value, rounded to the nearest half precision
+        /// number.
+        /// \param value the single precision value.
+        half(float value) noexcept
+            : _bits { to_bits(value) }
+        {
+        }
+
+    public:
+        /// Gets the binary representation of the number.
+        /// \returns the binary representation of the number.
+        constexpr std::uint16_t bits() const noexcept
+        {
+            return _bits;
+        }
+
+    public:
+        /// Converts the number to single precision, the conversion is exact.
+        operator float() const noexcept
+        {
+            return to_float(_bits);
+        }
+
+    private:
+        static std::uint16_t to_bits(float value) noexcept
+        {
+            std::uint32_t bits;
+
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+
+            bits &= 0x7FFFFFFF;
+
+            if (bits >= 0x7F800000)
+            {
+                // Infinity and NaN, NaN payloads are truncated and kept quiet
+                return sign | 0x7C00 | ((bits > 0x7F800000) ? (0x0200 | ((bits >> 13) & 0x03FF)) : 0);
+            }
+            if (bits >= 0x477FF000)
+            {
+                // Values rounding above 65504 overflow to infinity
+                return sign | 0x7C00;
+            }
+            if (bits < 0x33000000)
+            {
+                // Values below half of the smallest subnormal round to zero
+                return sign;
+            }
+
+            std::uint32_t mantissa;
+            std::uint32_t shift;
+
+            if (bits < 0x38800000)
+            {
+                // Subnormal, the implicit leading bit becomes explicit
+                mantissa = (bits & 0x007FFFFF) | 0x00800000;
+                shift    = 126 - (bits >> 23);
+            }
+            else
+            {
+                // Normal, rebias the exponent from 127 to 15
+                mantissa = bits - 0x38000000;
+                shift    = 13;
+            }
+
+            // Round to nearest, ties to even. A carry out of the mantissa correctly bumps the exponent.
+            auto result    = mantissa >> shift;
+            auto remainder = mantissa & ((1u << shift) - 1);
+            auto halfway   = 1u << (shift - 1);
+
+            if (remainder > halfway || (remainder == halfway && (result & 1) != 0))
+            {
+                ++result;
+            }
+
+            return sign | static_cast<std::uint16_t>(result);
+        }
+
+        static float to_float(std::uint16_t value) noexcept
+        {
+            std::uint32_t sign     = std::uint32_t(value & 0x8000) << 16;
+            std::uint32_t exponent = (value >> 10) & 0x1F;
+            std::uint32_t mantissa = value & 0x03FF;
+            std::uint32_t bits;
+
+            if (exponent == 0x1F)
+            {
+                bits = sign | 0x7F800000 | (mantissa << 13);
+            }
+            else if (exponent != 0)
+            {
+                bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+            }
+            else if (mantissa != 0)
+            {
+                // Subnormal, normalize the mantissa
+                exponent = 113;
+
+                while ((mantissa & 0x0400) == 0)
+                {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+
+                bits = sign | (exponent << 23) | ((mantissa & 0x03FF) << 13);
+            }
+            else
+            {
+                bits = sign;
+            }
+
+            float result;
+
+            std::memcpy(&result, &bits, sizeof(result));
+
+            return result;
+        }
+
+    private:
+        std::uint16_t _bits;
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TRAITS
+
+    template <>
+    struct is_arithmetic_like<half> : std::true_type
+    {
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // CONVERSIONS
+
+    /// Converts single precision values to half precision, rounding to the nearest value.
+    /// \param source the single precision values.
+    /// \param destination the half precision values, of the same size as the source.
+    inline void convert(gsl::span<const float> source, gsl::span<half> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__F16C__)
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value = _mm256_loadu_ps(source.data() + i);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = half { source[i] };
+        }
+    }
+
+    /// Converts half precision values to single precision.
+    /// \param source the half precision values.
+    /// \param destination the single precision values, of the same size as the source.
+    inline void convert(gsl::span<const half> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__F16C__)
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+            _mm256_storeu_ps(destination.data() + i, _mm256_cvtph_ps(value));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = source[i];
+        }
+    }
+
+    /// Converts single precision vectors to half precision, rounding to the nearest value.
+    /// \param source the single precision vectors.
+    /// \param destination the half precision vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void convert(gsl::span<const basic_vector<float, Dimension>> source
+               , gsl::span<basic_vector<half, Dimension>>        destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<float, Dimension>) == Dimension * sizeof(float));
+        static_assert(sizeof(basic_vector<half, Dimension>) == Dimension * sizeof(half));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<half*>(destination.data());
+
+        convert(gsl::span<const float> { input, source.size() * Dimension }
+              , gsl::span<half> { output, destination.size() * Dimension });
+    }
+
+    /// Converts half precision vectors to single precision.
+    /// \param source the half precision vectors.
+    /// \param destination the single precision vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void convert(gsl::span<const basic_vector<half, Dimension>> source
+               , gsl::span<basic_vector<float, Dimension>>      destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<float, Dimension>) == Dimension * sizeof(float));
+        static_assert(sizeof(basic_vector<half, Dimension>) == Dimension * sizeof(half));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const half*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        convert(gsl::span<const half> { input, source.size() * Dimension }
+              , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    using vector2h = basic_vector2<half>;
+    using vector3h = basic_vector3<half>;
+    using vector4h = basic_vector4<half>;
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<scener::math::half>
+    {
+        using half = scener::math::half;
+
+    public:
+        static constexpr bool               is_specialized    = true;
+        static constexpr bool               is_signed         = true;
+        static constexpr bool               is_integer        = false;
+        static constexpr bool               is_exact          = false;
+        static constexpr bool               has_infinity      = true;
+        static constexpr bool               has_quiet_NaN     = true;
+        static constexpr bool               has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm        = denorm_present;
+        static constexpr bool               has_denorm_loss   = false;
+        static constexpr float_round_style  round_style       = round_to_nearest;
+        static constexpr bool               is_iec559         = true;
+        static constexpr bool               is_bounded        = true;
+        static constexpr bool               is_modulo         = false;
+        static constexpr int                digits            = 11;
+        static constexpr int                digits10          = 3;
+        static constexpr int                max_digits10      = 5;
+        static constexpr int                radix             = 2;
+        static constexpr int                min_exponent      = -13;
+        static constexpr int                min_exponent10    = -4;
+        static constexpr int                max_exponent      = 16;
+        static constexpr int                max_exponent10    = 4;
+        static constexpr bool               traps             = false;
+        static constexpr bool               tinyness_before   = false;
+
+        static constexpr half min() noexcept           { return half::from_bits(0x0400); }
+        static constexpr half lowest() noexcept        { return half::from_bits(0xFBFF); }
+        static constexpr half max() noexcept           { return half::from_bits(0x7BFF); }
+        static constexpr half epsilon() noexcept       { return half::from_bits(0x1400); }
+        static constexpr half round_error() noexcept   { return half::from_bits(0x3800); }
+        static constexpr half infinity() noexcept      { return half::from_bits(0x7C00); }
+        static constexpr half quiet_NaN() noexcept     { return half::from_bits(0x7E00); }
+        static constexpr half signaling_NaN() noexcept { return half::from_bits(0x7D00); }
+        static constexpr half denorm_min() noexcept    { return half::from_bits(0x0001); }
+    };
+}
+
+#endif // SCENER_MATH_HALF_HPP
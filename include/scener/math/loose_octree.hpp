@@ -0,0 +1,9 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_LOOSE_OCTREE_HPP
+#define SCENER_MATH_LOOSE_OCTREE_HPP
+
+#include "scener/math/basic_loose_octree.hpp"
+
+#endif // SCENER_MATH_LOOSE_OCTREE_HPP
@@ -7,8 +7,16 @@
 #include "scener/math/functional.hpp"
 
 #include "scener/math/basic_math.hpp"
+#include "scener/math/fast_math.hpp"
+#include "scener/math/aligned.hpp"
+#include "scener/math/frame_arena.hpp"
+#include "scener/math/executor.hpp"
+#include "scener/math/bfloat16.hpp"
+#include "scener/math/half.hpp"
 
 #include "scener/math/containment_type.hpp"
+#include "scener/math/curve_interpolation.hpp"
+#include "scener/math/euler_order.hpp"
 #include "scener/math/plane_intersection_type.hpp"
 
 #include "scener/math/basic_rect.hpp"
@@ -23,8 +31,21 @@
 #include "scener/math/bounding_box.hpp"
 #include "scener/math/bounding_frustrum.hpp"
 #include "scener/math/bounding_sphere.hpp"
+#include "scener/math/frustrum_culling_context.hpp"
 #include "scener/math/color.hpp"
+#include "scener/math/color_space.hpp"
+#include "scener/math/tonemapping.hpp"
+#include "scener/math/packed_color.hpp"
+#include "scener/math/packed_quaternion.hpp"
+#include "scener/math/packed_vector.hpp"
 #include "scener/math/plane.hpp"
 #include "scener/math/ray.hpp"
+#include "scener/math/shadow_cascades.hpp"
+
+#include "scener/math/loose_octree.hpp"
+#include "scener/math/spatial_hash_grid.hpp"
+#include "scener/math/sweep_and_prune.hpp"
+
+#include "scener/math/animation_tracks.hpp"
 
 #endif // SCENER_MATH_MATH_HPP
@@ -0,0 +1,345 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_PACKED_COLOR_HPP
+#define SCENER_MATH_PACKED_COLOR_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_color.hpp"
+#include "scener/math/basic_color_operations.hpp"
+#include "scener/math/packed_vector.hpp"
+
+/// Conversions between single precision colors and 32 bits colors with 8 bits per channel.
+///
+/// Format names list the channels from the most to the least significant bits of the 32 bits value: rgba8 has red in
+/// the most significant byte, and abgr8 matches the byte order of R8G8B8A8 texture data on little endian machines.
+namespace scener::math::packed
+{
+    namespace detail
+    {
+        /// Packs a color, shifting every channel by the given amount.
+        template <std::uint32_t R, std::uint32_t G, std::uint32_t B, std::uint32_t A>
+        inline std::uint32_t pack_color8(const basic_color<float>& value) noexcept
+        {
+            return (std::uint32_t(pack_unorm8(value.r)) << R)
+                 | (std::uint32_t(pack_unorm8(value.g)) << G)
+                 | (std::uint32_t(pack_unorm8(value.b)) << B)
+                 | (std::uint32_t(pack_unorm8(value.a)) << A);
+        }
+
+        template <std::uint32_t R, std::uint32_t G, std::uint32_t B, std::uint32_t A>
+        inline basic_color<float> unpack_color8(std::uint32_t value) noexcept
+        {
+            return { unpack_unorm8(std::uint8_t(value >> R))
+                   , unpack_unorm8(std::uint8_t(value >> G))
+                   , unpack_unorm8(std::uint8_t(value >> B))
+                   , unpack_unorm8(std::uint8_t(value >> A)) };
+        }
+
+        template <std::uint32_t R, std::uint32_t G, std::uint32_t B, std::uint32_t A>
+        inline void pack_color8(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+        {
+            Expects(source.size() == destination.size());
+
+            std::size_t count = source.size();
+            std::size_t i     = 0;
+
+#if defined(__SSE2__)
+            const auto scale = _mm_set1_ps(255.0f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                auto r = _mm_loadu_ps(source[i].components.data());
+                auto g = _mm_loadu_ps(source[i + 1].components.data());
+                auto b = _mm_loadu_ps(source[i + 2].components.data());
+                auto a = _mm_loadu_ps(source[i + 3].components.data());
+
+                _MM_TRANSPOSE4_PS(r, g, b, a);
+
+                auto pr = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(saturate(r), scale)), R);
+                auto pg = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(saturate(g), scale)), G);
+                auto pb = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(saturate(b), scale)), B);
+                auto pa = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(saturate(a), scale)), A);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                               , _mm_or_si128(_mm_or_si128(pr, pg), _mm_or_si128(pb, pa)));
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                destination[i] = pack_color8<R, G, B, A>(source[i]);
+            }
+        }
+
+        template <std::uint32_t R, std::uint32_t G, std::uint32_t B, std::uint32_t A>
+        inline void unpack_color8(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+        {
+            Expects(source.size() == destination.size());
+
+            std::size_t count = source.size();
+            std::size_t i     = 0;
+
+#if defined(__SSE2__)
+            const auto mask  = _mm_set1_epi32(0xFF);
+            const auto scale = _mm_set1_ps(255.0f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+                auto r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, R), mask)), scale);
+                auto g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, G), mask)), scale);
+                auto b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, B), mask)), scale);
+                auto a = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, A), mask)), scale);
+
+                _MM_TRANSPOSE4_PS(r, g, b, a);
+
+                _mm_storeu_ps(destination[i].components.data(), r);
+                _mm_storeu_ps(destination[i + 1].components.data(), g);
+                _mm_storeu_ps(destination[i + 2].components.data(), b);
+                _mm_storeu_ps(destination[i + 3].components.data(), a);
+            }
+#endif
+
+            for (; i < count; ++i)
+            {
+                destination[i] = unpack_color8<R, G, B, A>(source[i]);
+            }
+        }
+
+        /// Gets the table mapping every 8 bits sRGB value to its exact linear value.
+        inline const std::array<float, 256>& srgb8_to_linear_table() noexcept
+        {
+            static const auto table = []
+            {
+                std::array<float, 256> result;
+
+                for (std::size_t i = 0; i < result.size(); ++i)
+                {
+                    auto value = double(i) / 255.0;
+
+                    result[i] = float((value <= 0.04045) ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4));
+                }
+
+                return result;
+            }();
+
+            return table;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // RGBA8, BGRA8, ABGR8
+
+    /// Packs a color with channels in the [0, 1] range as 8 bits unsigned normalized values, red in the most
+    /// significant bits. The round-trip error is at most 0.5 / 255.
+    /// \param value the color to pack.
+    /// \returns the packed color.
+    inline std::uint32_t pack_rgba8(const basic_color<float>& value) noexcept
+    {
+        return detail::pack_color8<24, 16, 8, 0>(value);
+    }
+
+    /// Packs a color with channels in the [0, 1] range as 8 bits unsigned normalized values, blue in the most
+    /// significant bits. The round-trip error is at most 0.5 / 255.
+    /// \param value the color to pack.
+    /// \returns the packed color.
+    inline std::uint32_t pack_bgra8(const basic_color<float>& value) noexcept
+    {
+        return detail::pack_color8<8, 16, 24, 0>(value);
+    }
+
+    /// Packs a color with channels in the [0, 1] range as 8 bits unsigned normalized values, alpha in the most
+    /// significant bits. The round-trip error is at most 0.5 / 255.
+    /// \param value the color to pack.
+    /// \returns the packed color.
+    inline std::uint32_t pack_abgr8(const basic_color<float>& value) noexcept
+    {
+        return detail::pack_color8<0, 8, 16, 24>(value);
+    }
+
+    /// Unpacks a color packed with pack_rgba8.
+    /// \param value the packed color.
+    /// \returns the unpacked color.
+    inline basic_color<float> unpack_rgba8(std::uint32_t value) noexcept
+    {
+        return detail::unpack_color8<24, 16, 8, 0>(value);
+    }
+
+    /// Unpacks a color packed with pack_bgra8.
+    /// \param value the packed color.
+    /// \returns the unpacked color.
+    inline basic_color<float> unpack_bgra8(std::uint32_t value) noexcept
+    {
+        return detail::unpack_color8<8, 16, 24, 0>(value);
+    }
+
+    /// Unpacks a color packed with pack_abgr8.
+    /// \param value the packed color.
+    /// \returns the unpacked color.
+    inline basic_color<float> unpack_abgr8(std::uint32_t value) noexcept
+    {
+        return detail::unpack_color8<0, 8, 16, 24>(value);
+    }
+
+    /// Packs colors, as pack_rgba8 does.
+    /// \param source the colors to pack.
+    /// \param destination the packed colors, of the same size as the source.
+    inline void pack_rgba8(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        detail::pack_color8<24, 16, 8, 0>(source, destination);
+    }
+
+    /// Packs colors, as pack_bgra8 does.
+    /// \param source the colors to pack.
+    /// \param destination the packed colors, of the same size as the source.
+    inline void pack_bgra8(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        detail::pack_color8<8, 16, 24, 0>(source, destination);
+    }
+
+    /// Packs colors, as pack_abgr8 does.
+    /// \param source the colors to pack.
+    /// \param destination the packed colors, of the same size as the source.
+    inline void pack_abgr8(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        detail::pack_color8<0, 8, 16, 24>(source, destination);
+    }
+
+    /// Unpacks colors packed with pack_rgba8.
+    /// \param source the packed colors.
+    /// \param destination the unpacked colors, of the same size as the source.
+    inline void unpack_rgba8(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        detail::unpack_color8<24, 16, 8, 0>(source, destination);
+    }
+
+    /// Unpacks colors packed with pack_bgra8.
+    /// \param source the packed colors.
+    /// \param destination the unpacked colors, of the same size as the source.
+    inline void unpack_bgra8(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        detail::unpack_color8<8, 16, 24, 0>(source, destination);
+    }
+
+    /// Unpacks colors packed with pack_abgr8.
+    /// \param source the packed colors.
+    /// \param destination the unpacked colors, of the same size as the source.
+    inline void unpack_abgr8(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        detail::unpack_color8<0, 8, 16, 24>(source, destination);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // SRGB
+
+    /// Converts an 8 bits sRGB encoded channel to linear, through a lookup table holding the exact values.
+    /// \param value the sRGB encoded channel.
+    /// \returns the linear value.
+    inline float srgb8_to_linear(std::uint8_t value) noexcept
+    {
+        return detail::srgb8_to_linear_table()[value];
+    }
+
+    /// Converts a linear channel value to 8 bits sRGB.
+    /// \param value the linear value.
+    /// \returns the sRGB encoded channel.
+    inline std::uint8_t linear_to_srgb8(float value) noexcept
+    {
+        return pack_unorm8(linear_to_srgb(detail::saturate(value)));
+    }
+
+    /// Packs a linear color as sRGB encoded rgba8, alpha is stored linear.
+    /// \param value the linear color.
+    /// \returns the packed sRGB color.
+    inline std::uint32_t pack_srgba8(const basic_color<float>& value) noexcept
+    {
+        return (std::uint32_t(linear_to_srgb8(value.r)) << 24)
+             | (std::uint32_t(linear_to_srgb8(value.g)) << 16)
+             | (std::uint32_t(linear_to_srgb8(value.b)) << 8)
+             |  std::uint32_t(pack_unorm8(value.a));
+    }
+
+    /// Unpacks a sRGB encoded rgba8 color to linear, alpha is stored linear.
+    /// \param value the packed sRGB color.
+    /// \returns the linear color.
+    inline basic_color<float> unpack_srgba8(std::uint32_t value) noexcept
+    {
+        const auto& table = detail::srgb8_to_linear_table();
+
+        return { table[value >> 24], table[(value >> 16) & 0xFF], table[(value >> 8) & 0xFF], unpack_unorm8(value & 0xFF) };
+    }
+
+    /// Packs linear colors as sRGB encoded rgba8, as pack_srgba8 does.
+    /// \param source the linear colors.
+    /// \param destination the packed sRGB colors, of the same size as the source.
+    inline void pack_srgba8(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(255.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 encoded[4];
+
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                encoded[j] = detail::saturate(_mm_loadu_ps(source[i + j].components.data()));
+            }
+
+            _MM_TRANSPOSE4_PS(encoded[0], encoded[1], encoded[2], encoded[3]);
+
+            // Alpha is stored linear
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                encoded[j] = math::detail::srgb_transfer<false>(math::detail::simd4_sse { encoded[j] }).native();
+            }
+
+            auto pr = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(encoded[0], scale)), 24);
+            auto pg = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(encoded[1], scale)), 16);
+            auto pb = _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(encoded[2], scale)), 8);
+            auto pa = _mm_cvtps_epi32(_mm_mul_ps(encoded[3], scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_or_si128(_mm_or_si128(pr, pg), _mm_or_si128(pb, pa)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_srgba8(source[i]);
+        }
+    }
+
+    /// Unpacks sRGB encoded rgba8 colors to linear, as unpack_srgba8 does.
+    /// \param source the packed sRGB colors.
+    /// \param destination the linear colors, of the same size as the source.
+    inline void unpack_srgba8(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            destination[i] = unpack_srgba8(source[i]);
+        }
+    }
+}
+
+#endif // SCENER_MATH_PACKED_COLOR_HPP
@@ -0,0 +1,366 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_PACKED_QUATERNION_HPP
+#define SCENER_MATH_PACKED_QUATERNION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_quaternion.hpp"
+
+/// Smallest three compression of unit quaternions.
+///
+/// A unit quaternion is stored as the index of its largest component, in two bits, and its other three components
+/// quantized to Bits bits each over [-1/sqrt(2), 1/sqrt(2)], the range they are known to fall in. The largest
+/// component is rebuilt from the unit length, after flipping the sign of the quaternion so it is positive; q and -q
+/// represent the same rotation, so the decoded quaternion may be the negation of the encoded one.
+///
+/// Reference: Glenn Fiedler. "Snapshot Compression"
+namespace scener::math::packed
+{
+    namespace detail
+    {
+        template <std::uint32_t Bits>
+        struct smallest_three
+        {
+            /// Mask of a quantized component.
+            constexpr static std::uint32_t mask = (1u << Bits) - 1;
+
+            /// Largest quantized value. The largest encodable value is left unused, so the number of steps is even
+            /// and zero is represented exactly.
+            constexpr static std::uint32_t max = mask - 1;
+
+            /// Distance between consecutive quantized values.
+            constexpr static float step = 1.41421356237f / float(max);
+
+            /// Lower bound of the quantized range, 1/sqrt(2).
+            constexpr static float bound = 0.70710678118f;
+
+            static std::uint64_t encode(const basic_quaternion<float>& value) noexcept
+            {
+                std::uint32_t index   = 0;
+                float         largest = std::abs(value.x);
+
+                for (std::uint32_t i = 1; i < 4; ++i)
+                {
+                    if (std::abs(value[i]) > largest)
+                    {
+                        index   = i;
+                        largest = std::abs(value[i]);
+                    }
+                }
+
+                auto          sign = (value[index] < 0.0f) ? -1.0f : 1.0f;
+                std::uint64_t code = index;
+
+                for (std::uint32_t i = 0; i < 4; ++i)
+                {
+                    if (i != index)
+                    {
+                        auto quantized = std::nearbyint((value[i] * sign + bound) / step);
+
+                        code = (code << Bits) | static_cast<std::uint64_t>(std::min(std::max(quantized, 0.0f), float(max)));
+                    }
+                }
+
+                return code;
+            }
+
+            static basic_quaternion<float> decode(std::uint64_t code) noexcept
+            {
+                auto a = float((code >> (2 * Bits)) & mask) * step - bound;
+                auto b = float((code >> Bits) & mask) * step - bound;
+                auto c = float(code & mask) * step - bound;
+                auto l = std::sqrt(std::max(1.0f - (a * a + b * b + c * c), 0.0f));
+
+                switch (code >> (3 * Bits))
+                {
+                case 0:
+                    return { l, a, b, c };
+                case 1:
+                    return { a, l, b, c };
+                case 2:
+                    return { a, b, l, c };
+                default:
+                    return { a, b, c, l };
+                }
+            }
+
+#if defined(__SSE2__)
+            /// Decodes four quaternions, given their largest component index and quantized components.
+            static void decode(__m128i index, __m128i qa, __m128i qb, __m128i qc, basic_quaternion<float>* destination) noexcept
+            {
+                const auto scale  = _mm_set1_ps(step);
+                const auto offset = _mm_set1_ps(bound);
+
+                auto a = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(qa), scale), offset);
+                auto b = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(qb), scale), offset);
+                auto c = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(qc), scale), offset);
+                auto s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+                auto l = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), s), _mm_setzero_ps()));
+
+                auto is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+                auto is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+                auto is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+                auto is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+
+                auto select = [] (__m128 mask, __m128 lhs, __m128 rhs) -> __m128
+                {
+                    return _mm_or_ps(_mm_and_ps(mask, lhs), _mm_andnot_ps(mask, rhs));
+                };
+
+                // The stored components are the ones other than the largest, in order
+                auto x = select(is0, l, a);
+                auto y = select(is0, a, select(is1, l, b));
+                auto z = select(is3, c, select(is2, l, b));
+                auto w = select(is3, l, c);
+
+                _MM_TRANSPOSE4_PS(x, y, z, w);
+
+                _mm_storeu_ps(destination[0].data(), x);
+                _mm_storeu_ps(destination[1].data(), y);
+                _mm_storeu_ps(destination[2].data(), z);
+                _mm_storeu_ps(destination[3].data(), w);
+            }
+
+            /// Decodes four quaternions stored in the low bits of four 64 bits codes.
+            static void decode(__m128i lo, __m128i hi, basic_quaternion<float>* destination) noexcept
+            {
+                const auto component = _mm_set1_epi32(static_cast<std::int32_t>(mask));
+
+                // Shifts both 64 bits lanes of both registers, then gathers the low 32 bits of the four codes
+                auto field = [&] (int shift) -> __m128i
+                {
+                    auto s0 = _mm_castsi128_ps(_mm_srl_epi64(lo, _mm_cvtsi32_si128(shift)));
+                    auto s1 = _mm_castsi128_ps(_mm_srl_epi64(hi, _mm_cvtsi32_si128(shift)));
+
+                    return _mm_castps_si128(_mm_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0)));
+                };
+
+                decode(field(3 * Bits)
+                     , _mm_and_si128(field(2 * Bits), component)
+                     , _mm_and_si128(field(Bits), component)
+                     , _mm_and_si128(field(0), component)
+                     , destination);
+            }
+#endif
+        };
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // TYPEDEF'S & ALIASES
+
+    /// Quaternion compressed to 48 bits, as three 16 bits words with the least significant word first.
+    using quaternion48 = std::array<std::uint16_t, 3>;
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // 32 BITS
+
+    /// Compresses a unit quaternion to 32 bits, three components of 10 bits each.
+    /// Every component of the decoded quaternion is within 0.002 of the encoded one, and the rotation within 0.25
+    /// degrees.
+    /// \param value the unit quaternion.
+    /// \returns the compressed quaternion.
+    inline std::uint32_t pack_quaternion32(const basic_quaternion<float>& value) noexcept
+    {
+        return static_cast<std::uint32_t>(detail::smallest_three<10>::encode(value));
+    }
+
+    /// Decompresses a quaternion compressed with pack_quaternion32.
+    /// \param value the compressed quaternion.
+    /// \returns the unit quaternion.
+    inline basic_quaternion<float> unpack_quaternion32(std::uint32_t value) noexcept
+    {
+        return detail::smallest_three<10>::decode(value);
+    }
+
+    /// Compresses unit quaternions to 32 bits, as pack_quaternion32 does.
+    /// \param source the unit quaternions.
+    /// \param destination the compressed quaternions, of the same size as the source.
+    inline void pack_quaternion32(gsl::span<const basic_quaternion<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            destination[i] = pack_quaternion32(source[i]);
+        }
+    }
+
+    /// Decompresses quaternions compressed with pack_quaternion32.
+    /// \param source the compressed quaternions.
+    /// \param destination the unit quaternions, of the same size as the source.
+    inline void unpack_quaternion32(gsl::span<const std::uint32_t> source, gsl::span<basic_quaternion<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto mask = _mm_set1_epi32(0x3FF);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+            detail::smallest_three<10>::decode(_mm_srli_epi32(value, 30)
+                                             , _mm_and_si128(_mm_srli_epi32(value, 20), mask)
+                                             , _mm_and_si128(_mm_srli_epi32(value, 10), mask)
+                                             , _mm_and_si128(value, mask)
+                                             , destination.data() + i);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_quaternion32(source[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // 48 BITS
+
+    /// Compresses a unit quaternion to 48 bits, three components of 15 bits each.
+    /// Every component of the decoded quaternion is within 0.0001 of the encoded one, and the rotation within 0.01
+    /// degrees.
+    /// \param value the unit quaternion.
+    /// \returns the compressed quaternion.
+    inline quaternion48 pack_quaternion48(const basic_quaternion<float>& value) noexcept
+    {
+        auto code = detail::smallest_three<15>::encode(value);
+
+        return { std::uint16_t(code), std::uint16_t(code >> 16), std::uint16_t(code >> 32) };
+    }
+
+    /// Decompresses a quaternion compressed with pack_quaternion48.
+    /// \param value the compressed quaternion.
+    /// \returns the unit quaternion.
+    inline basic_quaternion<float> unpack_quaternion48(const quaternion48& value) noexcept
+    {
+        return detail::smallest_three<15>::decode(std::uint64_t(value[0])
+                                                | (std::uint64_t(value[1]) << 16)
+                                                | (std::uint64_t(value[2]) << 32));
+    }
+
+    /// Compresses unit quaternions to 48 bits, as pack_quaternion48 does.
+    /// \param source the unit quaternions.
+    /// \param destination the compressed quaternions, of the same size as the source.
+    inline void pack_quaternion48(gsl::span<const basic_quaternion<float>> source, gsl::span<quaternion48> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            destination[i] = pack_quaternion48(source[i]);
+        }
+    }
+
+    /// Decompresses quaternions compressed with pack_quaternion48.
+    /// \param source the compressed quaternions.
+    /// \param destination the unit quaternions, of the same size as the source.
+    inline void unpack_quaternion48(gsl::span<const quaternion48> source, gsl::span<basic_quaternion<float>> destination) noexcept
+    {
+        static_assert(sizeof(quaternion48) == 6);
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            // Widen four 6 bytes codes to 64 bits lanes
+            std::uint64_t codes[4];
+
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                const auto& value = source[i + j];
+
+                codes[j] = std::uint64_t(value[0]) | (std::uint64_t(value[1]) << 16) | (std::uint64_t(value[2]) << 32);
+            }
+
+            detail::smallest_three<15>::decode(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes))
+                                             , _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + 2))
+                                             , destination.data() + i);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_quaternion48(source[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // 64 BITS
+
+    /// Compresses a unit quaternion to 64 bits, three components of 20 bits each.
+    /// Every component of the decoded quaternion is within 0.000003 of the encoded one, the precision of a float.
+    /// \param value the unit quaternion.
+    /// \returns the compressed quaternion.
+    inline std::uint64_t pack_quaternion64(const basic_quaternion<float>& value) noexcept
+    {
+        return detail::smallest_three<20>::encode(value);
+    }
+
+    /// Decompresses a quaternion compressed with pack_quaternion64.
+    /// \param value the compressed quaternion.
+    /// \returns the unit quaternion.
+    inline basic_quaternion<float> unpack_quaternion64(std::uint64_t value) noexcept
+    {
+        return detail::smallest_three<20>::decode(value);
+    }
+
+    /// Compresses unit quaternions to 64 bits, as pack_quaternion64 does.
+    /// \param source the unit quaternions.
+    /// \param destination the compressed quaternions, of the same size as the source.
+    inline void pack_quaternion64(gsl::span<const basic_quaternion<float>> source, gsl::span<std::uint64_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            destination[i] = pack_quaternion64(source[i]);
+        }
+    }
+
+    /// Decompresses quaternions compressed with pack_quaternion64.
+    /// \param source the compressed quaternions.
+    /// \param destination the unit quaternions, of the same size as the source.
+    inline void unpack_quaternion64(gsl::span<const std::uint64_t> source, gsl::span<basic_quaternion<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            detail::smallest_three<20>::decode(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i))
+                                             , _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i + 2))
+                                             , destination.data() + i);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_quaternion64(source[i]);
+        }
+    }
+}
+
+#endif // SCENER_MATH_PACKED_QUATERNION_HPP
@@ -0,0 +1,1153 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_PACKED_VECTOR_HPP
+#define SCENER_MATH_PACKED_VECTOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <gsl/assert>
+#include <gsl/span>
+
+#include "scener/math/basic_color.hpp"
+#include "scener/math/basic_vector.hpp"
+
+/// Conversions between single precision vectors and the normalized integer and packed formats used by GPU vertex
+/// and texture data.
+///
+/// Rounding is to nearest, ties to even, and out of range or NaN inputs are clamped (NaN becomes the lower bound).
+/// The batch overloads produce the same results as the scalar functions; the maximum round-trip error of every
+/// format is documented with its pack function.
+namespace scener::math::packed
+{
+    namespace detail
+    {
+        inline float saturate(float value) noexcept
+        {
+            return (value > 0.0f) ? ((value < 1.0f) ? value : 1.0f) : 0.0f;
+        }
+
+        inline float saturate_signed(float value) noexcept
+        {
+            return (value > -1.0f) ? ((value < 1.0f) ? value : 1.0f) : -1.0f;
+        }
+
+        inline float from_bits(std::uint32_t bits) noexcept
+        {
+            float value;
+
+            std::memcpy(&value, &bits, sizeof(value));
+
+            return value;
+        }
+
+        inline std::uint32_t to_bits(float value) noexcept
+        {
+            std::uint32_t bits;
+
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            return bits;
+        }
+
+#if defined(__SSE2__)
+        /// Loads four consecutive three component vectors into one register per component.
+        inline void load_soa3(const float* source, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            auto a = _mm_loadu_ps(source);      // x0 y0 z0 x1
+            auto b = _mm_loadu_ps(source + 4);  // y1 z1 x2 y2
+            auto c = _mm_loadu_ps(source + 8);  // z2 x3 y3 z3
+
+            x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+            y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1))
+                             , _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3))
+                             , _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2))
+                             , _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0))
+                             , _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        /// Stores one register per component as four consecutive three component vectors.
+        inline void store_soa3(float* destination, __m128 x, __m128 y, __m128 z) noexcept
+        {
+            _mm_storeu_ps(destination,     _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0))
+                                                        , _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0))
+                                                        , _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(destination + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1))
+                                                        , _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2))
+                                                        , _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(destination + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2))
+                                                        , _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3))
+                                                        , _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+
+        inline __m128 saturate(__m128 value) noexcept
+        {
+            return _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        }
+
+        inline __m128 saturate_signed(__m128 value) noexcept
+        {
+            return _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+        }
+
+        inline __m128 copysign(__m128 magnitude, __m128 sign) noexcept
+        {
+            auto mask = _mm_set1_ps(-0.0f);
+
+            return _mm_or_ps(_mm_andnot_ps(mask, magnitude), _mm_and_ps(mask, sign));
+        }
+
+        inline __m128 abs(__m128 value) noexcept
+        {
+            return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+        }
+
+        /// Octahedral coordinates of four unit vectors, as encode_octahedral.
+        inline void encode_octahedral(__m128 x, __m128 y, __m128 z, __m128& px, __m128& py) noexcept
+        {
+            auto one = _mm_set1_ps(1.0f);
+            auto inv = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(abs(x), abs(y)), abs(z)));
+
+            px = _mm_mul_ps(x, inv);
+            py = _mm_mul_ps(y, inv);
+
+            auto fx  = _mm_mul_ps(_mm_sub_ps(one, abs(py)), copysign(one, px));
+            auto fy  = _mm_mul_ps(_mm_sub_ps(one, abs(px)), copysign(one, py));
+            auto low = _mm_cmplt_ps(z, _mm_setzero_ps());
+
+            px = _mm_or_ps(_mm_and_ps(low, fx), _mm_andnot_ps(low, px));
+            py = _mm_or_ps(_mm_and_ps(low, fy), _mm_andnot_ps(low, py));
+        }
+
+        /// Unit vectors of four octahedral coordinates, as decode_octahedral.
+        inline void decode_octahedral(__m128 px, __m128 py, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), abs(px)), abs(py));
+
+            auto t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+
+            x = _mm_sub_ps(px, copysign(t, px));
+            y = _mm_sub_ps(py, copysign(t, py));
+
+            auto s = _mm_div_ps(_mm_set1_ps(1.0f)
+                              , _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))));
+
+            x = _mm_mul_ps(x, s);
+            y = _mm_mul_ps(y, s);
+            z = _mm_mul_ps(z, s);
+        }
+
+        /// Sign extends the low eight bytes of value to eight 16 bits integers.
+        inline __m128i widen_signed8(__m128i value) noexcept
+        {
+            return _mm_srai_epi16(_mm_unpacklo_epi8(value, value), 8);
+        }
+
+        /// Sign extends the low four 16 bits integers of value to 32 bits.
+        inline __m128i widen_signed16(__m128i value) noexcept
+        {
+            return _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+        }
+#endif
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // NORMALIZED INTEGERS
+
+    /// Converts a value in the [0, 1] range to an 8 bits unsigned normalized integer.
+    /// The round-trip error is at most 0.5 / 255.
+    /// \param value the value to convert.
+    /// \returns the unsigned normalized integer.
+    inline std::uint8_t pack_unorm8(float value) noexcept
+    {
+        return static_cast<std::uint8_t>(std::nearbyint(detail::saturate(value) * 255.0f));
+    }
+
+    /// Converts an 8 bits unsigned normalized integer to a value in the [0, 1] range.
+    /// \param value the unsigned normalized integer.
+    /// \returns the converted value.
+    inline float unpack_unorm8(std::uint8_t value) noexcept
+    {
+        return float(value) / 255.0f;
+    }
+
+    /// Converts a value in the [0, 1] range to a 16 bits unsigned normalized integer.
+    /// The round-trip error is at most 0.5 / 65535.
+    /// \param value the value to convert.
+    /// \returns the unsigned normalized integer.
+    inline std::uint16_t pack_unorm16(float value) noexcept
+    {
+        return static_cast<std::uint16_t>(std::nearbyint(detail::saturate(value) * 65535.0f));
+    }
+
+    /// Converts a 16 bits unsigned normalized integer to a value in the [0, 1] range.
+    /// \param value the unsigned normalized integer.
+    /// \returns the converted value.
+    inline float unpack_unorm16(std::uint16_t value) noexcept
+    {
+        return float(value) / 65535.0f;
+    }
+
+    /// Converts a value in the [-1, 1] range to an 8 bits signed normalized integer, in the [-127, 127] range.
+    /// The round-trip error is at most 0.5 / 127.
+    /// \param value the value to convert.
+    /// \returns the signed normalized integer.
+    inline std::int8_t pack_snorm8(float value) noexcept
+    {
+        return static_cast<std::int8_t>(std::nearbyint(detail::saturate_signed(value) * 127.0f));
+    }
+
+    /// Converts an 8 bits signed normalized integer to a value in the [-1, 1] range, -128 maps to -1.
+    /// \param value the signed normalized integer.
+    /// \returns the converted value.
+    inline float unpack_snorm8(std::int8_t value) noexcept
+    {
+        return std::max(float(value) / 127.0f, -1.0f);
+    }
+
+    /// Converts a value in the [-1, 1] range to a 16 bits signed normalized integer, in the [-32767, 32767] range.
+    /// The round-trip error is at most 0.5 / 32767.
+    /// \param value the value to convert.
+    /// \returns the signed normalized integer.
+    inline std::int16_t pack_snorm16(float value) noexcept
+    {
+        return static_cast<std::int16_t>(std::nearbyint(detail::saturate_signed(value) * 32767.0f));
+    }
+
+    /// Converts a 16 bits signed normalized integer to a value in the [-1, 1] range, -32768 maps to -1.
+    /// \param value the signed normalized integer.
+    /// \returns the converted value.
+    inline float unpack_snorm16(std::int16_t value) noexcept
+    {
+        return std::max(float(value) / 32767.0f, -1.0f);
+    }
+
+    /// Converts values in the [0, 1] range to 8 bits unsigned normalized integers.
+    /// \param source the values to convert.
+    /// \param destination the unsigned normalized integers, of the same size as the source.
+    inline void pack_unorm8(gsl::span<const float> source, gsl::span<std::uint8_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(255.0f);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            auto v0 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i)), scale));
+            auto v1 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i + 4)), scale));
+            auto v2 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i + 8)), scale));
+            auto v3 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i + 12)), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_unorm8(source[i]);
+        }
+    }
+
+    /// Converts 8 bits unsigned normalized integers to values in the [0, 1] range.
+    /// \param source the unsigned normalized integers.
+    /// \param destination the converted values, of the same size as the source.
+    inline void unpack_unorm8(gsl::span<const std::uint8_t> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto zero  = _mm_setzero_si128();
+        const auto scale = _mm_set1_ps(255.0f);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+            auto lo    = _mm_unpacklo_epi8(value, zero);
+            auto hi    = _mm_unpackhi_epi8(value, zero);
+            auto out   = destination.data() + i;
+
+            _mm_storeu_ps(out,      _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+            _mm_storeu_ps(out + 4,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+            _mm_storeu_ps(out + 8,  _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+            _mm_storeu_ps(out + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_unorm8(source[i]);
+        }
+    }
+
+    /// Converts values in the [0, 1] range to 16 bits unsigned normalized integers.
+    /// \param source the values to convert.
+    /// \param destination the unsigned normalized integers, of the same size as the source.
+    inline void pack_unorm16(gsl::span<const float> source, gsl::span<std::uint16_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(65535.0f);
+        const auto bias  = _mm_set1_epi32(32768);
+        const auto flip  = _mm_set1_epi16(std::int16_t(0x8000));
+
+        for (; i + 8 <= count; i += 8)
+        {
+            // SSE2 only packs to signed 16 bits, so pack biased values and flip the sign bit back
+            auto v0 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i)), scale));
+            auto v1 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(_mm_loadu_ps(source.data() + i + 4)), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(v0, bias), _mm_sub_epi32(v1, bias)), flip));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_unorm16(source[i]);
+        }
+    }
+
+    /// Converts 16 bits unsigned normalized integers to values in the [0, 1] range.
+    /// \param source the unsigned normalized integers.
+    /// \param destination the converted values, of the same size as the source.
+    inline void unpack_unorm16(gsl::span<const std::uint16_t> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto zero  = _mm_setzero_si128();
+        const auto scale = _mm_set1_ps(65535.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+            auto out   = destination.data() + i;
+
+            _mm_storeu_ps(out,     _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value, zero)), scale));
+            _mm_storeu_ps(out + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value, zero)), scale));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_unorm16(source[i]);
+        }
+    }
+
+    /// Converts values in the [-1, 1] range to 8 bits signed normalized integers.
+    /// \param source the values to convert.
+    /// \param destination the signed normalized integers, of the same size as the source.
+    inline void pack_snorm8(gsl::span<const float> source, gsl::span<std::int8_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(127.0f);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            auto v0 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i)), scale));
+            auto v1 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i + 4)), scale));
+            auto v2 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i + 8)), scale));
+            auto v3 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i + 12)), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_packs_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_snorm8(source[i]);
+        }
+    }
+
+    /// Converts 8 bits signed normalized integers to values in the [-1, 1] range.
+    /// \param source the signed normalized integers.
+    /// \param destination the converted values, of the same size as the source.
+    inline void unpack_snorm8(gsl::span<const std::int8_t> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(127.0f);
+        const auto lower = _mm_set1_ps(-1.0f);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+            auto lo    = detail::widen_signed8(value);
+            auto hi    = detail::widen_signed8(_mm_srli_si128(value, 8));
+            auto out   = destination.data() + i;
+
+            _mm_storeu_ps(out,      _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(lo)), scale), lower));
+            _mm_storeu_ps(out + 4,  _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(_mm_srli_si128(lo, 8))), scale), lower));
+            _mm_storeu_ps(out + 8,  _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(hi)), scale), lower));
+            _mm_storeu_ps(out + 12, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(_mm_srli_si128(hi, 8))), scale), lower));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_snorm8(source[i]);
+        }
+    }
+
+    /// Converts values in the [-1, 1] range to 16 bits signed normalized integers.
+    /// \param source the values to convert.
+    /// \param destination the signed normalized integers, of the same size as the source.
+    inline void pack_snorm16(gsl::span<const float> source, gsl::span<std::int16_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(32767.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            auto v0 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i)), scale));
+            auto v1 = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(_mm_loadu_ps(source.data() + i + 4)), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), _mm_packs_epi32(v0, v1));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_snorm16(source[i]);
+        }
+    }
+
+    /// Converts 16 bits signed normalized integers to values in the [-1, 1] range.
+    /// \param source the signed normalized integers.
+    /// \param destination the converted values, of the same size as the source.
+    inline void unpack_snorm16(gsl::span<const std::int16_t> source, gsl::span<float> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(32767.0f);
+        const auto lower = _mm_set1_ps(-1.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+            auto out   = destination.data() + i;
+
+            _mm_storeu_ps(out,     _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(value)), scale), lower));
+            _mm_storeu_ps(out + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(detail::widen_signed16(_mm_srli_si128(value, 8))), scale), lower));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_snorm16(source[i]);
+        }
+    }
+
+    /// Converts vectors with components in the [0, 1] range to 8 bits unsigned normalized integers.
+    /// \param source the vectors to convert.
+    /// \param destination the unsigned normalized vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void pack_unorm8(gsl::span<const basic_vector<float, Dimension>> source
+                   , gsl::span<basic_vector<std::uint8_t, Dimension>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::uint8_t, Dimension>) == Dimension * sizeof(std::uint8_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<std::uint8_t*>(destination.data());
+
+        pack_unorm8(gsl::span<const float> { input, source.size() * Dimension }
+                  , gsl::span<std::uint8_t> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors of 8 bits unsigned normalized integers to vectors with components in the [0, 1] range.
+    /// \param source the unsigned normalized vectors.
+    /// \param destination the converted vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void unpack_unorm8(gsl::span<const basic_vector<std::uint8_t, Dimension>> source
+                     , gsl::span<basic_vector<float, Dimension>>              destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::uint8_t, Dimension>) == Dimension * sizeof(std::uint8_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const std::uint8_t*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        unpack_unorm8(gsl::span<const std::uint8_t> { input, source.size() * Dimension }
+                    , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors with components in the [0, 1] range to 16 bits unsigned normalized integers.
+    /// \param source the vectors to convert.
+    /// \param destination the unsigned normalized vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void pack_unorm16(gsl::span<const basic_vector<float, Dimension>>  source
+                    , gsl::span<basic_vector<std::uint16_t, Dimension>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::uint16_t, Dimension>) == Dimension * sizeof(std::uint16_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<std::uint16_t*>(destination.data());
+
+        pack_unorm16(gsl::span<const float> { input, source.size() * Dimension }
+                   , gsl::span<std::uint16_t> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors of 16 bits unsigned normalized integers to vectors with components in the [0, 1] range.
+    /// \param source the unsigned normalized vectors.
+    /// \param destination the converted vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void unpack_unorm16(gsl::span<const basic_vector<std::uint16_t, Dimension>> source
+                      , gsl::span<basic_vector<float, Dimension>>               destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::uint16_t, Dimension>) == Dimension * sizeof(std::uint16_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const std::uint16_t*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        unpack_unorm16(gsl::span<const std::uint16_t> { input, source.size() * Dimension }
+                     , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors with components in the [-1, 1] range to 8 bits signed normalized integers.
+    /// \param source the vectors to convert.
+    /// \param destination the signed normalized vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void pack_snorm8(gsl::span<const basic_vector<float, Dimension>> source
+                   , gsl::span<basic_vector<std::int8_t, Dimension>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::int8_t, Dimension>) == Dimension * sizeof(std::int8_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<std::int8_t*>(destination.data());
+
+        pack_snorm8(gsl::span<const float> { input, source.size() * Dimension }
+                  , gsl::span<std::int8_t> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors of 8 bits signed normalized integers to vectors with components in the [-1, 1] range.
+    /// \param source the signed normalized vectors.
+    /// \param destination the converted vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void unpack_snorm8(gsl::span<const basic_vector<std::int8_t, Dimension>> source
+                     , gsl::span<basic_vector<float, Dimension>>             destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::int8_t, Dimension>) == Dimension * sizeof(std::int8_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const std::int8_t*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        unpack_snorm8(gsl::span<const std::int8_t> { input, source.size() * Dimension }
+                    , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors with components in the [-1, 1] range to 16 bits signed normalized integers.
+    /// \param source the vectors to convert.
+    /// \param destination the signed normalized vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void pack_snorm16(gsl::span<const basic_vector<float, Dimension>>  source
+                    , gsl::span<basic_vector<std::int16_t, Dimension>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::int16_t, Dimension>) == Dimension * sizeof(std::int16_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const float*>(source.data());
+        auto output = reinterpret_cast<std::int16_t*>(destination.data());
+
+        pack_snorm16(gsl::span<const float> { input, source.size() * Dimension }
+                   , gsl::span<std::int16_t> { output, destination.size() * Dimension });
+    }
+
+    /// Converts vectors of 16 bits signed normalized integers to vectors with components in the [-1, 1] range.
+    /// \param source the signed normalized vectors.
+    /// \param destination the converted vectors, of the same size as the source.
+    template <std::size_t Dimension>
+    void unpack_snorm16(gsl::span<const basic_vector<std::int16_t, Dimension>> source
+                      , gsl::span<basic_vector<float, Dimension>>              destination) noexcept
+    {
+        static_assert(sizeof(basic_vector<std::int16_t, Dimension>) == Dimension * sizeof(std::int16_t));
+
+        Expects(source.size() == destination.size());
+
+        auto input  = reinterpret_cast<const std::int16_t*>(source.data());
+        auto output = reinterpret_cast<float*>(destination.data());
+
+        unpack_snorm16(gsl::span<const std::int16_t> { input, source.size() * Dimension }
+                     , gsl::span<float> { output, destination.size() * Dimension });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // R10G10B10A2
+
+    /// Packs a vector with components in the [0, 1] range as 10 bits unsigned normalized x, y and z components and
+    /// a 2 bits unsigned normalized w component, x in the least significant bits.
+    /// The round-trip error is at most 0.5 / 1023 for x, y and z, and 0.5 / 3 for w.
+    /// \param value the vector to pack.
+    /// \returns the packed vector.
+    inline std::uint32_t pack_r10g10b10a2(const basic_vector4<float>& value) noexcept
+    {
+        auto x = static_cast<std::uint32_t>(std::nearbyint(detail::saturate(value.x) * 1023.0f));
+        auto y = static_cast<std::uint32_t>(std::nearbyint(detail::saturate(value.y) * 1023.0f));
+        auto z = static_cast<std::uint32_t>(std::nearbyint(detail::saturate(value.z) * 1023.0f));
+        auto w = static_cast<std::uint32_t>(std::nearbyint(detail::saturate(value.w) * 3.0f));
+
+        return x | (y << 10) | (z << 20) | (w << 30);
+    }
+
+    /// Unpacks a vector packed with pack_r10g10b10a2.
+    /// \param value the packed vector.
+    /// \returns the unpacked vector.
+    inline basic_vector4<float> unpack_r10g10b10a2(std::uint32_t value) noexcept
+    {
+        return { float(value & 0x3FF) / 1023.0f
+               , float((value >> 10) & 0x3FF) / 1023.0f
+               , float((value >> 20) & 0x3FF) / 1023.0f
+               , float(value >> 30) / 3.0f };
+    }
+
+    /// Packs vectors with components in the [0, 1] range, as pack_r10g10b10a2 does.
+    /// \param source the vectors to pack.
+    /// \param destination the packed vectors, of the same size as the source.
+    inline void pack_r10g10b10a2(gsl::span<const basic_vector4<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale   = _mm_set1_ps(1023.0f);
+        const auto scale_w = _mm_set1_ps(3.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto x = _mm_loadu_ps(source[i].data());
+            auto y = _mm_loadu_ps(source[i + 1].data());
+            auto z = _mm_loadu_ps(source[i + 2].data());
+            auto w = _mm_loadu_ps(source[i + 3].data());
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            auto px = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(x), scale));
+            auto py = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(y), scale));
+            auto pz = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(z), scale));
+            auto pw = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate(w), scale_w));
+
+            auto packed = _mm_or_si128(_mm_or_si128(px, _mm_slli_epi32(py, 10))
+                                     , _mm_or_si128(_mm_slli_epi32(pz, 20), _mm_slli_epi32(pw, 30)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), packed);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_r10g10b10a2(source[i]);
+        }
+    }
+
+    /// Unpacks vectors packed with pack_r10g10b10a2.
+    /// \param source the packed vectors.
+    /// \param destination the unpacked vectors, of the same size as the source.
+    inline void unpack_r10g10b10a2(gsl::span<const std::uint32_t> source, gsl::span<basic_vector4<float>> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto mask    = _mm_set1_epi32(0x3FF);
+        const auto scale   = _mm_set1_ps(1023.0f);
+        const auto scale_w = _mm_set1_ps(3.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+            auto x = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(value, mask)), scale);
+            auto y = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 10), mask)), scale);
+            auto z = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 20), mask)), scale);
+            auto w = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(value, 30)), scale_w);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            _mm_storeu_ps(destination[i].data(), x);
+            _mm_storeu_ps(destination[i + 1].data(), y);
+            _mm_storeu_ps(destination[i + 2].data(), z);
+            _mm_storeu_ps(destination[i + 3].data(), w);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_r10g10b10a2(source[i]);
+        }
+    }
+
+    /// Packs colors with components in the [0, 1] range as 10 bits red, green and blue and 2 bits alpha.
+    /// \param source the colors to pack.
+    /// \param destination the packed colors, of the same size as the source.
+    inline void pack_r10g10b10a2(gsl::span<const basic_color<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        static_assert(sizeof(basic_color<float>) == sizeof(basic_vector4<float>));
+
+        Expects(source.size() == destination.size());
+
+        // Colors and four component vectors share the same layout
+        pack_r10g10b10a2(gsl::span<const basic_vector4<float>> { reinterpret_cast<const basic_vector4<float>*>(source.data())
+                                                               , source.size() }
+                       , destination);
+    }
+
+    /// Unpacks colors packed with pack_r10g10b10a2.
+    /// \param source the packed colors.
+    /// \param destination the unpacked colors, of the same size as the source.
+    inline void unpack_r10g10b10a2(gsl::span<const std::uint32_t> source, gsl::span<basic_color<float>> destination) noexcept
+    {
+        static_assert(sizeof(basic_color<float>) == sizeof(basic_vector4<float>));
+
+        Expects(source.size() == destination.size());
+
+        unpack_r10g10b10a2(source
+                         , gsl::span<basic_vector4<float>> { reinterpret_cast<basic_vector4<float>*>(destination.data())
+                                                           , destination.size() });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // RGB9E5
+
+    /// Largest value representable by the RGB9E5 shared exponent format.
+    constexpr float rgb9e5_max = 65408.0f;
+
+    /// Packs a vector of non-negative values as three 9 bits mantissas sharing a 5 bits exponent, x in the least
+    /// significant bits. Values are clamped to [0, rgb9e5_max].
+    /// The round-trip error of every component is at most 2^-9 times the largest component.
+    ///
+    /// Reference: EXT_texture_shared_exponent.
+    /// \param value the vector to pack.
+    /// \returns the packed vector.
+    inline std::uint32_t pack_rgb9e5(const basic_vector3<float>& value) noexcept
+    {
+        auto x    = (value.x > 0.0f) ? std::min(value.x, rgb9e5_max) : 0.0f;
+        auto y    = (value.y > 0.0f) ? std::min(value.y, rgb9e5_max) : 0.0f;
+        auto z    = (value.z > 0.0f) ? std::min(value.z, rgb9e5_max) : 0.0f;
+        auto maxc = std::max(std::max(x, y), z);
+
+        // floor(log2(maxc)) read from the float exponent, with a bias of 15 and 9 mantissa bits
+        auto exponent = std::max(int(detail::to_bits(maxc) >> 23) - 127, -16) + 16;
+        auto scale    = detail::from_bits(std::uint32_t(127 + 24 - exponent) << 23);
+
+        if (std::nearbyint(maxc * scale) == 512.0f)
+        {
+            ++exponent;
+            scale *= 0.5f;
+        }
+
+        auto mx = static_cast<std::uint32_t>(std::nearbyint(x * scale));
+        auto my = static_cast<std::uint32_t>(std::nearbyint(y * scale));
+        auto mz = static_cast<std::uint32_t>(std::nearbyint(z * scale));
+
+        return mx | (my << 9) | (mz << 18) | (std::uint32_t(exponent) << 27);
+    }
+
+    /// Unpacks a vector packed with pack_rgb9e5.
+    /// \param value the packed vector.
+    /// \returns the unpacked vector.
+    inline basic_vector3<float> unpack_rgb9e5(std::uint32_t value) noexcept
+    {
+        auto scale = detail::from_bits(((value >> 27) + 127 - 24) << 23);
+
+        return { float(value & 0x1FF) * scale, float((value >> 9) & 0x1FF) * scale, float((value >> 18) & 0x1FF) * scale };
+    }
+
+    /// Packs vectors of non-negative values, as pack_rgb9e5 does.
+    /// \param source the vectors to pack.
+    /// \param destination the packed vectors, of the same size as the source.
+    inline void pack_rgb9e5(gsl::span<const basic_vector3<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto upper = _mm_set1_ps(rgb9e5_max);
+        const auto zero  = _mm_setzero_ps();
+        const auto half  = _mm_set1_ps(0.5f);
+        const auto bias  = _mm_set1_epi32(127 + 24);
+        const auto top   = _mm_set1_ps(511.5f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x;
+            __m128 y;
+            __m128 z;
+
+            detail::load_soa3(source[i].data(), x, y, z);
+
+            x = _mm_min_ps(_mm_max_ps(x, zero), upper);
+            y = _mm_min_ps(_mm_max_ps(y, zero), upper);
+            z = _mm_min_ps(_mm_max_ps(z, zero), upper);
+
+            auto maxc     = _mm_max_ps(_mm_max_ps(x, y), z);
+            auto exponent = _mm_srli_epi32(_mm_castps_si128(maxc), 23);
+
+            // max(e - 127, -16) + 16 computed as max(e, 111) - 111
+            exponent = _mm_sub_epi32(exponent, _mm_set1_epi32(111));
+            exponent = _mm_and_si128(exponent, _mm_cmpgt_epi32(exponent, _mm_setzero_si128()));
+
+            auto scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(bias, exponent), 23));
+
+            // The largest mantissa rounds up to 512 when maxc * scale >= 511.5, ties going to the even 512
+            auto carry = _mm_cmpge_ps(_mm_mul_ps(maxc, scale), top);
+
+            exponent = _mm_sub_epi32(exponent, _mm_castps_si128(carry));
+            scale    = _mm_mul_ps(scale, _mm_or_ps(_mm_and_ps(carry, half), _mm_andnot_ps(carry, _mm_set1_ps(1.0f))));
+
+            auto mx = _mm_cvtps_epi32(_mm_mul_ps(x, scale));
+            auto my = _mm_cvtps_epi32(_mm_mul_ps(y, scale));
+            auto mz = _mm_cvtps_epi32(_mm_mul_ps(z, scale));
+
+            auto packed = _mm_or_si128(_mm_or_si128(mx, _mm_slli_epi32(my, 9))
+                                     , _mm_or_si128(_mm_slli_epi32(mz, 18), _mm_slli_epi32(exponent, 27)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), packed);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_rgb9e5(source[i]);
+        }
+    }
+
+    /// Unpacks vectors packed with pack_rgb9e5.
+    /// \param source the packed vectors.
+    /// \param destination the unpacked vectors, of the same size as the source.
+    inline void unpack_rgb9e5(gsl::span<const std::uint32_t> source, gsl::span<basic_vector3<float>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto mask = _mm_set1_epi32(0x1FF);
+        const auto bias = _mm_set1_epi32(127 - 24);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+            auto scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(value, 27), bias), 23));
+
+            auto x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(value, mask)), scale);
+            auto y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 9), mask)), scale);
+            auto z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 18), mask)), scale);
+
+            detail::store_soa3(destination[i].data(), x, y, z);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_rgb9e5(source[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // OCTAHEDRAL NORMALS
+
+    /// Maps a unit vector to the [-1, 1] square by projecting it onto an octahedron and unfolding the lower half.
+    ///
+    /// Reference: Cigolle et al. "A Survey of Efficient Representations for Independent Unit Vectors"
+    /// \param value the unit vector.
+    /// \returns the octahedral coordinates.
+    inline basic_vector2<float> encode_octahedral(const basic_vector3<float>& value) noexcept
+    {
+        auto inv = 1.0f / (std::abs(value.x) + std::abs(value.y) + std::abs(value.z));
+        auto x   = value.x * inv;
+        auto y   = value.y * inv;
+
+        if (value.z < 0.0f)
+        {
+            auto fx = (1.0f - std::abs(y)) * std::copysign(1.0f, x);
+            auto fy = (1.0f - std::abs(x)) * std::copysign(1.0f, y);
+
+            x = fx;
+            y = fy;
+        }
+
+        return { x, y };
+    }
+
+    /// Maps octahedral coordinates back to a unit vector.
+    /// \param value the octahedral coordinates.
+    /// \returns the unit vector.
+    inline basic_vector3<float> decode_octahedral(const basic_vector2<float>& value) noexcept
+    {
+        auto z = 1.0f - std::abs(value.x) - std::abs(value.y);
+        auto t = std::max(-z, 0.0f);
+        auto x = value.x - std::copysign(t, value.x);
+        auto y = value.y - std::copysign(t, value.y);
+        auto s = 1.0f / std::sqrt(x * x + y * y + z * z);
+
+        return { x * s, y * s, z * s };
+    }
+
+    /// Packs a unit vector as two 16 bits signed normalized octahedral coordinates, x in the least significant bits.
+    /// The round-trip angular error is below 0.005 degrees.
+    /// \param value the unit vector.
+    /// \returns the packed vector.
+    inline std::uint32_t pack_octahedral16(const basic_vector3<float>& value) noexcept
+    {
+        auto p = encode_octahedral(value);
+
+        return std::uint16_t(pack_snorm16(p.x)) | (std::uint32_t(std::uint16_t(pack_snorm16(p.y))) << 16);
+    }
+
+    /// Unpacks a unit vector packed with pack_octahedral16.
+    /// \param value the packed vector.
+    /// \returns the unit vector.
+    inline basic_vector3<float> unpack_octahedral16(std::uint32_t value) noexcept
+    {
+        return decode_octahedral({ unpack_snorm16(std::int16_t(value & 0xFFFF)), unpack_snorm16(std::int16_t(value >> 16)) });
+    }
+
+    /// Packs a unit vector as two 8 bits signed normalized octahedral coordinates, x in the least significant bits.
+    /// The round-trip angular error is below 1.2 degrees.
+    /// \param value the unit vector.
+    /// \returns the packed vector.
+    inline std::uint16_t pack_octahedral8(const basic_vector3<float>& value) noexcept
+    {
+        auto p = encode_octahedral(value);
+
+        return std::uint16_t(std::uint8_t(pack_snorm8(p.x)) | (std::uint8_t(pack_snorm8(p.y)) << 8));
+    }
+
+    /// Unpacks a unit vector packed with pack_octahedral8.
+    /// \param value the packed vector.
+    /// \returns the unit vector.
+    inline basic_vector3<float> unpack_octahedral8(std::uint16_t value) noexcept
+    {
+        return decode_octahedral({ unpack_snorm8(std::int8_t(value & 0xFF)), unpack_snorm8(std::int8_t(value >> 8)) });
+    }
+
+    /// Packs unit vectors, as pack_octahedral16 does.
+    /// \param source the unit vectors.
+    /// \param destination the packed vectors, of the same size as the source.
+    inline void pack_octahedral16(gsl::span<const basic_vector3<float>> source, gsl::span<std::uint32_t> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(32767.0f);
+        const auto mask  = _mm_set1_epi32(0xFFFF);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x;
+            __m128 y;
+            __m128 z;
+            __m128 px;
+            __m128 py;
+
+            detail::load_soa3(source[i].data(), x, y, z);
+            detail::encode_octahedral(x, y, z, px, py);
+
+            auto qx = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(px), scale));
+            auto qy = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(py), scale));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i)
+                           , _mm_or_si128(_mm_and_si128(qx, mask), _mm_slli_epi32(qy, 16)));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_octahedral16(source[i]);
+        }
+    }
+
+    /// Unpacks unit vectors packed with pack_octahedral16.
+    /// \param source the packed vectors.
+    /// \param destination the unit vectors, of the same size as the source.
+    inline void unpack_octahedral16(gsl::span<const std::uint32_t> source, gsl::span<basic_vector3<float>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto lower = _mm_set1_ps(-1.0f);
+        const auto scale = _mm_set1_ps(32767.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+
+            // Sign extend the low and high halves of every lane
+            auto px = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(value, 16), 16)), scale), lower);
+            auto py = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(value, 16)), scale), lower);
+
+            __m128 x;
+            __m128 y;
+            __m128 z;
+
+            detail::decode_octahedral(px, py, x, y, z);
+            detail::store_soa3(destination[i].data(), x, y, z);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_octahedral16(source[i]);
+        }
+    }
+
+    /// Packs unit vectors, as pack_octahedral8 does.
+    /// \param source the unit vectors.
+    /// \param destination the packed vectors, of the same size as the source.
+    inline void pack_octahedral8(gsl::span<const basic_vector3<float>> source, gsl::span<std::uint16_t> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto scale = _mm_set1_ps(127.0f);
+        const auto mask  = _mm_set1_epi32(0xFF);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x;
+            __m128 y;
+            __m128 z;
+            __m128 px;
+            __m128 py;
+
+            detail::load_soa3(source[i].data(), x, y, z);
+            detail::encode_octahedral(x, y, z, px, py);
+
+            auto qx = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(px), scale));
+            auto qy = _mm_cvtps_epi32(_mm_mul_ps(detail::saturate_signed(py), scale));
+
+            // qy << 8 keeps its sign, so every lane is in the 16 bits signed range and packs without saturating
+            auto packed = _mm_or_si128(_mm_and_si128(qx, mask), _mm_slli_epi32(qy, 8));
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(destination.data() + i), _mm_packs_epi32(packed, packed));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = pack_octahedral8(source[i]);
+        }
+    }
+
+    /// Unpacks unit vectors packed with pack_octahedral8.
+    /// \param source the packed vectors.
+    /// \param destination the unit vectors, of the same size as the source.
+    inline void unpack_octahedral8(gsl::span<const std::uint16_t> source, gsl::span<basic_vector3<float>> destination) noexcept
+    {
+        static_assert(sizeof(basic_vector3<float>) == 3 * sizeof(float));
+
+        Expects(source.size() == destination.size());
+
+        std::size_t count = source.size();
+        std::size_t i     = 0;
+
+#if defined(__SSE2__)
+        const auto lower = _mm_set1_ps(-1.0f);
+        const auto scale = _mm_set1_ps(127.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            auto value = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source.data() + i))
+                                          , _mm_setzero_si128());
+
+            // Sign extend the low and high bytes of every lane
+            auto px = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(value, 24), 24)), scale), lower);
+            auto py = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(value, 16), 24)), scale), lower);
+
+            __m128 x;
+            __m128 y;
+            __m128 z;
+
+            detail::decode_octahedral(px, py, x, y, z);
+            detail::store_soa3(destination[i].data(), x, y, z);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = unpack_octahedral8(source[i]);
+        }
+    }
+}
+
+#endif // SCENER_MATH_PACKED_VECTOR_HPP
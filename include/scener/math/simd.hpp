@@ -0,0 +1,1503 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_SIMD_HPP
+#define SCENER_MATH_SIMD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SCENER_MATH_SIMD_X86 1
+// GCC 12 reports the undefined source operands of the AVX-512 intrinsics as uninitialized (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+// Enables an instruction set on a single function. The AVX and AVX-512 types are always defined on x86-64, their
+// operations carry the instruction set they need, so they can be used from functions compiled for it (see
+// cpu_dispatch.cpp) whatever the flags of the translation unit. MSVC accepts any intrinsic in any function.
+#if defined(__GNUC__) || defined(__clang__)
+#define SCENER_MATH_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SCENER_MATH_SIMD_TARGET(isa)
+#endif
+
+#define SCENER_MATH_SIMD_AVX    SCENER_MATH_SIMD_TARGET("avx2,fma")
+#define SCENER_MATH_SIMD_AVX512 SCENER_MATH_SIMD_TARGET("avx512f")
+
+/// Thin wrappers over SIMD registers, for writing batch kernels once for every instruction set.
+///
+/// simd<float, N, Abi> holds N floats and mask<N, Abi> the result of comparing them. The Abi selects the storage:
+/// simd_abi::scalar is a plain array processed with loops and is available everywhere, the other ABIs hold a single
+/// SSE, AVX or AVX-512 register. The default ABI for a width is the native one when the translation unit is compiled
+/// for it and the scalar one otherwise, so a kernel written against simd<float, 4> runs with SSE on x86-64 and as
+/// scalar code elsewhere. Every operation rounds as the scalar operation does except fma, which is fused where the
+/// instruction set supports it, rsqrt, which is approximate, and the horizontal reductions, which may sum in any order.
+namespace scener::math::detail
+{
+    /// Tags selecting the storage of simd and mask values.
+    namespace simd_abi
+    {
+        /// N values stored in an array.
+        struct scalar final
+        {
+        };
+
+#if defined(SCENER_MATH_SIMD_X86)
+        /// Four floats in an SSE register.
+        struct sse final
+        {
+        };
+
+        /// Eight floats in an AVX register, with AVX2 and FMA.
+        struct avx final
+        {
+        };
+
+        /// Sixteen floats in an AVX-512 register.
+        struct avx512 final
+        {
+        };
+#endif
+
+        template <std::size_t N>
+        struct native_of
+        {
+            using type = scalar;
+        };
+
+#if defined(__SSE2__) || defined(_M_X64)
+        template <>
+        struct native_of<4>
+        {
+            using type = sse;
+        };
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+        template <>
+        struct native_of<8>
+        {
+            using type = avx;
+        };
+#endif
+
+#if defined(__AVX512F__)
+        template <>
+        struct native_of<16>
+        {
+            using type = avx512;
+        };
+#endif
+
+        /// The ABI of N floats the translation unit is compiled for, the scalar one when there is none.
+        template <std::size_t N>
+        using native = typename native_of<N>::type;
+
+        /// The ABI of the inline batch kernels of the headers, SSE on x86-64 and scalar elsewhere. Unlike native it
+        /// does not depend on the flags of the translation unit, so those kernels are the same in every translation
+        /// unit; wider registers are left to the dispatch library.
+#if defined(SCENER_MATH_SIMD_X86)
+        using fixed = sse;
+#else
+        using fixed = scalar;
+#endif
+    }
+
+    /// Number of floats of the widest register the translation unit is compiled for.
+#if defined(__AVX512F__)
+    constexpr std::size_t simd_native_width = 16;
+#elif defined(__AVX2__) && defined(__FMA__)
+    constexpr std::size_t simd_native_width = 8;
+#elif defined(__SSE2__) || defined(_M_X64)
+    constexpr std::size_t simd_native_width = 4;
+#else
+    constexpr std::size_t simd_native_width = 1;
+#endif
+
+    /// Flag for loads and stores whose address is only aligned to the element type.
+    struct element_aligned_tag
+    {
+    };
+
+    /// Flag for loads and stores whose address is aligned to the size of the simd type.
+    struct vector_aligned_tag
+    {
+    };
+
+    constexpr element_aligned_tag element_aligned { };
+    constexpr vector_aligned_tag  vector_aligned { };
+
+    template <std::size_t N, typename Abi = simd_abi::native<N>>
+    class mask;
+
+    template <typename T, std::size_t N, typename Abi = simd_abi::native<N>>
+    class simd;
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // SCALAR
+
+    /// N booleans, stored as the bits of an integer.
+    template <std::size_t N>
+    class mask<N, simd_abi::scalar> final
+    {
+        static_assert(N > 0 && N <= 32, "scalar masks hold up to 32 lanes");
+
+    public:
+        mask() noexcept = default;
+
+        /// Initializes a new instance of the mask class with every lane set to the given value.
+        constexpr mask(bool value) noexcept
+            : _bits { value ? all_bits : 0u }
+        {
+        }
+
+        /// Initializes a new instance of the mask class from its bits, lane i is set when bit i is.
+        static constexpr mask from_bits(std::uint32_t bits) noexcept
+        {
+            mask result;
+
+            result._bits = bits & all_bits;
+
+            return result;
+        }
+
+    public:
+        /// Gets the number of lanes.
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        /// Gets the lanes as the bits of an integer, bit i is set when lane i is.
+        constexpr std::uint32_t bits() const noexcept
+        {
+            return _bits;
+        }
+
+        /// Gets the value of the given lane.
+        constexpr bool operator[](std::size_t index) const noexcept
+        {
+            return ((_bits >> index) & 1u) != 0;
+        }
+
+    private:
+        static constexpr std::uint32_t all_bits = (N == 32) ? ~0u : ((1u << N) - 1u);
+
+        std::uint32_t _bits;
+    };
+
+    /// N floats stored in an array.
+    template <std::size_t N>
+    class simd<float, N, simd_abi::scalar> final
+    {
+    public:
+        using value_type = float;
+        using mask_type  = mask<N, simd_abi::scalar>;
+
+    public:
+        simd() noexcept = default;
+
+        /// Initializes a new instance of the simd class with every lane set to the given value.
+        constexpr simd(float value) noexcept
+            : _values { }
+        {
+            for (auto& item : _values)
+            {
+                item = value;
+            }
+        }
+
+        /// Loads N floats.
+        template <typename Flags = element_aligned_tag>
+        static simd load(const float* source, Flags = { }) noexcept
+        {
+            simd result;
+
+            std::copy(source, source + N, result._values.begin());
+
+            return result;
+        }
+
+        /// Loads four floats into every group of four lanes.
+        static simd broadcast4(const float* source) noexcept
+        {
+            static_assert(N % 4 == 0, "the width must be a multiple of four");
+
+            simd result;
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                result._values[i] = source[i % 4];
+            }
+
+            return result;
+        }
+
+    public:
+        /// Gets the number of lanes.
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        /// Stores the N floats.
+        template <typename Flags = element_aligned_tag>
+        void store(float* destination, Flags = { }) const noexcept
+        {
+            std::copy(_values.begin(), _values.end(), destination);
+        }
+
+        /// Gets the value of the given lane.
+        constexpr float operator[](std::size_t index) const noexcept
+        {
+            return _values[index];
+        }
+
+        /// Gets or sets the value of the given lane.
+        constexpr float& operator[](std::size_t index) noexcept
+        {
+            return _values[index];
+        }
+
+    private:
+        std::array<float, N> _values;
+    };
+
+    template <std::size_t N>
+    constexpr mask<N, simd_abi::scalar> operator&(mask<N, simd_abi::scalar> lhs, mask<N, simd_abi::scalar> rhs) noexcept
+    {
+        return mask<N, simd_abi::scalar>::from_bits(lhs.bits() & rhs.bits());
+    }
+
+    template <std::size_t N>
+    constexpr mask<N, simd_abi::scalar> operator|(mask<N, simd_abi::scalar> lhs, mask<N, simd_abi::scalar> rhs) noexcept
+    {
+        return mask<N, simd_abi::scalar>::from_bits(lhs.bits() | rhs.bits());
+    }
+
+    template <std::size_t N>
+    constexpr mask<N, simd_abi::scalar> operator^(mask<N, simd_abi::scalar> lhs, mask<N, simd_abi::scalar> rhs) noexcept
+    {
+        return mask<N, simd_abi::scalar>::from_bits(lhs.bits() ^ rhs.bits());
+    }
+
+    template <std::size_t N>
+    constexpr mask<N, simd_abi::scalar> operator!(mask<N, simd_abi::scalar> value) noexcept
+    {
+        return mask<N, simd_abi::scalar>::from_bits(~value.bits());
+    }
+
+    /// Checks whether any lane of the mask is set.
+    template <std::size_t N>
+    constexpr bool any_of(mask<N, simd_abi::scalar> value) noexcept
+    {
+        return value.bits() != 0;
+    }
+
+    /// Checks whether every lane of the mask is set.
+    template <std::size_t N>
+    constexpr bool all_of(mask<N, simd_abi::scalar> value) noexcept
+    {
+        return value.bits() == mask<N, simd_abi::scalar>(true).bits();
+    }
+
+    /// Checks whether no lane of the mask is set.
+    template <std::size_t N>
+    constexpr bool none_of(mask<N, simd_abi::scalar> value) noexcept
+    {
+        return value.bits() == 0;
+    }
+
+    namespace simd_scalar
+    {
+        /// Applies a function to every lane of its arguments.
+        template <std::size_t N, typename F, typename... Args>
+        inline simd<float, N, simd_abi::scalar> map(F&& f, const Args&... args) noexcept
+        {
+            simd<float, N, simd_abi::scalar> result;
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                result[i] = f(args[i]...);
+            }
+
+            return result;
+        }
+
+        /// Compares every lane of its arguments.
+        template <std::size_t N, typename F>
+        inline mask<N, simd_abi::scalar> compare(F&&                                     f
+                                               , const simd<float, N, simd_abi::scalar>& lhs
+                                               , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+        {
+            std::uint32_t bits = 0;
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                bits |= std::uint32_t(f(lhs[i], rhs[i]) ? 1 : 0) << i;
+            }
+
+            return mask<N, simd_abi::scalar>::from_bits(bits);
+        }
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> operator+(const simd<float, N, simd_abi::scalar>& lhs
+                                                    , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return a + b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> operator-(const simd<float, N, simd_abi::scalar>& lhs
+                                                    , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return a - b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> operator*(const simd<float, N, simd_abi::scalar>& lhs
+                                                    , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return a * b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> operator/(const simd<float, N, simd_abi::scalar>& lhs
+                                                    , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return a / b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> operator-(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        return simd_scalar::map<N>([](float a) { return -a; }, value);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator==(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a == b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator!=(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a != b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator<(const simd<float, N, simd_abi::scalar>& lhs
+                                             , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a < b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator<=(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a <= b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator>(const simd<float, N, simd_abi::scalar>& lhs
+                                             , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a > b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline mask<N, simd_abi::scalar> operator>=(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::compare([](float a, float b) { return a >= b; }, lhs, rhs);
+    }
+
+    /// Computes a * b + c.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> fma(const simd<float, N, simd_abi::scalar>& a
+                                              , const simd<float, N, simd_abi::scalar>& b
+                                              , const simd<float, N, simd_abi::scalar>& c) noexcept
+    {
+        return simd_scalar::map<N>([](float x, float y, float z) { return x * y + z; }, a, b, c);
+    }
+
+    /// Computes the minimum of every pair of lanes; returns the second lane when either is not a number.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> min(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return (a < b) ? a : b; }, lhs, rhs);
+    }
+
+    /// Computes the maximum of every pair of lanes; returns the second lane when either is not a number.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> max(const simd<float, N, simd_abi::scalar>& lhs
+                                              , const simd<float, N, simd_abi::scalar>& rhs) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float b) { return (a > b) ? a : b; }, lhs, rhs);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> abs(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        return simd_scalar::map<N>([](float a) { return std::fabs(a); }, value);
+    }
+
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> sqrt(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        return simd_scalar::map<N>([](float a) { return std::sqrt(a); }, value);
+    }
+
+    /// Computes the reciprocal of the square root of every lane, approximately on the SIMD ABIs.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> rsqrt(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        return simd_scalar::map<N>([](float a) { return 1.0f / std::sqrt(a); }, value);
+    }
+
+    /// Rounds every lane to the nearest integer, ties to even; the lanes must be below 2^31 in magnitude.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> round(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        return simd_scalar::map<N>([](float a) { return std::nearbyint(a); }, value);
+    }
+
+    /// Multiplies every lane by 2^exponent; the lanes of exponent hold integers in [-126, 127].
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> ldexp(const simd<float, N, simd_abi::scalar>& value
+                                                , const simd<float, N, simd_abi::scalar>& exponent) noexcept
+    {
+        return simd_scalar::map<N>([](float a, float e) { return std::ldexp(a, static_cast<int>(e)); }
+                                 , value
+                                 , exponent);
+    }
+
+    /// Splits every lane into a mantissa in [0.5, 1), which is returned, and a power of two, stored in exponent, as
+    /// std::frexp does; the lanes must be finite normal numbers.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> frexp(const simd<float, N, simd_abi::scalar>& value
+                                                , simd<float, N, simd_abi::scalar>&       exponent) noexcept
+    {
+        simd<float, N, simd_abi::scalar> result;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            int e = 0;
+
+            result[i]   = std::frexp(value[i], &e);
+            exponent[i] = static_cast<float>(e);
+        }
+
+        return result;
+    }
+
+    /// Selects the lanes of a where the mask is set and the lanes of b elsewhere.
+    template <std::size_t N>
+    inline simd<float, N, simd_abi::scalar> select(const mask<N, simd_abi::scalar>&        condition
+                                                 , const simd<float, N, simd_abi::scalar>& a
+                                                 , const simd<float, N, simd_abi::scalar>& b) noexcept
+    {
+        simd<float, N, simd_abi::scalar> result;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            result[i] = condition[i] ? a[i] : b[i];
+        }
+
+        return result;
+    }
+
+    /// Rearranges every group of four lanes, lane k of a group takes lane Ik of the same group.
+    template <int I0, int I1, int I2, int I3, std::size_t N>
+    inline simd<float, N, simd_abi::scalar> shuffle(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        static_assert(N % 4 == 0, "the width must be a multiple of four");
+
+        constexpr int indices[4] = { I0, I1, I2, I3 };
+
+        simd<float, N, simd_abi::scalar> result;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            result[i] = value[(i & ~std::size_t(3)) + indices[i & 3]];
+        }
+
+        return result;
+    }
+
+    /// Sums every lane.
+    template <std::size_t N>
+    inline float horizontal_add(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        float result = value[0];
+
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            result += value[i];
+        }
+
+        return result;
+    }
+
+    /// Gets the minimum of every lane.
+    template <std::size_t N>
+    inline float horizontal_min(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        float result = value[0];
+
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            result = (value[i] < result) ? value[i] : result;
+        }
+
+        return result;
+    }
+
+    /// Gets the maximum of every lane.
+    template <std::size_t N>
+    inline float horizontal_max(const simd<float, N, simd_abi::scalar>& value) noexcept
+    {
+        float result = value[0];
+
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            result = (value[i] > result) ? value[i] : result;
+        }
+
+        return result;
+    }
+
+#if defined(SCENER_MATH_SIMD_X86)
+    // -----------------------------------------------------------------------------------------------------------------
+    // SSE
+
+    /// Four booleans in an SSE register, a lane is set when all its bits are.
+    template <>
+    class mask<4, simd_abi::sse> final
+    {
+    public:
+        mask() noexcept = default;
+
+        /// Initializes a new instance of the mask class with every lane set to the given value.
+        mask(bool value) noexcept
+            : _value { _mm_castsi128_ps(_mm_set1_epi32(value ? -1 : 0)) }
+        {
+        }
+
+        /// Initializes a new instance of the mask class from an SSE register.
+        explicit mask(__m128 value) noexcept
+            : _value { value }
+        {
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 4;
+        }
+
+        std::uint32_t bits() const noexcept
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_ps(_value));
+        }
+
+        bool operator[](std::size_t index) const noexcept
+        {
+            return ((bits() >> index) & 1u) != 0;
+        }
+
+        /// Gets the SSE register.
+        __m128 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __m128 _value;
+    };
+
+    /// Four floats in an SSE register.
+    template <>
+    class simd<float, 4, simd_abi::sse> final
+    {
+    public:
+        using value_type = float;
+        using mask_type  = mask<4, simd_abi::sse>;
+
+    public:
+        simd() noexcept = default;
+
+        /// Initializes a new instance of the simd class with every lane set to the given value.
+        simd(float value) noexcept
+            : _value { _mm_set1_ps(value) }
+        {
+        }
+
+        /// Initializes a new instance of the simd class from an SSE register.
+        explicit simd(__m128 value) noexcept
+            : _value { value }
+        {
+        }
+
+        static simd load(const float* source, element_aligned_tag = { }) noexcept
+        {
+            return simd { _mm_loadu_ps(source) };
+        }
+
+        static simd load(const float* source, vector_aligned_tag) noexcept
+        {
+            return simd { _mm_load_ps(source) };
+        }
+
+        static simd broadcast4(const float* source) noexcept
+        {
+            return simd { _mm_loadu_ps(source) };
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 4;
+        }
+
+        void store(float* destination, element_aligned_tag = { }) const noexcept
+        {
+            _mm_storeu_ps(destination, _value);
+        }
+
+        void store(float* destination, vector_aligned_tag) const noexcept
+        {
+            _mm_store_ps(destination, _value);
+        }
+
+        float operator[](std::size_t index) const noexcept
+        {
+            alignas(16) float values[4];
+
+            _mm_store_ps(values, _value);
+
+            return values[index];
+        }
+
+        /// Gets the SSE register.
+        __m128 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __m128 _value;
+    };
+
+    using simd4_sse = simd<float, 4, simd_abi::sse>;
+    using mask4_sse = mask<4, simd_abi::sse>;
+
+    inline mask4_sse operator&(mask4_sse lhs, mask4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_and_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator|(mask4_sse lhs, mask4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_or_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator^(mask4_sse lhs, mask4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_xor_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator!(mask4_sse value) noexcept
+    {
+        return mask4_sse { _mm_xor_ps(value.native(), _mm_castsi128_ps(_mm_set1_epi32(-1))) };
+    }
+
+    inline bool any_of(mask4_sse value) noexcept
+    {
+        return value.bits() != 0;
+    }
+
+    inline bool all_of(mask4_sse value) noexcept
+    {
+        return value.bits() == 0xF;
+    }
+
+    inline bool none_of(mask4_sse value) noexcept
+    {
+        return value.bits() == 0;
+    }
+
+    inline simd4_sse operator+(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_add_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse operator-(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_sub_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse operator*(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_mul_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse operator/(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_div_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse operator-(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_xor_ps(value.native(), _mm_set1_ps(-0.0f)) };
+    }
+
+    inline mask4_sse operator==(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmpeq_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator!=(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmpneq_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator<(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmplt_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator<=(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmple_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator>(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmpgt_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline mask4_sse operator>=(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return mask4_sse { _mm_cmpge_ps(lhs.native(), rhs.native()) };
+    }
+
+    /// Computes a * b + c, as two operations: SSE has no fused multiply-add.
+    inline simd4_sse fma(simd4_sse a, simd4_sse b, simd4_sse c) noexcept
+    {
+        return simd4_sse { _mm_add_ps(_mm_mul_ps(a.native(), b.native()), c.native()) };
+    }
+
+    inline simd4_sse min(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_min_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse max(simd4_sse lhs, simd4_sse rhs) noexcept
+    {
+        return simd4_sse { _mm_max_ps(lhs.native(), rhs.native()) };
+    }
+
+    inline simd4_sse abs(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_andnot_ps(_mm_set1_ps(-0.0f), value.native()) };
+    }
+
+    inline simd4_sse sqrt(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_sqrt_ps(value.native()) };
+    }
+
+    /// Approximates the reciprocal of the square root, with a relative error below 1.5 * 2^-12.
+    inline simd4_sse rsqrt(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_rsqrt_ps(value.native()) };
+    }
+
+    /// Rounds with the rounding mode of the thread, which is to nearest unless changed.
+    inline simd4_sse round(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_cvtepi32_ps(_mm_cvtps_epi32(value.native())) };
+    }
+
+    inline simd4_sse ldexp(simd4_sse value, simd4_sse exponent) noexcept
+    {
+        auto e = _mm_add_epi32(_mm_cvtps_epi32(exponent.native()), _mm_set1_epi32(127));
+
+        return simd4_sse { _mm_mul_ps(value.native(), _mm_castsi128_ps(_mm_slli_epi32(e, 23))) };
+    }
+
+    inline simd4_sse frexp(simd4_sse value, simd4_sse& exponent) noexcept
+    {
+        auto bits = _mm_castps_si128(value.native());
+        auto e    = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7F800000)), 23);
+        auto m    = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(int(0x807FFFFF))), _mm_set1_epi32(0x3F000000));
+
+        exponent = simd4_sse { _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(126))) };
+
+        return simd4_sse { _mm_castsi128_ps(m) };
+    }
+
+    inline simd4_sse select(mask4_sse condition, simd4_sse a, simd4_sse b) noexcept
+    {
+        auto m = condition.native();
+
+        return simd4_sse { _mm_or_ps(_mm_and_ps(m, a.native()), _mm_andnot_ps(m, b.native())) };
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    inline simd4_sse shuffle(simd4_sse value) noexcept
+    {
+        return simd4_sse { _mm_shuffle_ps(value.native(), value.native(), _MM_SHUFFLE(I3, I2, I1, I0)) };
+    }
+
+    inline float horizontal_add(simd4_sse value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+
+        return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    inline float horizontal_min(simd4_sse value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_min_ps(v, _mm_movehl_ps(v, v));
+
+        return _mm_cvtss_f32(_mm_min_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    inline float horizontal_max(simd4_sse value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_max_ps(v, _mm_movehl_ps(v, v));
+
+        return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // AVX
+
+    /// Eight booleans in an AVX register, a lane is set when all its bits are.
+    template <>
+    class mask<8, simd_abi::avx> final
+    {
+    public:
+        mask() noexcept = default;
+
+        SCENER_MATH_SIMD_AVX mask(bool value) noexcept
+            : _value { _mm256_castsi256_ps(_mm256_set1_epi32(value ? -1 : 0)) }
+        {
+        }
+
+        /// Initializes a new instance of the mask class from an AVX register.
+        SCENER_MATH_SIMD_AVX explicit mask(__m256 value) noexcept
+            : _value { value }
+        {
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 8;
+        }
+
+        SCENER_MATH_SIMD_AVX std::uint32_t bits() const noexcept
+        {
+            return static_cast<std::uint32_t>(_mm256_movemask_ps(_value));
+        }
+
+        SCENER_MATH_SIMD_AVX bool operator[](std::size_t index) const noexcept
+        {
+            return ((bits() >> index) & 1u) != 0;
+        }
+
+        /// Gets the AVX register.
+        SCENER_MATH_SIMD_AVX __m256 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __m256 _value;
+    };
+
+    /// Eight floats in an AVX register.
+    template <>
+    class simd<float, 8, simd_abi::avx> final
+    {
+    public:
+        using value_type = float;
+        using mask_type  = mask<8, simd_abi::avx>;
+
+    public:
+        simd() noexcept = default;
+
+        SCENER_MATH_SIMD_AVX simd(float value) noexcept
+            : _value { _mm256_set1_ps(value) }
+        {
+        }
+
+        /// Initializes a new instance of the simd class from an AVX register.
+        SCENER_MATH_SIMD_AVX explicit simd(__m256 value) noexcept
+            : _value { value }
+        {
+        }
+
+        SCENER_MATH_SIMD_AVX static simd load(const float* source, element_aligned_tag = { }) noexcept
+        {
+            return simd { _mm256_loadu_ps(source) };
+        }
+
+        SCENER_MATH_SIMD_AVX static simd load(const float* source, vector_aligned_tag) noexcept
+        {
+            return simd { _mm256_load_ps(source) };
+        }
+
+        SCENER_MATH_SIMD_AVX static simd broadcast4(const float* source) noexcept
+        {
+            return simd { _mm256_broadcast_ps(reinterpret_cast<const __m128*>(source)) };
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 8;
+        }
+
+        SCENER_MATH_SIMD_AVX void store(float* destination, element_aligned_tag = { }) const noexcept
+        {
+            _mm256_storeu_ps(destination, _value);
+        }
+
+        SCENER_MATH_SIMD_AVX void store(float* destination, vector_aligned_tag) const noexcept
+        {
+            _mm256_store_ps(destination, _value);
+        }
+
+        SCENER_MATH_SIMD_AVX float operator[](std::size_t index) const noexcept
+        {
+            alignas(32) float values[8];
+
+            _mm256_store_ps(values, _value);
+
+            return values[index];
+        }
+
+        /// Gets the AVX register.
+        SCENER_MATH_SIMD_AVX __m256 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __m256 _value;
+    };
+
+    using simd8_avx = simd<float, 8, simd_abi::avx>;
+    using mask8_avx = mask<8, simd_abi::avx>;
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator&(mask8_avx lhs, mask8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_and_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator|(mask8_avx lhs, mask8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_or_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator^(mask8_avx lhs, mask8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_xor_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator!(mask8_avx value) noexcept
+    {
+        return mask8_avx { _mm256_xor_ps(value.native(), _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline bool any_of(mask8_avx value) noexcept
+    {
+        return value.bits() != 0;
+    }
+
+    SCENER_MATH_SIMD_AVX inline bool all_of(mask8_avx value) noexcept
+    {
+        return value.bits() == 0xFF;
+    }
+
+    SCENER_MATH_SIMD_AVX inline bool none_of(mask8_avx value) noexcept
+    {
+        return value.bits() == 0;
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx operator+(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_add_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx operator-(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_sub_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx operator*(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_mul_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx operator/(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_div_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx operator-(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_xor_ps(value.native(), _mm256_set1_ps(-0.0f)) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator==(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_EQ_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator!=(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_NEQ_UQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator<(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_LT_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator<=(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_LE_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator>(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_GT_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline mask8_avx operator>=(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return mask8_avx { _mm256_cmp_ps(lhs.native(), rhs.native(), _CMP_GE_OQ) };
+    }
+
+    /// Computes a * b + c with a single rounding.
+    SCENER_MATH_SIMD_AVX inline simd8_avx fma(simd8_avx a, simd8_avx b, simd8_avx c) noexcept
+    {
+        return simd8_avx { _mm256_fmadd_ps(a.native(), b.native(), c.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx min(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_min_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx max(simd8_avx lhs, simd8_avx rhs) noexcept
+    {
+        return simd8_avx { _mm256_max_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx abs(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx sqrt(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_sqrt_ps(value.native()) };
+    }
+
+    /// Approximates the reciprocal of the square root, with a relative error below 1.5 * 2^-12.
+    SCENER_MATH_SIMD_AVX inline simd8_avx rsqrt(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_rsqrt_ps(value.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx round(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_round_ps(value.native(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx ldexp(simd8_avx value, simd8_avx exponent) noexcept
+    {
+        auto e = _mm256_add_epi32(_mm256_cvtps_epi32(exponent.native()), _mm256_set1_epi32(127));
+
+        return simd8_avx { _mm256_mul_ps(value.native(), _mm256_castsi256_ps(_mm256_slli_epi32(e, 23))) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx frexp(simd8_avx value, simd8_avx& exponent) noexcept
+    {
+        auto bits = _mm256_castps_si256(value.native());
+        auto e    = _mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7F800000)), 23);
+        auto m    = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(int(0x807FFFFF)))
+                                  , _mm256_set1_epi32(0x3F000000));
+
+        exponent = simd8_avx { _mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(126))) };
+
+        return simd8_avx { _mm256_castsi256_ps(m) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline simd8_avx select(mask8_avx condition, simd8_avx a, simd8_avx b) noexcept
+    {
+        return simd8_avx { _mm256_blendv_ps(b.native(), a.native(), condition.native()) };
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    SCENER_MATH_SIMD_AVX inline simd8_avx shuffle(simd8_avx value) noexcept
+    {
+        return simd8_avx { _mm256_permute_ps(value.native(), _MM_SHUFFLE(I3, I2, I1, I0)) };
+    }
+
+    SCENER_MATH_SIMD_AVX inline float horizontal_add(simd8_avx value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+        return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    SCENER_MATH_SIMD_AVX inline float horizontal_min(simd8_avx value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+        s = _mm_min_ps(s, _mm_movehl_ps(s, s));
+
+        return _mm_cvtss_f32(_mm_min_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    SCENER_MATH_SIMD_AVX inline float horizontal_max(simd8_avx value) noexcept
+    {
+        auto v = value.native();
+        auto s = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+        s = _mm_max_ps(s, _mm_movehl_ps(s, s));
+
+        return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // AVX-512
+
+    /// Sixteen booleans in an AVX-512 mask register.
+    template <>
+    class mask<16, simd_abi::avx512> final
+    {
+    public:
+        mask() noexcept = default;
+
+        constexpr mask(bool value) noexcept
+            : _value { static_cast<__mmask16>(value ? 0xFFFF : 0) }
+        {
+        }
+
+        /// Initializes a new instance of the mask class from an AVX-512 mask register.
+        constexpr explicit mask(__mmask16 value) noexcept
+            : _value { value }
+        {
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 16;
+        }
+
+        constexpr std::uint32_t bits() const noexcept
+        {
+            return _value;
+        }
+
+        constexpr bool operator[](std::size_t index) const noexcept
+        {
+            return ((_value >> index) & 1u) != 0;
+        }
+
+        /// Gets the AVX-512 mask register.
+        constexpr __mmask16 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __mmask16 _value;
+    };
+
+    /// Sixteen floats in an AVX-512 register.
+    template <>
+    class simd<float, 16, simd_abi::avx512> final
+    {
+    public:
+        using value_type = float;
+        using mask_type  = mask<16, simd_abi::avx512>;
+
+    public:
+        simd() noexcept = default;
+
+        SCENER_MATH_SIMD_AVX512 simd(float value) noexcept
+            : _value { _mm512_set1_ps(value) }
+        {
+        }
+
+        /// Initializes a new instance of the simd class from an AVX-512 register.
+        SCENER_MATH_SIMD_AVX512 explicit simd(__m512 value) noexcept
+            : _value { value }
+        {
+        }
+
+        SCENER_MATH_SIMD_AVX512 static simd load(const float* source, element_aligned_tag = { }) noexcept
+        {
+            return simd { _mm512_loadu_ps(source) };
+        }
+
+        SCENER_MATH_SIMD_AVX512 static simd load(const float* source, vector_aligned_tag) noexcept
+        {
+            return simd { _mm512_load_ps(source) };
+        }
+
+        SCENER_MATH_SIMD_AVX512 static simd broadcast4(const float* source) noexcept
+        {
+            return simd { _mm512_broadcast_f32x4(_mm_loadu_ps(source)) };
+        }
+
+    public:
+        static constexpr std::size_t size() noexcept
+        {
+            return 16;
+        }
+
+        SCENER_MATH_SIMD_AVX512 void store(float* destination, element_aligned_tag = { }) const noexcept
+        {
+            _mm512_storeu_ps(destination, _value);
+        }
+
+        SCENER_MATH_SIMD_AVX512 void store(float* destination, vector_aligned_tag) const noexcept
+        {
+            _mm512_store_ps(destination, _value);
+        }
+
+        SCENER_MATH_SIMD_AVX512 float operator[](std::size_t index) const noexcept
+        {
+            alignas(64) float values[16];
+
+            _mm512_store_ps(values, _value);
+
+            return values[index];
+        }
+
+        /// Gets the AVX-512 register.
+        SCENER_MATH_SIMD_AVX512 __m512 native() const noexcept
+        {
+            return _value;
+        }
+
+    private:
+        __m512 _value;
+    };
+
+    using simd16_avx512 = simd<float, 16, simd_abi::avx512>;
+    using mask16_avx512 = mask<16, simd_abi::avx512>;
+
+    constexpr mask16_avx512 operator&(mask16_avx512 lhs, mask16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { static_cast<__mmask16>(lhs.native() & rhs.native()) };
+    }
+
+    constexpr mask16_avx512 operator|(mask16_avx512 lhs, mask16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { static_cast<__mmask16>(lhs.native() | rhs.native()) };
+    }
+
+    constexpr mask16_avx512 operator^(mask16_avx512 lhs, mask16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { static_cast<__mmask16>(lhs.native() ^ rhs.native()) };
+    }
+
+    constexpr mask16_avx512 operator!(mask16_avx512 value) noexcept
+    {
+        return mask16_avx512 { static_cast<__mmask16>(~value.native()) };
+    }
+
+    constexpr bool any_of(mask16_avx512 value) noexcept
+    {
+        return value.native() != 0;
+    }
+
+    constexpr bool all_of(mask16_avx512 value) noexcept
+    {
+        return value.native() == 0xFFFF;
+    }
+
+    constexpr bool none_of(mask16_avx512 value) noexcept
+    {
+        return value.native() == 0;
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 operator+(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_add_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 operator-(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_sub_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 operator*(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_mul_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 operator/(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_div_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 operator-(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_sub_ps(_mm512_setzero_ps(), value.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator==(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_EQ_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator!=(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_NEQ_UQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator<(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_LT_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator<=(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_LE_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator>(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_GT_OQ) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline mask16_avx512 operator>=(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return mask16_avx512 { _mm512_cmp_ps_mask(lhs.native(), rhs.native(), _CMP_GE_OQ) };
+    }
+
+    /// Computes a * b + c with a single rounding.
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 fma(simd16_avx512 a, simd16_avx512 b, simd16_avx512 c) noexcept
+    {
+        return simd16_avx512 { _mm512_fmadd_ps(a.native(), b.native(), c.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 min(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_min_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 max(simd16_avx512 lhs, simd16_avx512 rhs) noexcept
+    {
+        return simd16_avx512 { _mm512_max_ps(lhs.native(), rhs.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 abs(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_abs_ps(value.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 sqrt(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_sqrt_ps(value.native()) };
+    }
+
+    /// Approximates the reciprocal of the square root, with a relative error below 2^-14.
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 rsqrt(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_rsqrt14_ps(value.native()) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 round(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_roundscale_ps(value.native(), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 ldexp(simd16_avx512 value, simd16_avx512 exponent) noexcept
+    {
+        auto e = _mm512_add_epi32(_mm512_cvtps_epi32(exponent.native()), _mm512_set1_epi32(127));
+
+        return simd16_avx512 { _mm512_mul_ps(value.native(), _mm512_castsi512_ps(_mm512_slli_epi32(e, 23))) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 frexp(simd16_avx512 value, simd16_avx512& exponent) noexcept
+    {
+        auto bits = _mm512_castps_si512(value.native());
+        auto e    = _mm512_srli_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x7F800000)), 23);
+        auto m    = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(int(0x807FFFFF)))
+                                  , _mm512_set1_epi32(0x3F000000));
+
+        exponent = simd16_avx512 { _mm512_cvtepi32_ps(_mm512_sub_epi32(e, _mm512_set1_epi32(126))) };
+
+        return simd16_avx512 { _mm512_castsi512_ps(m) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 select(mask16_avx512 condition
+                                                      , simd16_avx512 a
+                                                      , simd16_avx512 b) noexcept
+    {
+        return simd16_avx512 { _mm512_mask_blend_ps(condition.native(), b.native(), a.native()) };
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    SCENER_MATH_SIMD_AVX512 inline simd16_avx512 shuffle(simd16_avx512 value) noexcept
+    {
+        return simd16_avx512 { _mm512_permute_ps(value.native(), _MM_SHUFFLE(I3, I2, I1, I0)) };
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline float horizontal_add(simd16_avx512 value) noexcept
+    {
+        return _mm512_reduce_add_ps(value.native());
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline float horizontal_min(simd16_avx512 value) noexcept
+    {
+        return _mm512_reduce_min_ps(value.native());
+    }
+
+    SCENER_MATH_SIMD_AVX512 inline float horizontal_max(simd16_avx512 value) noexcept
+    {
+        return _mm512_reduce_max_ps(value.native());
+    }
+#endif
+}
+
+#endif // SCENER_MATH_SIMD_HPP
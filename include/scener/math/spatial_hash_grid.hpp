@@ -0,0 +1,9 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_SPATIAL_HASH_GRID_HPP
+#define SCENER_MATH_SPATIAL_HASH_GRID_HPP
+
+#include "scener/math/basic_spatial_hash_grid.hpp"
+
+#endif // SCENER_MATH_SPATIAL_HASH_GRID_HPP
@@ -0,0 +1,9 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_SWEEP_AND_PRUNE_HPP
+#define SCENER_MATH_SWEEP_AND_PRUNE_HPP
+
+#include "scener/math/basic_sweep_and_prune.hpp"
+
+#endif // SCENER_MATH_SWEEP_AND_PRUNE_HPP
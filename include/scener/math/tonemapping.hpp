@@ -0,0 +1,192 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_TONEMAPPING_HPP
+#define SCENER_MATH_TONEMAPPING_HPP
+
+#include <type_traits>
+
+#include "scener/math/basic_color.hpp"
+#include "scener/math/color_space.hpp"
+
+/// Operators mapping linear high dynamic range colors to the [0, 1] range, before encoding them for display.
+namespace scener::math::tonemap
+{
+    namespace detail
+    {
+        template <typename V>
+        inline void reinhard(V& r, V& g, V& b, float white) noexcept
+        {
+            // c * (1 + c / white^2) / (1 + c)
+            auto one     = V { 1.0f };
+            auto inverse = V { 1.0f / (white * white) };
+
+            r = r * (one + r * inverse) / (one + r);
+            g = g * (one + g * inverse) / (one + g);
+            b = b * (one + b * inverse) / (one + b);
+        }
+
+        /// Input transform of the ACES fitted curve: sRGB to AP1, with the RRT saturation adjustment.
+        inline constexpr float aces_input[9] = { 0.59719f, 0.35458f, 0.04823f
+                                               , 0.07600f, 0.90834f, 0.01566f
+                                               , 0.02840f, 0.13383f, 0.83777f };
+
+        /// Output transform of the ACES fitted curve: ODT saturation adjustment, AP1 to sRGB.
+        inline constexpr float aces_output[9] = {  1.60475f, -0.53108f, -0.07367f
+                                                , -0.10208f,  1.10813f, -0.00605f
+                                                , -0.00327f, -0.07276f,  1.07602f };
+
+        template <typename V>
+        inline V aces_curve(const V& v) noexcept
+        {
+            // (v * (v + 0.0245786) - 0.000090537) / (v * (0.983729 * v + 0.4329510) + 0.238081)
+            auto a = v * (v + V { 0.0245786f }) - V { 0.000090537f };
+            auto b = v * (V { 0.983729f } * v + V { 0.4329510f }) + V { 0.238081f };
+
+            return a / b;
+        }
+
+        template <typename V>
+        inline void aces_fitted(V& r, V& g, V& b) noexcept
+        {
+            auto zero = V { 0.0f };
+            auto one  = V { 1.0f };
+
+            math::detail::color_kernels::transform(r, g, b, aces_input);
+
+            r = aces_curve(r);
+            g = aces_curve(g);
+            b = aces_curve(b);
+
+            math::detail::color_kernels::transform(r, g, b, aces_output);
+
+            r = min(max(r, zero), one);
+            g = min(max(g, zero), one);
+            b = min(max(b, zero), one);
+        }
+
+        template <typename V>
+        inline V filmic_curve(const V& x) noexcept
+        {
+            // ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F
+            constexpr float A = 0.15f;
+            constexpr float B = 0.50f;
+            constexpr float C = 0.10f;
+            constexpr float D = 0.20f;
+            constexpr float E = 0.02f;
+            constexpr float F = 0.30f;
+
+            auto ax = V { A } * x;
+            auto n  = x * (ax + V { C * B }) + V { D * E };
+            auto d  = x * (ax + V { B }) + V { D * F };
+
+            return n / d - V { E / F };
+        }
+
+        template <typename V>
+        inline void filmic(V& r, V& g, V& b, float white) noexcept
+        {
+            auto scale = V { 1.0f } / filmic_curve(V { white });
+
+            r = filmic_curve(r) * scale;
+            g = filmic_curve(g) * scale;
+            b = filmic_curve(b) * scale;
+        }
+    }
+
+    /// Applies the Reinhard operator, c / (1 + c), to a linear color. Alpha is kept as is.
+    /// \param value the linear color, with channels greater than or equal to zero.
+    /// \returns the tonemapped color.
+    inline basic_color<float> reinhard(const basic_color<float>& value) noexcept
+    {
+        return { value.r / (1.0f + value.r), value.g / (1.0f + value.g), value.b / (1.0f + value.b), value.a };
+    }
+
+    /// Applies the extended Reinhard operator, mapping the given white level to one. Alpha is kept as is.
+    /// \param value the linear color, with channels greater than or equal to zero.
+    /// \param white the smallest channel value mapped to one.
+    /// \returns the tonemapped color.
+    inline basic_color<float> reinhard(const basic_color<float>& value, float white) noexcept
+    {
+        return math::detail::color_kernels::apply(value, [white](auto& r, auto& g, auto& b)
+        {
+            detail::reinhard(r, g, b, white);
+        });
+    }
+
+    /// Applies the Reinhard operator to colors stored as a structure of arrays.
+    /// \param source the linear colors.
+    /// \param destination the tonemapped colors, of the same size as the source; may be the source itself.
+    inline void reinhard(const_color_planes source, color_planes destination) noexcept
+    {
+        math::detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            auto one = std::decay_t<decltype(r)> { 1.0f };
+
+            r = r / (one + r);
+            g = g / (one + g);
+            b = b / (one + b);
+        });
+    }
+
+    /// Applies the extended Reinhard operator to colors stored as a structure of arrays.
+    /// \param source the linear colors.
+    /// \param destination the tonemapped colors, of the same size as the source; may be the source itself.
+    /// \param white the smallest channel value mapped to one.
+    inline void reinhard(const_color_planes source, color_planes destination, float white) noexcept
+    {
+        math::detail::color_kernels::for_each(source, destination, [white](auto& r, auto& g, auto& b)
+        {
+            detail::reinhard(r, g, b, white);
+        });
+    }
+
+    /// Applies the ACES filmic curve fitted by Stephen Hill, including the input and output color transforms of the
+    /// reference rendering and sRGB output transforms, to a linear sRGB color. Alpha is kept as is.
+    /// \param value the linear color.
+    /// \returns the tonemapped color, with channels in [0, 1].
+    inline basic_color<float> aces_fitted(const basic_color<float>& value) noexcept
+    {
+        return math::detail::color_kernels::apply(value, [](auto& r, auto& g, auto& b)
+        {
+            detail::aces_fitted(r, g, b);
+        });
+    }
+
+    /// Applies the ACES fitted curve to colors stored as a structure of arrays.
+    /// \param source the linear colors.
+    /// \param destination the tonemapped colors, of the same size as the source; may be the source itself.
+    inline void aces_fitted(const_color_planes source, color_planes destination) noexcept
+    {
+        math::detail::color_kernels::for_each(source, destination, [](auto& r, auto& g, auto& b)
+        {
+            detail::aces_fitted(r, g, b);
+        });
+    }
+
+    /// Applies John Hable's filmic curve, scaled so the given white level maps to one. Alpha is kept as is.
+    /// \param value the linear color, with channels greater than or equal to zero.
+    /// \param white the linear white level.
+    /// \returns the tonemapped color.
+    inline basic_color<float> filmic(const basic_color<float>& value, float white = 11.2f) noexcept
+    {
+        return math::detail::color_kernels::apply(value, [white](auto& r, auto& g, auto& b)
+        {
+            detail::filmic(r, g, b, white);
+        });
+    }
+
+    /// Applies John Hable's filmic curve to colors stored as a structure of arrays.
+    /// \param source the linear colors.
+    /// \param destination the tonemapped colors, of the same size as the source; may be the source itself.
+    /// \param white the linear white level.
+    inline void filmic(const_color_planes source, color_planes destination, float white = 11.2f) noexcept
+    {
+        math::detail::color_kernels::for_each(source, destination, [white](auto& r, auto& g, auto& b)
+        {
+            detail::filmic(r, g, b, white);
+        });
+    }
+}
+
+#endif // SCENER_MATH_TONEMAPPING_HPP
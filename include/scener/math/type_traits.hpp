@@ -0,0 +1,23 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef SCENER_MATH_TYPE_TRAITS_HPP
+#define SCENER_MATH_TYPE_TRAITS_HPP
+
+#include <type_traits>
+
+namespace scener::math
+{
+    /// Checks whether T is an arithmetic type or a type that behaves as one, like the half and bfloat16 storage
+    /// types, and can be used as the element type of vectors, matrices and the other math types.
+    template <typename T>
+    struct is_arithmetic_like : std::is_arithmetic<T>
+    {
+    };
+
+    /// Helper variable template for is_arithmetic_like.
+    template <typename T>
+    constexpr bool is_arithmetic_like_v = is_arithmetic_like<T>::value;
+}
+
+#endif // SCENER_MATH_TYPE_TRAITS_HPP
@@ -0,0 +1,306 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "scener/math/cpu_dispatch.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+
+#include <gsl/assert>
+
+#include "scener/math/simd.hpp"
+
+#if defined(SCENER_MATH_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Inlines every call made by a kernel into it. The simd kernels of the headers are templates without the target
+// attribute, so they only run with the instruction set of a kernel once inlined into it.
+#if defined(__GNUC__) || defined(__clang__)
+#define SCENER_MATH_DISPATCH_FLATTEN __attribute__((flatten))
+#else
+#define SCENER_MATH_DISPATCH_FLATTEN
+#endif
+
+namespace scener::math::dispatch
+{
+    namespace
+    {
+        // -------------------------------------------------------------------------------------------------------------
+        // SCALAR KERNELS
+
+        namespace scalar
+        {
+            void transform(gsl::span<const vector4> source
+                         , const matrix4&           matrix
+                         , gsl::span<vector4>       destination) noexcept
+            {
+                for (std::size_t i = 0; i < static_cast<std::size_t>(source.size()); ++i)
+                {
+                    destination[i] = source[i] * matrix;
+                }
+            }
+
+            void multiply(gsl::span<const matrix4> lhs
+                        , gsl::span<const matrix4> rhs
+                        , gsl::span<matrix4>       result) noexcept
+            {
+                for (std::size_t i = 0; i < static_cast<std::size_t>(lhs.size()); ++i)
+                {
+                    result[i] = lhs[i] * rhs[i];
+                }
+            }
+
+            void normalize(gsl::span<const vector3> source, gsl::span<vector3> destination) noexcept
+            {
+                for (std::size_t i = 0; i < static_cast<std::size_t>(source.size()); ++i)
+                {
+                    destination[i] = vector::normalize(source[i]);
+                }
+            }
+
+            void slerp(gsl::span<const quaternion> from
+                     , gsl::span<const quaternion> to
+                     , gsl::span<const float>      amount
+                     , gsl::span<quaternion>       result) noexcept
+            {
+                for (std::size_t i = 0; i < static_cast<std::size_t>(from.size()); ++i)
+                {
+                    result[i] = quat::slerp(from[i], to[i], amount[i]);
+                }
+            }
+
+            bounding_box bounds(gsl::span<const vector3> points) noexcept
+            {
+                auto result = bounding_box { points[0], points[0] };
+
+                for (const auto& point : points)
+                {
+                    result.min = vector::min(result.min, point);
+                    result.max = vector::max(result.max, point);
+                }
+
+                return result;
+            }
+
+            void cull(gsl::span<const bounding_sphere> spheres
+                    , const bounding_frustrum&         frustrum
+                    , gsl::span<std::uint8_t>          visible) noexcept
+            {
+                for (std::size_t i = 0; i < static_cast<std::size_t>(spheres.size()); ++i)
+                {
+                    visible[i] = static_cast<std::uint8_t>(intersects(frustrum, spheres[i]));
+                }
+            }
+        }
+
+        // -------------------------------------------------------------------------------------------------------------
+        // SIMD KERNELS
+
+#if defined(SCENER_MATH_SIMD_X86)
+        namespace sse2
+        {
+#define SCENER_MATH_DISPATCH_TARGET SCENER_MATH_SIMD_TARGET("sse2")
+#define SCENER_MATH_DISPATCH_ABI    math::detail::simd_abi::sse
+#define SCENER_MATH_DISPATCH_WIDTH  4
+#include "cpu_dispatch_kernels.inl"
+#undef SCENER_MATH_DISPATCH_WIDTH
+#undef SCENER_MATH_DISPATCH_ABI
+#undef SCENER_MATH_DISPATCH_TARGET
+        }
+
+        namespace avx2
+        {
+#define SCENER_MATH_DISPATCH_TARGET SCENER_MATH_SIMD_TARGET("avx2,fma")
+#define SCENER_MATH_DISPATCH_ABI    math::detail::simd_abi::avx
+#define SCENER_MATH_DISPATCH_WIDTH  8
+#include "cpu_dispatch_kernels.inl"
+#undef SCENER_MATH_DISPATCH_WIDTH
+#undef SCENER_MATH_DISPATCH_ABI
+#undef SCENER_MATH_DISPATCH_TARGET
+        }
+
+        namespace avx512
+        {
+#define SCENER_MATH_DISPATCH_TARGET SCENER_MATH_SIMD_TARGET("avx512f")
+#define SCENER_MATH_DISPATCH_ABI    math::detail::simd_abi::avx512
+#define SCENER_MATH_DISPATCH_WIDTH  16
+#include "cpu_dispatch_kernels.inl"
+#undef SCENER_MATH_DISPATCH_WIDTH
+#undef SCENER_MATH_DISPATCH_ABI
+#undef SCENER_MATH_DISPATCH_TARGET
+        }
+#endif
+
+        // -------------------------------------------------------------------------------------------------------------
+        // DISPATCH
+
+        struct kernel_table
+        {
+            instruction_set isa;
+            void (*transform)(gsl::span<const vector4>, const matrix4&, gsl::span<vector4>) noexcept;
+            void (*multiply)(gsl::span<const matrix4>, gsl::span<const matrix4>, gsl::span<matrix4>) noexcept;
+            void (*normalize)(gsl::span<const vector3>, gsl::span<vector3>) noexcept;
+            void (*slerp)(gsl::span<const quaternion>
+                        , gsl::span<const quaternion>
+                        , gsl::span<const float>
+                        , gsl::span<quaternion>) noexcept;
+            bounding_box (*bounds)(gsl::span<const vector3>) noexcept;
+            void (*cull)(gsl::span<const bounding_sphere>, const bounding_frustrum&, gsl::span<std::uint8_t>) noexcept;
+        };
+
+#define SCENER_MATH_KERNEL_TABLE(isa) \
+        kernel_table { instruction_set::isa, isa::transform, isa::multiply, isa::normalize, isa::slerp, isa::bounds \
+                     , isa::cull }
+
+        constexpr kernel_table kernel_tables[] =
+        {
+            SCENER_MATH_KERNEL_TABLE(scalar)
+#if defined(SCENER_MATH_SIMD_X86)
+          , SCENER_MATH_KERNEL_TABLE(sse2)
+          , SCENER_MATH_KERNEL_TABLE(avx2)
+          , SCENER_MATH_KERNEL_TABLE(avx512)
+#endif
+        };
+
+#undef SCENER_MATH_KERNEL_TABLE
+
+        instruction_set detect_instruction_set() noexcept
+        {
+#if defined(SCENER_MATH_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+            // The runtime checks whether the operating system saves the AVX and AVX-512 registers as well
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                return instruction_set::avx512;
+            }
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            {
+                return instruction_set::avx2;
+            }
+            return instruction_set::sse2;
+#elif defined(SCENER_MATH_SIMD_X86) && defined(_MSC_VER)
+            int info[4] = { };
+
+            __cpuid(info, 1);
+
+            bool fma     = (info[2] & (1 << 12)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            auto xcr0    = osxsave ? _xgetbv(0) : 0;
+
+            __cpuidex(info, 7, 0);
+
+            bool avx2    = (info[1] & (1 << 5)) != 0;
+            bool avx512f = (info[1] & (1 << 16)) != 0;
+
+            // XMM and YMM state, plus the opmask and ZMM state for AVX-512
+            if (avx512f && (xcr0 & 0xE6) == 0xE6)
+            {
+                return instruction_set::avx512;
+            }
+            if (avx2 && fma && (xcr0 & 0x06) == 0x06)
+            {
+                return instruction_set::avx2;
+            }
+
+            return instruction_set::sse2;
+#else
+            return instruction_set::scalar;
+#endif
+        }
+
+        const kernel_table& table_for(instruction_set value) noexcept
+        {
+            auto index = static_cast<std::size_t>(value);
+
+            return kernel_tables[index < std::size(kernel_tables) ? index : 0];
+        }
+
+        std::atomic<const kernel_table*> selected_table { nullptr };
+
+        const kernel_table& kernels() noexcept
+        {
+            auto table = selected_table.load(std::memory_order_acquire);
+
+            if (table == nullptr)
+            {
+                // Threads racing here all pick the same table
+                table = &table_for(supported_instruction_set());
+                selected_table.store(table, std::memory_order_release);
+            }
+
+            return *table;
+        }
+    }
+
+    instruction_set supported_instruction_set() noexcept
+    {
+        static const instruction_set supported = detect_instruction_set();
+
+        return supported;
+    }
+
+    instruction_set selected_instruction_set() noexcept
+    {
+        return kernels().isa;
+    }
+
+    instruction_set select_instruction_set(instruction_set value) noexcept
+    {
+        auto supported = supported_instruction_set();
+        auto table     = &table_for((value < supported) ? value : supported);
+
+        selected_table.store(table, std::memory_order_release);
+
+        return table->isa;
+    }
+
+    void transform(gsl::span<const vector4> source, const matrix4& matrix, gsl::span<vector4> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        kernels().transform(source, matrix, destination);
+    }
+
+    void multiply(gsl::span<const matrix4> lhs, gsl::span<const matrix4> rhs, gsl::span<matrix4> result) noexcept
+    {
+        Expects(lhs.size() == rhs.size() && lhs.size() == result.size());
+
+        kernels().multiply(lhs, rhs, result);
+    }
+
+    void normalize(gsl::span<const vector3> source, gsl::span<vector3> destination) noexcept
+    {
+        Expects(source.size() == destination.size());
+
+        kernels().normalize(source, destination);
+    }
+
+    void slerp(gsl::span<const quaternion> from
+             , gsl::span<const quaternion> to
+             , gsl::span<const float>      amount
+             , gsl::span<quaternion>       result) noexcept
+    {
+        Expects(from.size() == to.size() && from.size() == amount.size() && from.size() == result.size());
+
+        kernels().slerp(from, to, amount, result);
+    }
+
+    bounding_box bounds(gsl::span<const vector3> points) noexcept
+    {
+        Expects(!points.empty());
+
+        return kernels().bounds(points);
+    }
+
+    void cull(gsl::span<const bounding_sphere> spheres
+            , const bounding_frustrum&         frustrum
+            , gsl::span<std::uint8_t>          visible) noexcept
+    {
+        Expects(spheres.size() == visible.size());
+
+        kernels().cull(spheres, frustrum, visible);
+    }
+}
@@ -0,0 +1,263 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+// Batch kernels compiled once per instruction set. cpu_dispatch.cpp includes this file several times, each time
+// inside a different namespace and with the following macros defined:
+//
+//   SCENER_MATH_DISPATCH_TARGET  attribute enabling the instruction set on every function of this file.
+//   SCENER_MATH_DISPATCH_ABI     simd ABI of the instruction set.
+//   SCENER_MATH_DISPATCH_WIDTH   number of float lanes of the ABI, 4 (SSE), 8 (AVX) or 16 (AVX-512).
+//
+// The kernels are written against math::detail::simd, so only the ABI differs between instruction sets; every
+// function is marked with the target attribute so the operations of the ABI are inlined into them. Kernels calling the
+// simd templates of the headers are also marked with SCENER_MATH_DISPATCH_FLATTEN, so those templates are inlined too.
+// Elements left over after the last full register are handled by the scalar operations.
+
+#if !defined(SCENER_MATH_DISPATCH_TARGET) || !defined(SCENER_MATH_DISPATCH_ABI) || !defined(SCENER_MATH_DISPATCH_WIDTH)
+#error "cpu_dispatch_kernels.inl must be included by cpu_dispatch.cpp"
+#endif
+
+using lanes = math::detail::simd<float, SCENER_MATH_DISPATCH_WIDTH, SCENER_MATH_DISPATCH_ABI>;
+
+constexpr std::size_t width = lanes::size();
+
+/// Loads the components of a block of width 3D vectors into separate x, y and z registers.
+SCENER_MATH_DISPATCH_TARGET inline void deinterleave(const vector3* source, lanes& x, lanes& y, lanes& z) noexcept
+{
+    alignas(64) float vx[width];
+    alignas(64) float vy[width];
+    alignas(64) float vz[width];
+
+    for (std::size_t i = 0; i < width; ++i)
+    {
+        vx[i] = source[i].x;
+        vy[i] = source[i].y;
+        vz[i] = source[i].z;
+    }
+
+    x = lanes::load(vx, math::detail::vector_aligned);
+    y = lanes::load(vy, math::detail::vector_aligned);
+    z = lanes::load(vz, math::detail::vector_aligned);
+}
+
+/// Stores x, y and z registers as a block of width 3D vectors.
+SCENER_MATH_DISPATCH_TARGET inline void interleave(lanes x, lanes y, lanes z, vector3* destination) noexcept
+{
+    alignas(64) float vx[width];
+    alignas(64) float vy[width];
+    alignas(64) float vz[width];
+
+    x.store(vx, math::detail::vector_aligned);
+    y.store(vy, math::detail::vector_aligned);
+    z.store(vz, math::detail::vector_aligned);
+
+    for (std::size_t i = 0; i < width; ++i)
+    {
+        destination[i] = { vx[i], vy[i], vz[i] };
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// KERNELS
+
+/// Multiplies rows of four floats by a 4x4 matrix, width / 4 rows at a time.
+/// \returns the number of rows processed, the remaining ones do not fill a register.
+SCENER_MATH_DISPATCH_TARGET inline std::size_t multiply_rows(const float* source
+                                                           , std::size_t  rows
+                                                           , const float* matrix
+                                                           , float*       destination) noexcept
+{
+    constexpr std::size_t step = width / 4;
+
+    const auto r1 = lanes::broadcast4(matrix);
+    const auto r2 = lanes::broadcast4(matrix + 4);
+    const auto r3 = lanes::broadcast4(matrix + 8);
+    const auto r4 = lanes::broadcast4(matrix + 12);
+
+    std::size_t i = 0;
+
+    for (; i + step <= rows; i += step)
+    {
+        using math::detail::shuffle;
+
+        auto value  = lanes::load(source + i * 4);
+        auto result = shuffle<0, 0, 0, 0>(value) * r1;
+
+        result = fma(shuffle<1, 1, 1, 1>(value), r2, result);
+        result = fma(shuffle<2, 2, 2, 2>(value), r3, result);
+        result = fma(shuffle<3, 3, 3, 3>(value), r4, result);
+
+        result.store(destination + i * 4);
+    }
+
+    return i;
+}
+
+SCENER_MATH_DISPATCH_TARGET void transform(gsl::span<const vector4> source
+                                         , const matrix4&           matrix
+                                         , gsl::span<vector4>       destination) noexcept
+{
+    auto count = static_cast<std::size_t>(source.size());
+    auto i     = multiply_rows(reinterpret_cast<const float*>(source.data())
+                             , count
+                             , matrix.data()
+                             , reinterpret_cast<float*>(destination.data()));
+
+    for (; i < count; ++i)
+    {
+        destination[i] = source[i] * matrix;
+    }
+}
+
+SCENER_MATH_DISPATCH_TARGET void multiply(gsl::span<const matrix4> lhs
+                                        , gsl::span<const matrix4> rhs
+                                        , gsl::span<matrix4>       result) noexcept
+{
+    for (std::size_t i = 0; i < static_cast<std::size_t>(lhs.size()); ++i)
+    {
+        // The rows of the right hand side are loaded before anything is stored, so the result may alias it
+        multiply_rows(lhs[i].data(), 4, rhs[i].data(), result[i].data());
+    }
+}
+
+SCENER_MATH_DISPATCH_TARGET void normalize(gsl::span<const vector3> source, gsl::span<vector3> destination) noexcept
+{
+    auto        count = static_cast<std::size_t>(source.size());
+    std::size_t i     = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        lanes x, y, z;
+
+        deinterleave(source.data() + i, x, y, z);
+
+        auto length = sqrt(fma(z, z, fma(y, y, x * x)));
+
+        interleave(x / length, y / length, z / length, destination.data() + i);
+    }
+
+    for (; i < count; ++i)
+    {
+        destination[i] = vector::normalize(source[i]);
+    }
+}
+
+SCENER_MATH_DISPATCH_TARGET SCENER_MATH_DISPATCH_FLATTEN void slerp(gsl::span<const quaternion> from
+                                                                  , gsl::span<const quaternion> to
+                                                                  , gsl::span<const float>      amount
+                                                                  , gsl::span<quaternion>       result) noexcept
+{
+    auto        count = static_cast<std::size_t>(from.size());
+    std::size_t i     = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        lanes q1[4];
+        lanes q2[4];
+        lanes q[4];
+
+        math::detail::deinterleave(from.data() + i, q1[0], q1[1], q1[2], q1[3]);
+        math::detail::deinterleave(to.data() + i, q2[0], q2[1], q2[2], q2[3]);
+        math::detail::slerp(q1, q2, lanes::load(amount.data() + i), q);
+        math::detail::interleave(q[0], q[1], q[2], q[3], result.data() + i);
+    }
+
+    for (; i < count; ++i)
+    {
+        result[i] = quat::slerp(from[i], to[i], amount[i]);
+    }
+}
+
+SCENER_MATH_DISPATCH_TARGET bounding_box bounds(gsl::span<const vector3> points) noexcept
+{
+    auto        count  = static_cast<std::size_t>(points.size());
+    auto        result = bounding_box { points[0], points[0] };
+    std::size_t i      = 0;
+
+    if (count >= width)
+    {
+        lanes min_x, min_y, min_z;
+
+        deinterleave(points.data(), min_x, min_y, min_z);
+
+        auto max_x = min_x;
+        auto max_y = min_y;
+        auto max_z = min_z;
+
+        for (i = width; i + width <= count; i += width)
+        {
+            lanes x, y, z;
+
+            deinterleave(points.data() + i, x, y, z);
+
+            min_x = min(min_x, x);
+            min_y = min(min_y, y);
+            min_z = min(min_z, z);
+            max_x = max(max_x, x);
+            max_y = max(max_y, y);
+            max_z = max(max_z, z);
+        }
+
+        result.min = { horizontal_min(min_x), horizontal_min(min_y), horizontal_min(min_z) };
+        result.max = { horizontal_max(max_x), horizontal_max(max_y), horizontal_max(max_z) };
+    }
+
+    for (; i < count; ++i)
+    {
+        result.min = vector::min(result.min, points[i]);
+        result.max = vector::max(result.max, points[i]);
+    }
+
+    return result;
+}
+
+SCENER_MATH_DISPATCH_TARGET void cull(gsl::span<const bounding_sphere> spheres
+                                    , const bounding_frustrum&         frustrum
+                                    , gsl::span<std::uint8_t>          visible) noexcept
+{
+    alignas(64) float x[width];
+    alignas(64) float y[width];
+    alignas(64) float z[width];
+    alignas(64) float r[width];
+
+    const auto& planes = frustrum.planes();
+    auto        count  = static_cast<std::size_t>(spheres.size());
+    std::size_t i      = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        for (std::size_t j = 0; j < width; ++j)
+        {
+            x[j] = spheres[i + j].center.x;
+            y[j] = spheres[i + j].center.y;
+            z[j] = spheres[i + j].center.z;
+            r[j] = -spheres[i + j].radius;
+        }
+
+        auto vx     = lanes::load(x, math::detail::vector_aligned);
+        auto vy     = lanes::load(y, math::detail::vector_aligned);
+        auto vz     = lanes::load(z, math::detail::vector_aligned);
+        auto vr     = lanes::load(r, math::detail::vector_aligned);
+        auto inside = lanes::mask_type { true };
+
+        // A sphere is culled when it lies entirely behind any of the planes, whose normals point inside
+        for (const auto& p : planes)
+        {
+            auto distance = fma(lanes { p.normal.z }, vz, fma(lanes { p.normal.y }, vy, lanes { p.normal.x } * vx));
+
+            inside = inside & (distance + lanes { p.d } >= vr);
+        }
+
+        auto bits = inside.bits();
+
+        for (std::size_t j = 0; j < width; ++j)
+        {
+            visible[i + j] = static_cast<std::uint8_t>((bits >> j) & 1);
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        visible[i] = static_cast<std::uint8_t>(intersects(frustrum, spheres[i]));
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "aligned_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cstdint>
+#include <new>
+#include <random>
+#include <vector>
+
+#include <scener/math/aligned.hpp>
+#include <scener/math/matrix.hpp>
+#include <scener/math/quaternion.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    float random_value(std::mt19937& engine)
+    {
+        return std::uniform_real_distribution<float> { -2.0f, 2.0f }(engine);
+    }
+
+    matrix4 random_matrix(std::mt19937& engine)
+    {
+        matrix4 result;
+
+        for (auto& value : result)
+        {
+            value = random_value(engine);
+        }
+
+        return result;
+    }
+
+    vector4 random_vector(std::mt19937& engine)
+    {
+        return { random_value(engine), random_value(engine), random_value(engine), random_value(engine) };
+    }
+
+    /// Storage for objects placed four bytes past a 16 bytes boundary.
+    template <typename T>
+    struct misaligned
+    {
+        misaligned(std::size_t size)
+            : buffer((size * sizeof(T)) / sizeof(float) + 1)
+            , count { size }
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                new (data() + i) T { };
+            }
+        }
+
+        T* data()
+        {
+            return reinterpret_cast<T*>(buffer.data() + 1);
+        }
+
+        gsl::span<T> span()
+        {
+            return { data(), count };
+        }
+
+        std::vector<float, aligned_allocator<float, 16>> buffer;
+        std::size_t                                      count;
+    };
+}
+
+TEST_F(aligned_test, layout)
+{
+    static_assert(alignof(aligned_vector4) == 16 && sizeof(aligned_vector4) == 16);
+    static_assert(alignof(aligned_quaternion) == 16 && sizeof(aligned_quaternion) == 16);
+    static_assert(alignof(aligned_matrix4) == 32 && sizeof(aligned_matrix4) == 64);
+    static_assert(alignof(basic_aligned_vector4<double>) == 32 && sizeof(basic_aligned_vector4<double>) == 32);
+
+    aligned_vector4 values[3];
+
+    for (const auto& value : values)
+    {
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&value) % 16);
+    }
+}
+
+TEST_F(aligned_test, operations)
+{
+    aligned_vector4    v { 1.0f, 2.0f, 3.0f, 4.0f };
+    aligned_matrix4    m = matrix::create_translation(1.0f, 2.0f, 3.0f);
+    aligned_quaternion q = quaternion::identity();
+
+    v = v + vector4 { 1.0f, 1.0f, 1.0f, 1.0f };
+    v = vector::transform(v, m);
+
+    EXPECT_TRUE(equality_helper::equal(vector4 { 7.0f, 13.0f, 19.0f, 5.0f }, v));
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), q * q));
+    EXPECT_EQ(4.0f, v[3] - 1.0f);
+}
+
+TEST_F(aligned_test, allocator)
+{
+    std::vector<matrix4, aligned_allocator<matrix4, 64>> matrices(7);
+    std::vector<vector4, aligned_allocator<vector4, 16>> vectors(5);
+
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(matrices.data()) % 64);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(vectors.data()) % 16);
+
+    matrices.resize(1000);
+
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(matrices.data()) % 64);
+    EXPECT_TRUE(matrices[999] == matrix4 { });
+}
+
+TEST_F(aligned_test, multiply_span)
+{
+    std::mt19937 engine { 21 };
+
+    std::vector<matrix4, aligned_allocator<matrix4, 64>> lhs(37);
+    std::vector<matrix4, aligned_allocator<matrix4, 64>> rhs(lhs.size());
+    std::vector<matrix4, aligned_allocator<matrix4, 64>> result(lhs.size());
+    misaligned<matrix4>                                  unaligned(lhs.size());
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] = random_matrix(engine);
+        rhs[i] = random_matrix(engine);
+    }
+
+    matrix::multiply(lhs, rhs, result);
+    matrix::multiply(lhs, rhs, unaligned.span());
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(lhs[i] * rhs[i], result[i]));
+        EXPECT_TRUE(equality_helper::equal(result[i], unaligned.data()[i]));
+    }
+
+    // In place
+    matrix::multiply(lhs, rhs, lhs);
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(result[i], lhs[i]));
+    }
+}
+
+TEST_F(aligned_test, transform_span)
+{
+    std::mt19937 engine { 23 };
+
+    auto                                                 matrix = random_matrix(engine);
+    std::vector<vector4, aligned_allocator<vector4, 16>> source(101);
+    std::vector<vector4, aligned_allocator<vector4, 16>> result(source.size());
+    misaligned<vector4>                                  unaligned(source.size());
+
+    for (auto& value : source)
+    {
+        value = random_vector(engine);
+    }
+
+    vector::transform(source, matrix, result);
+    vector::transform(source, matrix, unaligned.span());
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(vector::transform(source[i], matrix), result[i]));
+        EXPECT_TRUE(equality_helper::equal(result[i], unaligned.data()[i]));
+    }
+}
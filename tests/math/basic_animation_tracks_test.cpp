@@ -0,0 +1,241 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_animation_tracks_test.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <scener/math/animation_tracks.hpp>
+
+#include "equality_helper.hpp"
+
+using namespace scener::math;
+
+namespace
+{
+    struct track_keys
+    {
+        std::vector<float>   times;
+        std::vector<vector3> values;
+        std::vector<vector3> tangents;
+    };
+
+    /// Random tracks of one to six keys, so the set does not fill a whole number of simd registers.
+    std::vector<track_keys> random_tracks(std::size_t count)
+    {
+        std::mt19937                          engine { 7 };
+        std::uniform_real_distribution<float> value { -10.0f, 10.0f };
+        std::uniform_real_distribution<float> step { 0.25f, 1.0f };
+        std::uniform_int_distribution<int>    keys { 1, 6 };
+        std::vector<track_keys>               tracks(count);
+
+        for (auto& track : tracks)
+        {
+            float time = -step(engine);
+
+            for (int i = keys(engine); i > 0; --i)
+            {
+                time += step(engine);
+
+                track.times.push_back(time);
+                track.values.push_back({ value(engine), value(engine), value(engine) });
+                track.tangents.push_back({ value(engine), value(engine), value(engine) });
+            }
+        }
+
+        return tracks;
+    }
+
+    /// Samples a track searching its keys from the start.
+    vector3 reference(const track_keys& track, curve_interpolation interpolation, float time)
+    {
+        auto count = track.times.size();
+
+        if (count == 1)
+        {
+            return track.values[0];
+        }
+
+        std::size_t i = 0;
+
+        while (i + 2 < count && time >= track.times[i + 1])
+        {
+            ++i;
+        }
+
+        auto length = track.times[i + 1] - track.times[i];
+        auto amount = std::clamp((time - track.times[i]) / length, 0.0f, 1.0f);
+
+        switch (interpolation)
+        {
+        case curve_interpolation::step:
+            return (amount < 1.0f) ? track.values[i] : track.values[i + 1];
+
+        case curve_interpolation::linear:
+            return vector::lerp(track.values[i], track.values[i + 1], amount);
+
+        case curve_interpolation::hermite:
+            return vector::hermite(track.values[i]
+                                 , track.tangents[i] * length
+                                 , track.values[i + 1]
+                                 , track.tangents[i + 1] * length
+                                 , amount);
+
+        default:
+            return vector::catmull_rom(track.values[(i > 0) ? i - 1 : i]
+                                     , track.values[i]
+                                     , track.values[i + 1]
+                                     , track.values[std::min(i + 2, count - 1)]
+                                     , amount);
+        }
+    }
+
+    vector3_animation_tracks make_tracks(const std::vector<track_keys>& keys, curve_interpolation interpolation)
+    {
+        vector3_animation_tracks tracks { interpolation };
+
+        for (const auto& track : keys)
+        {
+            if (interpolation == curve_interpolation::hermite)
+            {
+                tracks.add(track.times, track.values, track.tangents);
+            }
+            else
+            {
+                tracks.add(track.times, track.values);
+            }
+        }
+
+        return tracks;
+    }
+
+    bool near(const vector3& expected, const vector3& actual)
+    {
+        return vector::length(expected - actual) <= 1e-4f * std::max(1.0f, vector::length(expected));
+    }
+}
+
+TEST_F(basic_animation_tracks_test, evaluate)
+{
+    auto keys = random_tracks(37);
+
+    // Playback forward, then backwards and random seeks, and times past both ends
+    std::vector<float> times;
+
+    for (float time = -1.0f; time < 7.0f; time += 0.05f)
+    {
+        times.push_back(time);
+    }
+
+    times.insert(times.end(), { 3.0f, 0.5f, 5.25f, 0.0f, -3.0f, 12.0f, 1.0f });
+
+    for (auto interpolation : { curve_interpolation::step
+                              , curve_interpolation::linear
+                              , curve_interpolation::hermite
+                              , curve_interpolation::catmull_rom })
+    {
+        auto tracks = make_tracks(keys, interpolation);
+
+        EXPECT_EQ(keys.size(), tracks.size());
+
+        for (auto time : times)
+        {
+            for (std::uint32_t i = 0; i < keys.size(); ++i)
+            {
+                auto expected = reference(keys[i], interpolation, time);
+
+                EXPECT_TRUE(near(expected, tracks.evaluate(i, time))) << "track " << i << " time " << time;
+            }
+        }
+    }
+}
+
+TEST_F(basic_animation_tracks_test, batch_evaluate)
+{
+    auto                 keys = random_tracks(37);
+    std::vector<vector3> result(keys.size());
+
+    for (auto interpolation : { curve_interpolation::step
+                              , curve_interpolation::linear
+                              , curve_interpolation::hermite
+                              , curve_interpolation::catmull_rom })
+    {
+        auto tracks = make_tracks(keys, interpolation);
+
+        for (float time : { -1.0f, 0.0f, 0.3f, 0.6f, 1.7f, 2.0f, 0.2f, 4.5f, 9.0f })
+        {
+            tracks.evaluate(time, result);
+
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                auto expected = reference(keys[i], interpolation, time);
+
+                EXPECT_TRUE(near(expected, result[i])) << "track " << i << " time " << time;
+            }
+        }
+
+        std::vector<float> times(keys.size());
+
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            times[i] = 0.15f * static_cast<float>(i);
+        }
+
+        tracks.evaluate(times, result);
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            EXPECT_TRUE(near(reference(keys[i], interpolation, times[i]), result[i])) << "track " << i;
+        }
+    }
+}
+
+TEST_F(basic_animation_tracks_test, rotations)
+{
+    std::mt19937                          engine { 11 };
+    std::uniform_real_distribution<float> angle { -3.0f, 3.0f };
+    quaternion_animation_tracks           tracks;
+    std::vector<std::vector<quaternion>>  keys(21);
+    std::vector<float>                    times = { 0.0f, 0.5f, 1.5f, 2.0f };
+
+    for (auto& track : keys)
+    {
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            track.push_back(quat::create_from_yaw_pitch_roll(radians { angle(engine) }
+                                                           , radians { angle(engine) }
+                                                           , radians { angle(engine) }));
+        }
+
+        tracks.add(times, track);
+    }
+
+    // A track sampled between two almost equal keys goes through the linear fallback
+    keys[3][2] = keys[3][1];
+    tracks.clear();
+
+    for (const auto& track : keys)
+    {
+        tracks.add(times, track);
+    }
+
+    std::vector<quaternion> result(keys.size());
+
+    for (float time : { 0.0f, 0.2f, 0.7f, 1.0f, 1.6f, 2.0f, 0.4f, 3.0f })
+    {
+        tracks.evaluate(time, result);
+
+        std::size_t segment = (time < 0.5f) ? 0 : (time < 1.5f) ? 1 : 2;
+        float       amount  = std::clamp((time - times[segment]) / (times[segment + 1] - times[segment]), 0.0f, 1.0f);
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            auto expected = quat::slerp(keys[i][segment], keys[i][segment + 1], amount);
+
+            EXPECT_TRUE(equality_helper::equal(expected, result[i])) << "track " << i << " time " << time;
+            EXPECT_TRUE(equality_helper::equal(expected, tracks.evaluate(static_cast<std::uint32_t>(i), time)));
+        }
+    }
+}
@@ -0,0 +1,115 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_bounding_frustrum_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <scener/math/bounding_frustrum.hpp>
+#include <scener/math/matrix.hpp>
+
+using namespace scener::math;
+
+TEST_F(basic_bounding_frustrum_test, get_corners)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_2<> }, 2.0f, 1.0f, 10.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    auto corners = get_corners(frustrum);
+
+    // tan(45) = 1, so the half height equals the distance to the plane and the half width doubles it
+    EXPECT_TRUE(equality_helper::equal(vector3 { -2.0f,   1.0f,  -1.0f }, corners[0]));
+    EXPECT_TRUE(equality_helper::equal(vector3 {  2.0f,   1.0f,  -1.0f }, corners[1]));
+    EXPECT_TRUE(equality_helper::equal(vector3 {  2.0f,  -1.0f,  -1.0f }, corners[2]));
+    EXPECT_TRUE(equality_helper::equal(vector3 { -2.0f,  -1.0f,  -1.0f }, corners[3]));
+    EXPECT_TRUE(equality_helper::equal(vector3 { -20.0f,  10.0f, -10.0f }, corners[4]));
+    EXPECT_TRUE(equality_helper::equal(vector3 {  20.0f,  10.0f, -10.0f }, corners[5]));
+    EXPECT_TRUE(equality_helper::equal(vector3 {  20.0f, -10.0f, -10.0f }, corners[6]));
+    EXPECT_TRUE(equality_helper::equal(vector3 { -20.0f, -10.0f, -10.0f }, corners[7]));
+}
+
+TEST_F(basic_bounding_frustrum_test, contains_bounding_box)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_2<> }, 1.0f, 1.0f, 10.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    EXPECT_EQ(containment_type::contains  , contains(frustrum, bounding_box { { -1.0f, -1.0f, -6.0f }, { 1.0f, 1.0f, -4.0f } }));
+    EXPECT_EQ(containment_type::intersects, contains(frustrum, bounding_box { { -1.0f, -1.0f, -12.0f }, { 1.0f, 1.0f, -8.0f } }));
+    EXPECT_EQ(containment_type::disjoint  , contains(frustrum, bounding_box { { -1.0f, -1.0f, 2.0f }, { 1.0f, 1.0f, 4.0f } }));
+    EXPECT_EQ(containment_type::contains  , contains(frustrum, bounding_sphere { { 0.0f, 0.0f, -5.0f }, 1.0f }));
+    EXPECT_EQ(containment_type::contains  , contains(frustrum, vector3 { 0.0f, 0.0f, -5.0f }));
+    EXPECT_EQ(containment_type::disjoint  , contains(frustrum, vector3 { 0.0f, 0.0f, 5.0f }));
+}
+
+TEST_F(basic_bounding_frustrum_test, corners_and_edges_follow_matrix)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_2<> }, 1.0f, 1.0f, 10.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    EXPECT_EQ(6u, frustrum.edge_direction_count());
+    EXPECT_TRUE(equality_helper::equal(vector3 { -10.0f, 10.0f, -10.0f }, frustrum.corners()[4]));
+
+    frustrum.matrix(matrix::create_translation(0.0f, 0.0f, 5.0f) * view * projection);
+
+    EXPECT_TRUE(equality_helper::equal(vector3 { -10.0f, 10.0f, -15.0f }, frustrum.corners()[4]));
+}
+
+TEST_F(basic_bounding_frustrum_test, intersects_bounding_box_exactly)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_2<> }, 1.0f, 1.0f, 10.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    // Straddles the far and right planes, yet lies outside the edge they share
+    bounding_box  beyond_edge { { 11.048f, -0.8f, -11.566f }, { 12.648f, 0.8f, -9.966f } };
+    std::uint32_t plane_mask = frustrum_all_planes;
+
+    EXPECT_EQ(containment_type::intersects, contains(frustrum, beyond_edge, plane_mask));
+    EXPECT_EQ(containment_type::disjoint  , contains(frustrum, beyond_edge));
+    EXPECT_FALSE(intersects(frustrum, beyond_edge));
+
+    EXPECT_TRUE(intersects(frustrum, bounding_box { { 9.0f, -0.5f, -10.5f }, { 10.5f, 0.5f, -9.0f } }));
+    EXPECT_TRUE(intersects(frustrum, bounding_box { { -100.0f, -100.0f, -100.0f }, { 100.0f, 100.0f, 100.0f } }));
+}
+
+TEST_F(basic_bounding_frustrum_test, intersects_bounding_frustrum)
+{
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.0f, 1.0f, 20.0f);
+    auto narrow     = matrix::create_perspective_field_of_view(radians { pi_over_4<> * 0.5f }, 1.0f, 2.0f, 10.0f);
+    auto camera     = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto side       = matrix::create_look_at(vector3 { 10.0f, 0.0f, -10.0f }, vector3 { 0.0f, 0.0f, -10.0f }, vector3::up());
+    auto behind     = matrix::create_look_at(vector3 { 0.0f, 0.0f, 2.0f }, vector3 { 0.0f, 0.0f, 10.0f }, vector3::up());
+
+    bounding_frustrum frustrum { camera * projection };
+    bounding_frustrum crossing { side * projection };
+    bounding_frustrum opposite { behind * projection };
+    bounding_frustrum inner    { camera * narrow };
+
+    EXPECT_TRUE(intersects(frustrum, crossing));
+    EXPECT_TRUE(intersects(crossing, frustrum));
+    EXPECT_FALSE(intersects(frustrum, opposite));
+    EXPECT_FALSE(intersects(opposite, frustrum));
+
+    EXPECT_EQ(containment_type::intersects, contains(frustrum, crossing));
+    EXPECT_EQ(containment_type::disjoint  , contains(frustrum, opposite));
+    EXPECT_EQ(containment_type::contains  , contains(frustrum, inner));
+}
+
+TEST_F(basic_bounding_frustrum_test, intersects_plane)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_2<> }, 1.0f, 1.0f, 10.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    EXPECT_EQ(plane_intersection_type::intersecting, intersects(frustrum, plane_t { 0.0f, 0.0f, 1.0f, 5.0f }));
+    EXPECT_EQ(plane_intersection_type::front       , intersects(frustrum, plane_t { 0.0f, 0.0f, -1.0f, 0.0f }));
+    EXPECT_EQ(plane_intersection_type::back        , intersects(frustrum, plane_t { 0.0f, 0.0f, 1.0f, -1.0f }));
+}
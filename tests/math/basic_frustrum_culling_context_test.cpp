@@ -0,0 +1,118 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_frustrum_culling_context_test.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <scener/math/frustrum_culling_context.hpp>
+#include <scener/math/loose_octree.hpp>
+#include <scener/math/matrix.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    bounding_frustrum camera_frustrum(float yaw)
+    {
+        auto eye        = vector3 { 0.0f, 10.0f, 0.0f };
+        auto target     = eye + vector3 { std::sin(yaw), 0.0f, -std::cos(yaw) };
+        auto view       = matrix::create_look_at(eye, target, vector3::up());
+        auto projection = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.5f, 1.0f, 120.0f);
+
+        return { view * projection };
+    }
+
+    std::vector<bounding_box> generate_boxes(std::size_t count, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> position { -120.0f, 120.0f };
+        std::uniform_real_distribution<float> extent { 0.5f, 8.0f };
+        std::vector<bounding_box>             boxes;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            vector3 min { position(engine), position(engine) * 0.1f, position(engine) };
+            vector3 max { min.x + extent(engine), min.y + extent(engine), min.z + extent(engine) };
+
+            boxes.push_back({ min, max });
+        }
+
+        return boxes;
+    }
+}
+
+TEST_F(basic_frustrum_culling_context_test, remembers_rejecting_plane)
+{
+    frustrum_culling_context context { camera_frustrum(0.0f) };
+
+    bounding_box behind { { -1.0f, 9.0f, 10.0f }, { 1.0f, 11.0f, 12.0f } };
+    bounding_box ahead  { { -1.0f, 9.0f, -12.0f }, { 1.0f, 11.0f, -10.0f } };
+
+    EXPECT_EQ(containment_type::disjoint, context.contains_object(0, behind));
+    EXPECT_EQ(bounding_frustrum::near_plane, context.last_plane(0));
+    EXPECT_EQ(containment_type::contains, context.contains_object(1, ahead));
+
+    std::uint32_t plane_mask = frustrum_all_planes;
+
+    EXPECT_EQ(containment_type::disjoint, context.contains_object(0, behind, plane_mask));
+    EXPECT_EQ(0u, plane_mask);
+
+    context.clear();
+
+    EXPECT_EQ(0u, context.last_plane(0));
+}
+
+TEST_F(basic_frustrum_culling_context_test, matches_uncached_tests_across_frames)
+{
+    auto                     boxes = generate_boxes(400, 3);
+    frustrum_culling_context context { camera_frustrum(0.0f) };
+
+    for (std::uint32_t frame = 0; frame < 40; ++frame)
+    {
+        context.frustrum(camera_frustrum(float(frame) * 0.05f));
+
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            std::uint32_t expected_mask = frustrum_all_planes;
+            std::uint32_t actual_mask   = frustrum_all_planes;
+
+            auto expected = contains(context.frustrum(), boxes[i], expected_mask);
+            auto actual   = context.contains_object(i, boxes[i], actual_mask);
+
+            EXPECT_EQ(expected, actual);
+            EXPECT_EQ(expected_mask, actual_mask);
+        }
+    }
+}
+
+TEST_F(basic_frustrum_culling_context_test, loose_octree_query_matches_uncached_query)
+{
+    auto                     boxes = generate_boxes(600, 9);
+    loose_octree             tree { vector3::zero(), 128.0f };
+    frustrum_culling_context context { camera_frustrum(0.0f) };
+
+    for (const auto& box : boxes)
+    {
+        tree.insert(box);
+    }
+
+    for (std::uint32_t frame = 0; frame < 20; ++frame)
+    {
+        context.frustrum(camera_frustrum(float(frame) * 0.1f));
+
+        std::vector<std::uint32_t> expected;
+        std::vector<std::uint32_t> actual;
+
+        tree.query(context.frustrum(), [&] (std::uint32_t handle) { expected.push_back(handle); });
+        tree.query(context, [&] (std::uint32_t handle) { actual.push_back(handle); });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(expected, actual);
+    }
+}
@@ -0,0 +1,209 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_loose_octree_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <scener/math/loose_octree.hpp>
+#include <scener/math/matrix.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    std::vector<bounding_box> generate_boxes(std::size_t count, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> position { -120.0f, 120.0f };
+        std::uniform_real_distribution<float> extent { 0.05f, 12.0f };
+        std::vector<bounding_box>             boxes;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            vector3 min { position(engine), position(engine), position(engine) };
+            vector3 max { min.x + extent(engine), min.y + extent(engine), min.z + extent(engine) };
+
+            boxes.push_back({ min, max });
+        }
+
+        return boxes;
+    }
+
+    template <typename Query>
+    std::vector<std::uint32_t> collect(const loose_octree& tree, const Query& volume)
+    {
+        std::vector<std::uint32_t> result;
+
+        tree.query(volume, [&] (std::uint32_t handle) { result.push_back(handle); });
+
+        std::sort(result.begin(), result.end());
+
+        return result;
+    }
+}
+
+TEST_F(basic_loose_octree_test, insert_update_remove)
+{
+    loose_octree tree { vector3::zero(), 100.0f, 6 };
+
+    auto a = tree.insert({ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } });
+    auto b = tree.insert({ { 50.0f, 50.0f, 50.0f }, { 52.0f, 52.0f, 52.0f } });
+
+    EXPECT_EQ(2u, tree.size());
+    EXPECT_EQ(std::vector<std::uint32_t>({ a }), collect(tree, bounding_sphere { vector3::zero(), 2.0f }));
+
+    auto nodes = tree.node_count();
+
+    // Moving within the same cell does not touch the tree
+    tree.update(b, { { 50.5f, 50.5f, 50.5f }, { 52.5f, 52.5f, 52.5f } });
+
+    EXPECT_EQ(nodes, tree.node_count());
+    EXPECT_EQ(50.5f, tree.bounds(b).min.x);
+
+    tree.update(b, { { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } });
+
+    EXPECT_EQ(std::vector<std::uint32_t>({ a, b }), collect(tree, bounding_sphere { vector3::zero(), 2.0f }));
+
+    tree.remove(a);
+
+    EXPECT_EQ(1u, tree.size());
+    EXPECT_EQ(std::vector<std::uint32_t>({ b }), collect(tree, bounding_sphere { vector3::zero(), 2.0f }));
+
+    auto c = tree.insert({ { 500.0f, 500.0f, 500.0f }, { 501.0f, 501.0f, 501.0f } });
+
+    EXPECT_EQ(a, c); // handles are recycled
+    EXPECT_EQ(std::vector<std::uint32_t>({ c }), collect(tree, bounding_box { { 499.0f, 499.0f, 499.0f }, { 502.0f, 502.0f, 502.0f } }));
+
+    tree.clear();
+
+    EXPECT_EQ(0u, tree.size());
+    EXPECT_EQ(1u, tree.node_count());
+}
+
+TEST_F(basic_loose_octree_test, volume_queries_match_brute_force)
+{
+    auto         boxes = generate_boxes(600, 11);
+    loose_octree tree { vector3::zero(), 128.0f };
+
+    for (const auto& box : boxes)
+    {
+        tree.insert(box);
+    }
+
+    // Move a third of the objects around, some of them out of the world bounds
+    for (std::uint32_t i = 0; i < boxes.size(); i += 3)
+    {
+        auto offset = vector3 { float(i % 17) * 4.0f - 30.0f, float(i % 5) * 60.0f - 90.0f, float(i % 7) };
+
+        boxes[i] = { boxes[i].min + offset, boxes[i].max + offset };
+        tree.update(i, boxes[i]);
+    }
+
+    bounding_box    query_box    { { -30.0f, -10.0f, -40.0f }, { 25.0f, 45.0f, 10.0f } };
+    bounding_sphere query_sphere { { 60.0f, -20.0f, 5.0f }, 35.0f };
+
+    std::vector<std::uint32_t> expected_box;
+    std::vector<std::uint32_t> expected_sphere;
+
+    for (std::uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        if (intersects(query_box, boxes[i]))
+        {
+            expected_box.push_back(i);
+        }
+        if (intersects(boxes[i], query_sphere))
+        {
+            expected_sphere.push_back(i);
+        }
+    }
+
+    EXPECT_FALSE(expected_box.empty());
+    EXPECT_FALSE(expected_sphere.empty());
+    EXPECT_EQ(expected_box, collect(tree, query_box));
+    EXPECT_EQ(expected_sphere, collect(tree, query_sphere));
+}
+
+TEST_F(basic_loose_octree_test, frustrum_query_matches_brute_force)
+{
+    auto         boxes = generate_boxes(600, 23);
+    loose_octree tree { vector3::zero(), 128.0f };
+
+    for (const auto& box : boxes)
+    {
+        tree.insert(box);
+    }
+
+    auto view       = matrix::create_look_at(vector3 { 0.0f, 0.0f, 100.0f }, vector3::zero(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.5f, 1.0f, 150.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    std::vector<std::uint32_t> expected;
+
+    for (std::uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        std::uint32_t plane_mask = frustrum_all_planes;
+
+        // Frustum queries cull with the plane test, so they match it rather than the exact intersection test
+        if (contains(frustrum, boxes[i], plane_mask) != containment_type::disjoint)
+        {
+            expected.push_back(i);
+        }
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), boxes.size());
+    EXPECT_EQ(expected, collect(tree, frustrum));
+}
+
+TEST_F(basic_loose_octree_test, ray_query_matches_brute_force)
+{
+    auto         boxes = generate_boxes(600, 31);
+    loose_octree tree { vector3::zero(), 128.0f };
+
+    for (const auto& box : boxes)
+    {
+        tree.insert(box);
+    }
+
+    std::mt19937                          engine { 5 };
+    std::uniform_real_distribution<float> position { -100.0f, 100.0f };
+    std::size_t                           hits = 0;
+
+    for (std::uint32_t n = 0; n < 64; ++n)
+    {
+        vector3 origin { position(engine), position(engine), -150.0f };
+        vector3 target { position(engine), position(engine), position(engine) };
+        ray     probe  { origin, vector::normalize(target - origin) };
+
+        std::vector<std::uint32_t> expected;
+        std::vector<std::uint32_t> actual;
+
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            if (intersects(probe, boxes[i]))
+            {
+                expected.push_back(i);
+            }
+        }
+
+        tree.query(probe, [&] (std::uint32_t handle, float distance)
+        {
+            EXPECT_TRUE(equality_helper::equal(intersection_distance(probe, boxes[handle]).value(), distance));
+            actual.push_back(handle);
+        });
+
+        std::sort(actual.begin(), actual.end());
+
+        EXPECT_EQ(expected, actual);
+
+        hits += expected.size();
+    }
+
+    EXPECT_GT(hits, 0u);
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_math_test.hpp"
+
+#include <cmath>
+
+#include "equality_helper.hpp"
+
+using namespace scener::math;
+
+namespace
+{
+    // Evaluated by the compiler, so the constant expression paths are the ones being checked
+    constexpr auto rotation    = matrix::create_rotation_y(radians { pi_over_4<> });
+    constexpr auto projection  = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.5f, 1.0f, 100.0f);
+    constexpr auto orientation = quat::create_from_axis_angle(vector3::unit_z(), radians { pi_over_2<> });
+    constexpr auto axis_angle  = matrix::create_from_axis_angle(vector3 { 0.0f, 0.0f, 2.0f }, radians { pi_over_2<> });
+    constexpr auto euler       = matrix::create_from_yaw_pitch_roll(radians { 0.5f }, radians { -1.0f }, radians { 2.0f });
+    constexpr auto euler_quat  = quat::create_from_yaw_pitch_roll(radians { 0.5f }, radians { -1.0f }, radians { 2.0f });
+
+    static_assert(sqrt(16.0) == 4.0);
+    static_assert(sqrt(0.0f) == 0.0f);
+    static_assert(sin(0.0) == 0.0);
+    static_assert(cos(0.0) == 1.0);
+    static_assert(acos(1.0f) == 0.0f);
+    static_assert(sincos(0.0f).first == 0.0f && sincos(0.0f).second == 1.0f);
+
+    template <typename F, typename G>
+    double max_error(F&& actual, G&& expected, double low, double high)
+    {
+        constexpr int steps = 100000;
+
+        double result = 0.0;
+
+        for (int i = 0; i <= steps; ++i)
+        {
+            auto x = low + (high - low) * i / steps;
+
+            result = std::max(result, std::abs(actual(x) - expected(x)));
+        }
+
+        return result;
+    }
+}
+
+TEST_F(basic_math_test, constexpr_sin_cos_tan)
+{
+    auto dsin = [](double x) { return detail::sin(x); };
+    auto dcos = [](double x) { return detail::cos(x); };
+    auto dtan = [](double x) { return detail::tan(x); };
+    auto ssin = [](double x) { return std::sin(x); };
+    auto scos = [](double x) { return std::cos(x); };
+    auto stan = [](double x) { return std::tan(x); };
+
+    EXPECT_GT(1e-14, max_error(dsin, ssin, -100.0, 100.0));
+    EXPECT_GT(1e-14, max_error(dcos, scos, -100.0, 100.0));
+    EXPECT_GT(1e-12, max_error(dtan, stan, -1.5, 1.5));
+
+    EXPECT_TRUE(std::isnan(detail::sin(positive_infinity<double>)));
+    EXPECT_TRUE(std::isnan(detail::cos(NaN<double>)));
+}
+
+TEST_F(basic_math_test, sincos)
+{
+    auto dsin = [](double x) { return detail::sincos(x).first; };
+    auto dcos = [](double x) { return detail::sincos(x).second; };
+    auto ssin = [](double x) { return std::sin(x); };
+    auto scos = [](double x) { return std::cos(x); };
+
+    EXPECT_GT(1e-14, max_error(dsin, ssin, -100.0, 100.0));
+    EXPECT_GT(1e-14, max_error(dcos, scos, -100.0, 100.0));
+
+    for (float x = -10.0f; x <= 10.0f; x += 0.25f)
+    {
+        auto [s, c] = scener::math::sincos(x);
+
+        EXPECT_EQ(std::sin(x), s);
+        EXPECT_EQ(std::cos(x), c);
+    }
+
+    EXPECT_TRUE(std::isnan(detail::sincos(NaN<double>).first));
+    EXPECT_TRUE(std::isnan(detail::sincos(positive_infinity<double>).second));
+}
+
+TEST_F(basic_math_test, constexpr_sqrt_acos)
+{
+    auto dsqrt = [](double x) { return detail::sqrt(x); };
+    auto dacos = [](double x) { return detail::acos(x); };
+    auto ssqrt = [](double x) { return std::sqrt(x); };
+    auto sacos = [](double x) { return std::acos(x); };
+
+    EXPECT_GT(1e-15, max_error(dsqrt, ssqrt, 0.0, 1.0));
+    EXPECT_GT(1e-12, max_error(dsqrt, ssqrt, 0.0, 1e4));
+    EXPECT_GT(1e-15, max_error(dacos, sacos, -1.0, 1.0));
+
+    EXPECT_DOUBLE_EQ(std::sqrt(1e300), detail::sqrt(1e300));
+    EXPECT_DOUBLE_EQ(std::sqrt(1e-300), detail::sqrt(1e-300));
+    EXPECT_EQ(positive_infinity<double>, detail::sqrt(positive_infinity<double>));
+    EXPECT_TRUE(std::isnan(detail::sqrt(-1.0)));
+    EXPECT_TRUE(std::isnan(detail::acos(1.5)));
+    EXPECT_EQ(0.0, detail::acos(1.0));
+    EXPECT_EQ(pi<double>, detail::acos(-1.0));
+}
+
+TEST_F(basic_math_test, constexpr_transforms)
+{
+    auto angle = radians { pi_over_4<> };
+
+    EXPECT_TRUE(equality_helper::equal(matrix::create_rotation_y(angle), rotation));
+    EXPECT_TRUE(equality_helper::equal(matrix::create_perspective_field_of_view(angle, 1.5f, 1.0f, 100.0f)
+                                     , projection));
+    EXPECT_TRUE(equality_helper::equal(quat::create_from_axis_angle(vector3::unit_z(), radians { pi_over_2<> })
+                                     , orientation));
+    EXPECT_TRUE(equality_helper::equal(matrix::create_rotation_z(radians { pi_over_2<> }), axis_angle));
+    EXPECT_TRUE(equality_helper::equal(matrix::create_from_quaternion(euler_quat), euler));
+    EXPECT_TRUE(equality_helper::equal(matrix::create_rotation_z(radians { 2.0f })
+                                     * matrix::create_rotation_x(radians { -1.0f })
+                                     * matrix::create_rotation_y(radians { 0.5f })
+                                     , euler));
+}
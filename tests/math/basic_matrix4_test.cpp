@@ -3,6 +3,7 @@
 
 #include "basic_matrix4_test.hpp"
 
+#include <cmath>
 #include <cstdint>
 #include <vector>
 
@@ -2403,3 +2404,129 @@ public void MatrixCreateConstrainedBillboardAlongAxisTest5()
     Assert.True(MathHelper.Equal(expected, actual), "Matrix.CreateConstrainedBillboard did not return the expected value.");
 }
 */
+
+namespace
+{
+    constexpr euler_order euler_orders[] = { euler_order::xyz, euler_order::xzy, euler_order::yxz, euler_order::yzx
+                                           , euler_order::zxy, euler_order::zyx, euler_order::xyx, euler_order::xzx
+                                           , euler_order::yxy, euler_order::yzy, euler_order::zxz, euler_order::zyz };
+
+    constexpr const char* euler_names[] = { "xyz", "xzy", "yxz", "yzx", "zxy", "zyx"
+                                          , "xyx", "xzx", "yxy", "yzy", "zxz", "zyz" };
+
+    bool is_proper_euler(euler_order order)
+    {
+        return static_cast<std::uint32_t>(order) >= static_cast<std::uint32_t>(euler_order::xyx);
+    }
+
+    matrix4 rotation_about(char axis, float angle)
+    {
+        switch (axis)
+        {
+        case 'x': return matrix::create_rotation_x(radians { angle });
+        case 'y': return matrix::create_rotation_y(radians { angle });
+        default:  return matrix::create_rotation_z(radians { angle });
+        }
+    }
+
+    // The three single axis rotations, applied in the order of the sequence
+    matrix4 euler_reference(euler_order order, const vector3& angles)
+    {
+        auto name = euler_names[static_cast<std::uint32_t>(order)];
+
+        return rotation_about(name[0], angles.x)
+             * rotation_about(name[1], angles.y)
+             * rotation_about(name[2], angles.z);
+    }
+}
+
+TEST_F(basic_matrix4_test, create_from_euler)
+{
+    for (auto order : euler_orders)
+    {
+        for (float a = -3.0f; a <= 3.0f; a += 0.75f)
+        {
+            for (float b = -3.0f; b <= 3.0f; b += 0.75f)
+            {
+                auto angles = vector3 { a, b, 0.5f - a * 0.5f };
+
+                EXPECT_TRUE(equality_helper::equal(euler_reference(order, angles)
+                                                 , matrix::create_from_euler(angles, order)))
+                    << euler_names[static_cast<std::uint32_t>(order)];
+            }
+        }
+    }
+
+    radians yaw   = degrees(30.0f);
+    radians pitch = degrees(40.0f);
+    radians roll  = degrees(50.0f);
+
+    EXPECT_TRUE(equality_helper::equal(matrix::create_from_yaw_pitch_roll(yaw, pitch, roll)
+                                     , matrix::create_from_euler({ roll.value, pitch.value, yaw.value }
+                                                               , euler_order::zxy)));
+}
+
+TEST_F(basic_matrix4_test, to_euler)
+{
+    for (auto order : euler_orders)
+    {
+        // Middle angles away from gimbal lock: inside (-pi/2, pi/2) or (0, pi)
+        auto offset = is_proper_euler(order) ? 1.6f : 0.0f;
+
+        for (float a = -3.0f; a <= 3.0f; a += 0.5f)
+        {
+            for (float b = -1.4f; b <= 1.4f; b += 0.35f)
+            {
+                auto angles = vector3 { a, b + offset, -a * 0.75f };
+                auto actual = matrix::to_euler(matrix::create_from_euler(angles, order), order);
+
+                EXPECT_TRUE(equality_helper::equal(angles, actual)) << euler_names[static_cast<std::uint32_t>(order)];
+            }
+        }
+    }
+}
+
+TEST_F(basic_matrix4_test, to_euler_gimbal_lock)
+{
+    for (auto order : euler_orders)
+    {
+        auto middles = is_proper_euler(order) ? std::vector<float> { 0.0f, pi<> }
+                                              : std::vector<float> { pi_over_2<>, -pi_over_2<> };
+
+        for (auto middle : middles)
+        {
+            auto matrix = matrix::create_from_euler({ 0.7f, middle, -0.4f }, order);
+            auto actual = matrix::to_euler(matrix, order);
+
+            EXPECT_EQ(0.0f, actual.z);
+            EXPECT_TRUE(equality_helper::equal(matrix, matrix::create_from_euler(actual, order)))
+                << euler_names[static_cast<std::uint32_t>(order)];
+        }
+    }
+}
+
+TEST_F(basic_matrix4_test, euler_batch)
+{
+    auto angles   = std::vector<vector3>(37);
+    auto matrices = std::vector<matrix4>(angles.size());
+    auto actual   = std::vector<vector3>(angles.size());
+
+    for (std::size_t i = 0; i < angles.size(); ++i)
+    {
+        auto t = static_cast<float>(i);
+
+        angles[i] = { std::sin(t) * 3.0f, std::cos(t * 0.7f) * 1.4f, std::sin(t * 1.3f) * 3.0f };
+    }
+
+    for (auto order : euler_orders)
+    {
+        matrix::create_from_euler(angles, order, matrices);
+        matrix::to_euler(matrices, order, actual);
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(matrix::create_from_euler(angles[i], order), matrices[i]));
+            EXPECT_TRUE(equality_helper::equal(matrix::to_euler(matrices[i], order), actual[i]));
+        }
+    }
+}
@@ -281,3 +281,24 @@ TEST_F(basic_plane_test, equals_nan)
     EXPECT_TRUE(c != z);
     EXPECT_TRUE(d != z);
 }
+
+TEST_F(basic_plane_test, intersects_bounding_box)
+{
+    plane_t      p       { 0.0f, 1.0f, 0.0f, -2.0f }; // y = 2
+    bounding_box above   { { -1.0f, 3.0f, -1.0f }, { 1.0f, 4.0f, 1.0f } };
+    bounding_box below   { { -1.0f, 0.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    bounding_box crosses { { -1.0f, 1.0f, -1.0f }, { 1.0f, 3.0f, 1.0f } };
+
+    EXPECT_EQ(plane_intersection_type::front       , plane::intersects(p, above));
+    EXPECT_EQ(plane_intersection_type::back        , plane::intersects(p, below));
+    EXPECT_EQ(plane_intersection_type::intersecting, plane::intersects(p, crosses));
+}
+
+TEST_F(basic_plane_test, intersects_bounding_sphere)
+{
+    plane_t p { 0.0f, 1.0f, 0.0f, -2.0f }; // y = 2
+
+    EXPECT_EQ(plane_intersection_type::front       , plane::intersects(p, bounding_sphere { { 0.0f, 4.0f, 0.0f }, 1.0f }));
+    EXPECT_EQ(plane_intersection_type::back        , plane::intersects(p, bounding_sphere { { 0.0f, 0.0f, 0.0f }, 1.0f }));
+    EXPECT_EQ(plane_intersection_type::intersecting, plane::intersects(p, bounding_sphere { { 0.0f, 2.5f, 0.0f }, 1.0f }));
+}
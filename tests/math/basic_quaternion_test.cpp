@@ -3,6 +3,11 @@
 
 #include "basic_quaternion_test.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 #include "equality_helper.hpp"
 
 using namespace scener::math;
@@ -816,3 +821,348 @@ TEST_F(basic_quaternion_test, size_of)
     EXPECT_EQ(16u, sizeof(basic_quaternion<float>));
     EXPECT_EQ(32u, sizeof(basic_quaternion<double>));
 }
+
+namespace
+{
+    constexpr euler_order euler_orders[] = { euler_order::xyz, euler_order::xzy, euler_order::yxz, euler_order::yzx
+                                           , euler_order::zxy, euler_order::zyx, euler_order::xyx, euler_order::xzx
+                                           , euler_order::yxy, euler_order::yzy, euler_order::zxz, euler_order::zyz };
+
+    constexpr const char* euler_names[] = { "xyz", "xzy", "yxz", "yzx", "zxy", "zyx"
+                                          , "xyx", "xzx", "yxy", "yzy", "zxz", "zyz" };
+
+    quaternion rotation_about(char axis, float angle)
+    {
+        auto unit = (axis == 'x') ? vector3::unit_x() : (axis == 'y') ? vector3::unit_y() : vector3::unit_z();
+
+        return quat::create_from_axis_angle(unit, radians { angle });
+    }
+
+    // The three single axis rotations, the first one applied is the rightmost factor
+    quaternion euler_reference(euler_order order, const vector3& angles)
+    {
+        auto name = euler_names[static_cast<std::uint32_t>(order)];
+
+        return rotation_about(name[2], angles.z)
+             * rotation_about(name[1], angles.y)
+             * rotation_about(name[0], angles.x);
+    }
+}
+
+TEST_F(basic_quaternion_test, create_from_euler)
+{
+    for (auto order : euler_orders)
+    {
+        for (float a = -3.0f; a <= 3.0f; a += 0.75f)
+        {
+            for (float b = -3.0f; b <= 3.0f; b += 0.75f)
+            {
+                auto angles = vector3 { a, b, 0.5f - a * 0.5f };
+                auto actual = quat::create_from_euler(angles, order);
+
+                EXPECT_TRUE(equality_helper::equal(euler_reference(order, angles), actual))
+                    << euler_names[static_cast<std::uint32_t>(order)];
+                EXPECT_TRUE(equality_helper::equal(matrix::create_from_euler(angles, order)
+                                                 , matrix::create_from_quaternion(actual)));
+            }
+        }
+    }
+
+    radians yaw   = degrees(30.0f);
+    radians pitch = degrees(40.0f);
+    radians roll  = degrees(50.0f);
+
+    EXPECT_TRUE(equality_helper::equal(quat::create_from_yaw_pitch_roll(yaw, pitch, roll)
+                                     , quat::create_from_euler({ roll.value, pitch.value, yaw.value }
+                                                             , euler_order::zxy)));
+}
+
+TEST_F(basic_quaternion_test, to_euler)
+{
+    for (auto order : euler_orders)
+    {
+        for (float a = -3.0f; a <= 3.0f; a += 0.5f)
+        {
+            // Includes the gimbal lock of both kinds of sequences, pi/2 and 0
+            for (float b = -1.75f; b <= 1.75f; b += 0.25f)
+            {
+                auto expected = quat::create_from_euler({ a, b, -a * 0.75f }, order);
+                auto actual   = quat::create_from_euler(quat::to_euler(expected, order), order);
+
+                EXPECT_TRUE(equality_helper::equal_rotation(expected, actual))
+                    << euler_names[static_cast<std::uint32_t>(order)];
+            }
+        }
+
+        // Non unit quaternions give the angles of their rotation
+        auto q = quat::create_from_euler({ 0.3f, 0.2f, 0.1f }, order);
+
+        EXPECT_TRUE(equality_helper::equal(quat::to_euler(q, order), quat::to_euler(q * 3.0f, order)));
+    }
+}
+
+TEST_F(basic_quaternion_test, euler_batch)
+{
+    auto angles      = std::vector<vector3>(37);
+    auto quaternions = std::vector<quaternion>(angles.size());
+    auto actual      = std::vector<vector3>(angles.size());
+
+    for (std::size_t i = 0; i < angles.size(); ++i)
+    {
+        auto t = static_cast<float>(i);
+
+        angles[i] = { std::sin(t) * 3.0f, std::cos(t * 0.7f) * 1.4f, std::sin(t * 1.3f) * 3.0f };
+    }
+
+    for (auto order : euler_orders)
+    {
+        quat::create_from_euler(angles, order, quaternions);
+        quat::to_euler(quaternions, order, actual);
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(quat::create_from_euler(angles[i], order), quaternions[i]));
+            EXPECT_TRUE(equality_helper::equal(quat::to_euler(quaternions[i], order), actual[i]));
+        }
+    }
+}
+
+TEST_F(basic_quaternion_test, create_from_to)
+{
+    auto from = vector3 { 1.0f, 2.0f, -0.5f };
+
+    for (auto to : { vector3 { -3.0f, 0.5f, 2.0f }, vector3 { 0.0f, 0.0f, 1.0f }, vector3 { 2.0f, 4.0f, -1.0f } })
+    {
+        auto q = quat::create_from_to(from, to);
+
+        EXPECT_TRUE(equality_helper::equal(1.0f, quat::length(q)));
+        EXPECT_TRUE(equality_helper::equal(vector::normalize(to), vector::normalize(vector::transform(from, q))));
+    }
+
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), quat::create_from_to(from, from * 2.0f)));
+
+    // Opposite directions take half a turn about an orthogonal axis
+    for (auto v : { from, vector3::unit_x(), vector3::unit_y(), vector3::unit_z() })
+    {
+        auto q = quat::create_from_to(v, -v);
+
+        EXPECT_TRUE(equality_helper::equal(0.0f, q.w));
+        EXPECT_TRUE(equality_helper::equal(vector::normalize(-v), vector::normalize(vector::transform(v, q))));
+    }
+}
+
+TEST_F(basic_quaternion_test, swing_twist)
+{
+    auto axis = vector::normalize(vector3 { 1.0f, 1.0f, 0.0f });
+
+    for (float a = -3.0f; a <= 3.0f; a += 0.5f)
+    {
+        auto rotation      = quat::create_from_euler({ a, 0.7f - a * 0.3f, a * 0.5f }, euler_order::xyz);
+        auto [swing, twist] = quat::swing_twist(rotation, axis);
+
+        EXPECT_TRUE(equality_helper::equal(rotation, swing * twist));
+        EXPECT_TRUE(equality_helper::equal(vector::normalize(vector::transform(axis, rotation))
+                                         , vector::normalize(vector::transform(axis, swing))));
+        EXPECT_TRUE(equality_helper::equal(0.0f, vector::length(vector::cross({ twist.x, twist.y, twist.z }, axis))));
+        EXPECT_TRUE(equality_helper::equal(0.0f, vector::dot({ swing.x, swing.y, swing.z }, axis)));
+    }
+
+    // Half a turn of the axis leaves the twist undefined
+    auto [swing, twist] = quat::swing_twist(quat::create_from_axis_angle(vector3::unit_z(), radians { pi<> })
+                                          , vector3::unit_x());
+
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), twist));
+    EXPECT_TRUE(equality_helper::equal_rotation(quat::create_from_axis_angle(vector3::unit_z(), radians { pi<> })
+                                              , swing));
+}
+
+TEST_F(basic_quaternion_test, joint_limits)
+{
+    auto axis  = vector3::unit_y();
+    auto swing = quat::create_from_axis_angle(vector3::unit_x(), radians { 1.2f });
+    auto twist = quat::create_from_axis_angle(axis, radians { -1.5f });
+    auto lower = radians { -0.5f };
+    auto upper = radians { 0.25f };
+
+    EXPECT_TRUE(equality_helper::equal(swing * quat::create_from_axis_angle(axis, lower)
+                                     , quat::clamp_twist(swing * twist, axis, lower, upper)));
+    EXPECT_TRUE(equality_helper::equal(quat::create_from_axis_angle(axis, lower)
+                                     , quat::clamp_hinge(swing * twist, axis, lower, upper)));
+    EXPECT_TRUE(equality_helper::equal(quat::create_from_axis_angle(vector3::unit_x(), radians { 0.5f }) * twist
+                                     , quat::clamp_cone(swing * twist, axis, radians { 0.5f })));
+
+    // Rotations inside the limits are kept
+    auto inside = quat::create_from_axis_angle(vector3::unit_z(), radians { 0.3f })
+                * quat::create_from_axis_angle(axis, radians { 0.1f });
+
+    EXPECT_TRUE(equality_helper::equal(inside, quat::clamp_twist(inside, axis, lower, upper)));
+    EXPECT_TRUE(equality_helper::equal(inside, quat::clamp_cone(inside, axis, radians { 0.5f })));
+
+    // Twists past half a turn are measured the short way round
+    auto turned = quat::create_from_axis_angle(axis, radians { 4.0f });
+
+    EXPECT_TRUE(equality_helper::equal_rotation(quat::create_from_axis_angle(axis, lower)
+                                              , quat::clamp_hinge(turned, axis, lower, upper)));
+}
+
+TEST_F(basic_quaternion_test, joint_limits_batch)
+{
+    auto axis      = vector::normalize(vector3 { 0.0f, 1.0f, 1.0f });
+    auto from      = std::vector<vector3>(37);
+    auto to        = std::vector<vector3>(from.size());
+    auto rotations = std::vector<quaternion>(from.size());
+    auto swing     = std::vector<quaternion>(from.size());
+    auto twist     = std::vector<quaternion>(from.size());
+    auto result    = std::vector<quaternion>(from.size());
+    auto lower     = radians { -0.4f };
+    auto upper     = radians { 0.6f };
+    auto cone      = radians { 0.8f };
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        auto t = static_cast<float>(i);
+
+        from[i]      = { std::sin(t), std::cos(t * 0.7f), std::sin(t * 1.3f) };
+        to[i]        = (i % 5 == 0) ? -from[i] * 2.0f : vector3 { std::cos(t), std::sin(t * 0.3f), 0.5f };
+        rotations[i] = quat::create_from_euler({ std::sin(t) * 3.0f, std::cos(t) * 1.5f, t * 0.2f }, euler_order::yxz);
+    }
+
+    quat::create_from_to(from, to, result);
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(quat::create_from_to(from[i], to[i]), result[i]));
+    }
+
+    quat::swing_twist(rotations, axis, swing, twist);
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        auto expected = quat::swing_twist(rotations[i], axis);
+
+        EXPECT_TRUE(equality_helper::equal(expected.first, swing[i]));
+        EXPECT_TRUE(equality_helper::equal(expected.second, twist[i]));
+    }
+
+    quat::clamp_twist(rotations, axis, lower, upper, result);
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(quat::clamp_twist(rotations[i], axis, lower, upper), result[i]));
+    }
+
+    quat::clamp_hinge(rotations, axis, lower, upper, result);
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(quat::clamp_hinge(rotations[i], axis, lower, upper), result[i]));
+    }
+
+    quat::clamp_cone(rotations, axis, cone, result);
+
+    for (std::size_t i = 0; i < from.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(quat::clamp_cone(rotations[i], axis, cone), result[i]));
+    }
+}
+
+TEST_F(basic_quaternion_test, exp_log_pow)
+{
+    auto axis      = vector::normalize(vector3 { 1.0f, 2.0f, 3.0f });
+    auto rotation  = quat::create_from_axis_angle(axis, radians { 1.2f });
+    auto logarithm = quat::log(rotation);
+
+    // The logarithm of a unit quaternion is the pure quaternion of half the angle about the axis
+    EXPECT_NEAR(0.0f, logarithm.w, 1e-6f);
+    EXPECT_NEAR(axis.x * 0.6f, logarithm.x, 1e-6f);
+    EXPECT_NEAR(axis.y * 0.6f, logarithm.y, 1e-6f);
+    EXPECT_NEAR(axis.z * 0.6f, logarithm.z, 1e-6f);
+
+    EXPECT_TRUE(equality_helper::equal(rotation, quat::exp(logarithm)));
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), quat::exp(quaternion { 0.0f, 0.0f, 0.0f, 0.0f })));
+    EXPECT_TRUE(equality_helper::equal(quaternion { 0.0f, 0.0f, 0.0f, 0.0f }, quat::log(quaternion::identity())));
+
+    auto half = quat::pow(rotation, 0.5f);
+
+    EXPECT_TRUE(equality_helper::equal(quat::create_from_axis_angle(axis, radians { 0.6f }), half));
+    EXPECT_TRUE(equality_helper::equal(rotation, half * half));
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), quat::pow(rotation, 0.0f)));
+}
+
+TEST_F(basic_quaternion_test, squad_and_bezier)
+{
+    std::vector<quaternion> keys = {
+        quat::create_from_yaw_pitch_roll(radians { 0.1f }, radians { 0.2f }, radians { 0.3f })
+      , quat::create_from_yaw_pitch_roll(radians { 0.9f }, radians { -0.4f }, radians { 0.1f })
+      , -quat::create_from_yaw_pitch_roll(radians { 1.7f }, radians { 0.3f }, radians { -0.6f })
+      , quat::create_from_yaw_pitch_roll(radians { 2.1f }, radians { 1.0f }, radians { 0.2f })
+    };
+
+    std::vector<quaternion> control(keys.size());
+    std::vector<quaternion> incoming(keys.size());
+    std::vector<quaternion> outgoing(keys.size());
+
+    quat::squad_control_points(keys, control);
+    quat::bezier_control_points(keys, incoming, outgoing);
+
+    auto at_key = [](const quaternion& expected, const quaternion& actual)
+    {
+        return equality_helper::equal(expected, actual) || equality_helper::equal(-expected, actual);
+    };
+
+    for (std::size_t i = 0; i + 1 < keys.size(); ++i)
+    {
+        auto s0 = quat::squad(keys[i], keys[i + 1], control[i], control[i + 1], 0.0f);
+        auto s1 = quat::squad(keys[i], keys[i + 1], control[i], control[i + 1], 1.0f);
+        auto b0 = quat::bezier(keys[i], outgoing[i], incoming[i + 1], keys[i + 1], 0.0f);
+        auto b1 = quat::bezier(keys[i], outgoing[i], incoming[i + 1], keys[i + 1], 1.0f);
+
+        EXPECT_TRUE(at_key(keys[i], s0));
+        EXPECT_TRUE(at_key(keys[i + 1], s1));
+        EXPECT_TRUE(at_key(keys[i], b0));
+        EXPECT_TRUE(at_key(keys[i + 1], b1));
+    }
+
+    // Both splines stay smooth across the inner keys: the rotations just before and after a key are close
+    for (std::size_t i = 1; i + 1 < keys.size(); ++i)
+    {
+        auto before = quat::squad(keys[i - 1], keys[i], control[i - 1], control[i], 0.999f);
+        auto after  = quat::squad(keys[i], keys[i + 1], control[i], control[i + 1], 0.001f);
+
+        EXPECT_LT(1.0f - std::abs(quat::dot(before, after)), 1e-4f);
+
+        before = quat::bezier(keys[i - 1], outgoing[i - 1], incoming[i], keys[i], 0.999f);
+        after  = quat::bezier(keys[i], outgoing[i], incoming[i + 1], keys[i + 1], 0.001f);
+
+        EXPECT_LT(1.0f - std::abs(quat::dot(before, after)), 1e-4f);
+    }
+
+    std::vector<float>      key_times = { 0.0f, 1.0f, 1.5f, 3.0f };
+    std::vector<float>      times     = { -1.0f, 0.0f, 0.25f, 0.75f, 1.2f, 1.5f, 2.0f, 0.5f, 2.9f, 3.0f, 4.0f };
+    std::vector<quaternion> squad(times.size());
+    std::vector<quaternion> bezier(times.size());
+
+    quat::squad(keys, control, key_times, times, squad);
+    quat::bezier(keys, incoming, outgoing, key_times, times, bezier);
+
+    for (std::size_t i = 0; i < times.size(); ++i)
+    {
+        auto time    = std::clamp(times[i], key_times.front(), key_times.back());
+        auto segment = std::size_t(0);
+
+        while (segment + 2 < key_times.size() && time >= key_times[segment + 1])
+        {
+            ++segment;
+        }
+
+        auto amount = (time - key_times[segment]) / (key_times[segment + 1] - key_times[segment]);
+
+        auto expected_squad  = quat::squad(keys[segment], keys[segment + 1]
+                                         , control[segment], control[segment + 1], amount);
+        auto expected_bezier = quat::bezier(keys[segment], outgoing[segment]
+                                          , incoming[segment + 1], keys[segment + 1], amount);
+
+        EXPECT_TRUE(equality_helper::equal(expected_squad, squad[i])) << "time " << times[i];
+        EXPECT_TRUE(equality_helper::equal(expected_bezier, bezier[i])) << "time " << times[i];
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_ray_test.hpp"
+
+#include "equality_helper.hpp"
+
+using namespace scener::math;
+
+TEST_F(basic_ray_test, intersects_bounding_box)
+{
+    bounding_box box { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+
+    ray front  { { 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, -1.0f } };
+    ray away   { { 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f,  1.0f } };
+    ray miss   { { 3.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, -1.0f } };
+    ray inside { { 0.5f, 0.0f, 0.0f }, { 1.0f, 0.0f,  0.0f } };
+
+    EXPECT_TRUE(intersects(front, box));
+    EXPECT_FALSE(intersects(away, box));
+    EXPECT_FALSE(intersects(miss, box));
+    EXPECT_TRUE(intersects(inside, box));
+
+    EXPECT_TRUE(equality_helper::equal(4.0f, intersection_distance(front, box).value()));
+    EXPECT_TRUE(equality_helper::equal(0.0f, intersection_distance(inside, box).value()));
+    EXPECT_FALSE(intersection_distance(away, box).has_value());
+    EXPECT_FALSE(intersection_distance(miss, box).has_value());
+}
+
+TEST_F(basic_ray_test, intersects_bounding_sphere)
+{
+    bounding_sphere sphere { { 0.0f, 0.0f, 0.0f }, 2.0f };
+
+    ray front  { { 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, -1.0f } };
+    ray away   { { 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f,  1.0f } };
+    ray miss   { { 3.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, -1.0f } };
+    ray inside { { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f,  0.0f } };
+
+    EXPECT_TRUE(intersects(front, sphere));
+    EXPECT_FALSE(intersects(away, sphere));
+    EXPECT_FALSE(intersects(miss, sphere));
+    EXPECT_TRUE(intersects(inside, sphere));
+
+    EXPECT_TRUE(equality_helper::equal(3.0f, intersection_distance(front, sphere).value()));
+    EXPECT_TRUE(equality_helper::equal(0.0f, intersection_distance(inside, sphere).value()));
+    EXPECT_FALSE(intersection_distance(away, sphere).has_value());
+    EXPECT_FALSE(intersection_distance(miss, sphere).has_value());
+}
+
+TEST_F(basic_ray_test, intersects_plane)
+{
+    plane_t p { vector3::unit_y(), -2.0f };
+
+    ray down     { { 0.0f, 5.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } };
+    ray up       { { 0.0f, 5.0f, 0.0f }, { 0.0f,  1.0f, 0.0f } };
+    ray parallel { { 0.0f, 5.0f, 0.0f }, { 1.0f,  0.0f, 0.0f } };
+
+    EXPECT_TRUE(intersects(down, p));
+    EXPECT_FALSE(intersects(up, p));
+    EXPECT_FALSE(intersects(parallel, p));
+
+    EXPECT_TRUE(equality_helper::equal(3.0f, intersection_distance(down, p).value()));
+    EXPECT_FALSE(intersection_distance(up, p).has_value());
+    EXPECT_FALSE(intersection_distance(parallel, p).has_value());
+}
+
+TEST_F(basic_ray_test, intersects_bounding_frustrum)
+{
+    auto view       = matrix::create_look_at(vector3::zero(), vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.0f, 1.0f, 100.0f);
+
+    bounding_frustrum frustrum { view * projection };
+
+    ray front  { { 0.0f, 0.0f,   5.0f }, { 0.0f, 0.0f, -1.0f } };
+    ray away   { { 0.0f, 0.0f,   5.0f }, { 0.0f, 0.0f,  1.0f } };
+    ray beside { { 0.0f, 0.0f,  -2.0f }, { 1.0f, 0.0f,  0.0f } };
+    ray inside { { 0.0f, 0.0f, -10.0f }, { 0.0f, 1.0f,  0.0f } };
+
+    EXPECT_TRUE(intersects(front, frustrum));
+    EXPECT_FALSE(intersects(away, frustrum));
+    EXPECT_TRUE(intersects(beside, frustrum));
+    EXPECT_TRUE(intersects(inside, frustrum));
+
+    EXPECT_TRUE(equality_helper::equal(6.0f, intersection_distance(front, frustrum).value()));
+    EXPECT_TRUE(equality_helper::equal(0.0f, intersection_distance(inside, frustrum).value()));
+    EXPECT_FALSE(intersection_distance(away, frustrum).has_value());
+}
@@ -0,0 +1,152 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_shadow_cascades_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <scener/math/shadow_cascades.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    matrix4 camera_view()
+    {
+        return matrix::create_look_at(vector3 { 3.0f, 2.0f, 5.0f }, vector3 { 0.0f, 0.0f, -10.0f }, vector3::up());
+    }
+
+    matrix4 camera_projection(float near, float far)
+    {
+        return matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.6f, near, far);
+    }
+}
+
+TEST_F(basic_shadow_cascades_test, compute_splits)
+{
+    auto uniform     = cascade::compute_splits<4>(1.0f, 81.0f, 0.0f);
+    auto logarithmic = cascade::compute_splits<4>(1.0f, 81.0f, 1.0f);
+    auto practical   = cascade::compute_splits<4>(1.0f, 81.0f, 0.5f);
+
+    EXPECT_EQ(5u, uniform.size());
+
+    for (std::size_t i = 0; i < uniform.size(); ++i)
+    {
+        EXPECT_TRUE(equality_helper::equal(1.0f + 20.0f * float(i), uniform[i]));
+        EXPECT_TRUE(equality_helper::equal(std::pow(3.0f, float(i)), logarithmic[i]));
+        EXPECT_TRUE(equality_helper::equal((uniform[i] + logarithmic[i]) * 0.5f, practical[i]));
+    }
+}
+
+TEST_F(basic_shadow_cascades_test, create_split_frustrum)
+{
+    auto view = camera_view();
+
+    bounding_frustrum camera { view * camera_projection(1.0f, 100.0f) };
+    bounding_frustrum expected { view * camera_projection(10.0f, 40.0f) };
+
+    auto actual = cascade::create_split_frustrum(camera, 1.0f, 100.0f, 10.0f, 40.0f);
+
+    for (std::size_t i = 0; i < bounding_frustrum::plane_count; ++i)
+    {
+        const auto& lhs = expected.planes()[i];
+        const auto& rhs = actual.planes()[i];
+
+        EXPECT_TRUE(equality_helper::equal(lhs.normal, rhs.normal));
+        EXPECT_NEAR(lhs.d, rhs.d, 1e-4f);
+    }
+}
+
+TEST_F(basic_shadow_cascades_test, split_corners)
+{
+    auto view = camera_view();
+
+    bounding_frustrum camera { view * camera_projection(1.0f, 100.0f) };
+    bounding_frustrum split { view * camera_projection(10.0f, 40.0f) };
+
+    auto expected = get_corners(split);
+    auto actual   = cascade::split_corners(get_corners(camera), 1.0f, 100.0f, 10.0f, 40.0f);
+
+    for (std::size_t i = 0; i < bounding_frustrum::corner_count; ++i)
+    {
+        EXPECT_LT(vector::distance(expected[i], actual[i]), 1e-3f);
+    }
+}
+
+TEST_F(basic_shadow_cascades_test, create_light_projection)
+{
+    bounding_frustrum camera { camera_view() * camera_projection(1.0f, 50.0f) };
+
+    auto corners    = get_corners(camera);
+    auto light_view = matrix::create_look_at(vector3 { 0.0f, 0.0f, 0.0f }, vector3 { -1.0f, -2.0f, -0.5f }, vector3::up());
+    auto projection = cascade::create_light_projection(corners, light_view, 1024, 20.0f);
+    auto light      = light_view * projection;
+
+    // Every corner lands inside the shadow map and its depth range
+    for (const auto& corner : corners)
+    {
+        auto clip = corner * light;
+
+        EXPECT_GE(clip.x, -1.0f - 1e-5f);
+        EXPECT_LE(clip.x,  1.0f + 1e-5f);
+        EXPECT_GE(clip.y, -1.0f - 1e-5f);
+        EXPECT_LE(clip.y,  1.0f + 1e-5f);
+        EXPECT_GE(clip.z,  0.0f - 1e-5f);
+        EXPECT_LE(clip.z,  1.0f + 1e-5f);
+    }
+
+    // Moving the camera by a fraction of a texel moves the bounds by either zero or one whole texel
+    auto left_of  = [] (const matrix4& m) { return -(1.0f + m.m41) / m.m11; };
+    auto right_of = [] (const matrix4& m) { return  (1.0f - m.m41) / m.m11; };
+    auto texel    = (right_of(projection) - left_of(projection)) / 1024.0f;
+    auto offset   = vector::transform_normal(vector3 { texel * 0.25f, 0.0f, 0.0f }, matrix::invert(light_view));
+    auto moved    = corners;
+
+    for (auto& corner : moved)
+    {
+        corner += offset;
+    }
+
+    auto shift = left_of(cascade::create_light_projection(moved, light_view, 1024, 20.0f)) - left_of(projection);
+
+    EXPECT_TRUE(std::abs(shift) < texel * 0.01f || std::abs(shift - texel) < texel * 0.01f);
+}
+
+TEST_F(basic_shadow_cascades_test, create_light_projection_stable_texels)
+{
+    auto light_view = matrix::create_look_at(vector3 { 0.0f, 0.0f, 0.0f }, vector3 { -1.0f, -2.0f, -0.5f }, vector3::up());
+    auto projection = camera_projection(1.0f, 50.0f);
+    auto position   = vector3 { 3.0f, 2.0f, 5.0f };
+    auto target     = vector3 { 0.0f, 0.0f, -10.0f };
+
+    auto light_projection = [&] (const vector3& eye, const vector3& at)
+    {
+        bounding_frustrum camera { matrix::create_look_at(eye, at, vector3::up()) * projection };
+
+        return cascade::create_light_projection(get_corners(camera), light_view, 1024, 20.0f);
+    };
+
+    auto left_of   = [] (const matrix4& m) { return -(1.0f + m.m41) / m.m11; };
+    auto bottom_of = [] (const matrix4& m) { return -(1.0f + m.m42) / m.m22; };
+    auto texel_of  = [] (const matrix4& m) { return 2.0f / (m.m11 * 1024.0f); };
+
+    auto reference = light_projection(position, target);
+    auto texel     = texel_of(reference);
+
+    // A move by a fraction of a texel, and turns of the camera in place and while moving
+    auto offset = vector::transform_normal(vector3 { texel * 0.3f, texel * 0.6f, 0.0f }, matrix::invert(light_view));
+    auto turned = vector::transform(target - position, matrix::create_rotation_y(radians { 0.7f })) + position;
+
+    for (const auto& moved : { light_projection(position + offset, target + offset)
+                             , light_projection(position, turned)
+                             , light_projection(position + offset, turned + offset) })
+    {
+        // The texels keep their size, and their grid stays on the same multiples of the texel size
+        EXPECT_NEAR(texel, texel_of(moved), texel * 1e-5f);
+
+        for (auto origin : { left_of(moved), bottom_of(moved) })
+        {
+            EXPECT_NEAR(0.0f, origin / texel - std::round(origin / texel), 1e-2f);
+        }
+    }
+}
@@ -0,0 +1,227 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_spatial_hash_grid_test.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <scener/math/spatial_hash_grid.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    std::vector<bounding_box> generate_boxes(std::size_t count, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> position { -50.0f, 50.0f };
+        std::uniform_real_distribution<float> extent { 0.1f, 6.0f };
+        std::vector<bounding_box>             boxes;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            vector3 min { position(engine), position(engine), position(engine) };
+            vector3 max { min.x + extent(engine), min.y + extent(engine), min.z + extent(engine) };
+
+            boxes.push_back({ min, max });
+        }
+
+        return boxes;
+    }
+
+    std::set<std::pair<std::uint32_t, std::uint32_t>> brute_force_pairs(const std::vector<bounding_box>& boxes)
+    {
+        std::set<std::pair<std::uint32_t, std::uint32_t>> pairs;
+
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            for (std::uint32_t j = i + 1; j < boxes.size(); ++j)
+            {
+                if (intersects(boxes[i], boxes[j]))
+                {
+                    pairs.insert({ i, j });
+                }
+            }
+        }
+
+        return pairs;
+    }
+}
+
+TEST_F(basic_spatial_hash_grid_test, insert_update_remove)
+{
+    spatial_hash_grid grid { 2.0f, 64 };
+
+    auto a = grid.insert({ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } });
+    auto b = grid.insert({ { 0.5f, 0.5f, 0.5f }, { 3.0f, 3.0f, 3.0f } });
+
+    EXPECT_EQ(2u, grid.size());
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+
+    grid.for_each_pair([&] (auto lhs, auto rhs) { pairs.push_back({ lhs, rhs }); });
+
+    ASSERT_EQ(1u, pairs.size());
+    EXPECT_EQ(a, pairs[0].first);
+    EXPECT_EQ(b, pairs[0].second);
+
+    grid.update(b, { { 10.0f, 10.0f, 10.0f }, { 11.0f, 11.0f, 11.0f } });
+    pairs.clear();
+    grid.for_each_pair([&] (auto lhs, auto rhs) { pairs.push_back({ lhs, rhs }); });
+
+    EXPECT_TRUE(pairs.empty());
+    EXPECT_EQ(10.0f, grid.bounds(b).min.x);
+
+    grid.remove(a);
+
+    EXPECT_EQ(1u, grid.size());
+
+    auto c = grid.insert({ { 10.5f, 10.5f, 10.5f }, { 12.0f, 12.0f, 12.0f } });
+
+    EXPECT_EQ(a, c); // handles are recycled
+
+    pairs.clear();
+    grid.for_each_pair([&] (auto lhs, auto rhs) { pairs.push_back({ lhs, rhs }); });
+
+    ASSERT_EQ(1u, pairs.size());
+    EXPECT_EQ(c, pairs[0].first);
+    EXPECT_EQ(b, pairs[0].second);
+}
+
+TEST_F(basic_spatial_hash_grid_test, for_each_pair_matches_brute_force)
+{
+    auto              boxes = generate_boxes(500, 7);
+    spatial_hash_grid grid { 4.0f, 256 };
+
+    for (const auto& box : boxes)
+    {
+        grid.insert(box);
+    }
+
+    // move half of the objects
+    auto moved = generate_boxes(250, 11);
+
+    for (std::uint32_t i = 0; i < moved.size(); ++i)
+    {
+        boxes[i * 2] = moved[i];
+        grid.update(i * 2, moved[i]);
+    }
+
+    auto expected = brute_force_pairs(boxes);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> actual;
+
+    grid.for_each_pair([&] (auto lhs, auto rhs) { actual.push_back({ lhs, rhs }); });
+
+    std::sort(actual.begin(), actual.end());
+
+    EXPECT_TRUE(std::adjacent_find(actual.begin(), actual.end()) == actual.end());
+    EXPECT_EQ(expected.size(), actual.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+}
+
+TEST_F(basic_spatial_hash_grid_test, query_sphere_matches_brute_force)
+{
+    auto              boxes = generate_boxes(500, 3);
+    spatial_hash_grid grid { 4.0f, 256 };
+
+    for (const auto& box : boxes)
+    {
+        grid.insert(box);
+    }
+
+    bounding_sphere            sphere { { 5.0f, -3.0f, 2.0f }, 15.0f };
+    std::vector<std::uint32_t> expected;
+    std::vector<std::uint32_t> actual;
+
+    for (std::uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        if (intersects(boxes[i], sphere))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    grid.query(sphere, [&] (auto handle) { actual.push_back(handle); });
+
+    std::sort(actual.begin(), actual.end());
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(basic_spatial_hash_grid_test, huge_boxes_match_brute_force)
+{
+    constexpr auto largest = std::numeric_limits<float>::max();
+
+    auto              boxes = generate_boxes(300, 5);
+    spatial_hash_grid grid { 4.0f, 256 };
+
+    boxes[10] = { vector3 { -largest }, vector3 { largest } };
+    boxes[20] = { { -1.0e6f, 0.0f, 0.0f }, { 1.0e6f, 2.0f, 2.0f } };
+    boxes[30] = { { 0.0f, -1.0e30f, -1.0e30f }, { largest, 1.0e30f, 1.0e30f } };
+    boxes[40] = { { -20.0f, -20.0f, -20.0f }, { 20.0f, 20.0f, 20.0f } };
+
+    for (const auto& box : boxes)
+    {
+        grid.insert(box);
+    }
+
+    auto check = [&] () -> void
+    {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> actual;
+
+        grid.for_each_pair([&] (auto lhs, auto rhs) { actual.push_back({ lhs, rhs }); });
+
+        std::sort(actual.begin(), actual.end());
+
+        auto expected = brute_force_pairs(boxes);
+
+        EXPECT_TRUE(std::adjacent_find(actual.begin(), actual.end()) == actual.end());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+
+        for (const auto& query : { bounding_box { { -5.0f, -5.0f, -5.0f }, { 5.0f, 5.0f, 5.0f } }
+                                 , bounding_box { { 1.0e5f, 1.0f, 1.0f }, { 1.0e7f, 1.0f, 1.0f } }
+                                 , bounding_box { vector3 { -largest }, vector3 { largest } } })
+        {
+            std::vector<std::uint32_t> found;
+            std::vector<std::uint32_t> intersecting;
+
+            grid.query(query, [&] (auto handle) { found.push_back(handle); });
+
+            for (std::uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                if (intersects(boxes[i], query))
+                {
+                    intersecting.push_back(i);
+                }
+            }
+
+            std::sort(found.begin(), found.end());
+
+            EXPECT_EQ(intersecting, found);
+        }
+    };
+
+    check();
+
+    // Shrinking and growing objects moves them between the cells and the oversized list
+    boxes[10] = { { 1.0f, 1.0f, 1.0f }, { 3.0f, 3.0f, 3.0f } };
+    boxes[50] = { { -1.0e20f, -1.0f, -1.0f }, { 1.0e20f, 1.0f, 1.0f } };
+
+    grid.update(10, boxes[10]);
+    grid.update(50, boxes[50]);
+
+    check();
+
+    grid.remove(20);
+
+    EXPECT_EQ(20u, grid.insert(boxes[20]));
+
+    check();
+}
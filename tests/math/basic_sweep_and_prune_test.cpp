@@ -0,0 +1,181 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "basic_sweep_and_prune_test.hpp"
+
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <scener/math/sweep_and_prune.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    using pair_set = std::set<std::pair<std::uint32_t, std::uint32_t>>;
+
+    pair_set brute_force_pairs(const std::vector<bounding_box>& boxes, const std::vector<bool>& alive)
+    {
+        pair_set pairs;
+
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            for (std::uint32_t j = i + 1; j < boxes.size(); ++j)
+            {
+                if (alive[i] && alive[j] && intersects(boxes[i], boxes[j]))
+                {
+                    pairs.insert({ i, j });
+                }
+            }
+        }
+
+        return pairs;
+    }
+
+    void apply_deltas(sweep_and_prune& sap, pair_set& pairs)
+    {
+        sap.update_pairs([&] (auto a, auto b) { EXPECT_TRUE(pairs.insert({ a, b }).second); }
+                       , [&] (auto a, auto b) { EXPECT_EQ(1u, pairs.erase({ a, b })); });
+    }
+}
+
+TEST_F(basic_sweep_and_prune_test, touching_boxes_overlap)
+{
+    sweep_and_prune sap;
+    pair_set        pairs;
+
+    sap.insert({ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } });
+    sap.insert({ { 1.0f, 0.0f, 0.0f }, { 2.0f, 1.0f, 1.0f } });
+    sap.insert({ { 3.0f, 0.0f, 0.0f }, { 4.0f, 1.0f, 1.0f } });
+
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ((pair_set { { 0u, 1u } }), pairs);
+
+    sap.update(2, { { 1.5f, 0.5f, 0.5f }, { 2.5f, 1.5f, 1.5f } });
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ((pair_set { { 0u, 1u }, { 1u, 2u } }), pairs);
+
+    sap.remove(1);
+    apply_deltas(sap, pairs);
+
+    EXPECT_TRUE(pairs.empty());
+    EXPECT_EQ(2u, sap.size());
+    EXPECT_EQ(1u, sap.insert({ { 0.5f, 0.5f, 0.5f }, { 0.6f, 0.6f, 0.6f } }));
+}
+
+TEST_F(basic_sweep_and_prune_test, remove_next_to_unbounded_boxes)
+{
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+    std::vector<bounding_box> boxes {
+        { { 0.0f, 0.0f, 0.0f }, { max_value<float>, max_value<float>, max_value<float> } }
+      , { { 0.0f, 0.0f, 0.0f }, { infinity, infinity, infinity } }
+      , { { 1.0f, 1.0f, 1.0f }, { 2.0f, 2.0f, 2.0f } }
+      , { { 3.0f, 3.0f, 3.0f }, { 4.0f, 4.0f, 4.0f } }
+    };
+    std::vector<bool> alive(boxes.size(), true);
+    sweep_and_prune   sap;
+    pair_set          pairs;
+
+    for (const auto& box : boxes)
+    {
+        sap.insert(box);
+    }
+
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+
+    sap.remove(2);
+    alive[2] = false;
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+
+    // The recycled handle must not inherit the pairs of the removed object
+    boxes[2] = { { -2.0f, -2.0f, -2.0f }, { -1.0f, -1.0f, -1.0f } };
+    alive[2] = true;
+
+    EXPECT_EQ(2u, sap.insert(boxes[2]));
+
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+
+    sap.update(3, { { 1.5f, -3.0f, -3.0f }, { 5.0f, 5.0f, 5.0f } });
+    boxes[3] = sap.bounds(3);
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+
+    pair_set current;
+
+    sap.for_each_pair([&] (auto a, auto b) { current.insert({ a, b }); });
+
+    EXPECT_EQ(pairs, current);
+}
+
+TEST_F(basic_sweep_and_prune_test, deltas_track_brute_force)
+{
+    std::mt19937                          engine { 42 };
+    std::uniform_real_distribution<float> position { -40.0f, 40.0f };
+    std::uniform_real_distribution<float> extent { 0.5f, 5.0f };
+    std::uniform_real_distribution<float> step { -1.0f, 1.0f };
+    std::vector<bounding_box>             boxes;
+    std::vector<bool>                     alive;
+    sweep_and_prune                       sap;
+    pair_set                              pairs;
+
+    for (std::uint32_t i = 0; i < 400; ++i)
+    {
+        vector3 min { position(engine), position(engine), position(engine) };
+        vector3 max { min.x + extent(engine), min.y + extent(engine), min.z + extent(engine) };
+
+        boxes.push_back({ min, max });
+        alive.push_back(true);
+
+        EXPECT_EQ(i, sap.insert(boxes.back()));
+    }
+
+    apply_deltas(sap, pairs);
+
+    EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+
+    for (std::uint32_t frame = 0; frame < 20; ++frame)
+    {
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            if (!alive[i])
+            {
+                continue;
+            }
+
+            vector3 delta { step(engine), step(engine), step(engine) };
+
+            boxes[i] = { boxes[i].min + delta, boxes[i].max + delta };
+
+            sap.update(i, boxes[i]);
+        }
+
+        if (frame % 5 == 0)
+        {
+            sap.remove(frame);
+            alive[frame] = false;
+        }
+
+        apply_deltas(sap, pairs);
+
+        EXPECT_EQ(brute_force_pairs(boxes, alive), pairs);
+    }
+
+    pair_set current;
+
+    sap.for_each_pair([&] (auto a, auto b) { current.insert({ a, b }); });
+
+    EXPECT_EQ(pairs, current);
+}
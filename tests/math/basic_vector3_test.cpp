@@ -5,6 +5,9 @@
 
 #include "equality_helper.hpp"
 
+#include <algorithm>
+#include <vector>
+
 using namespace scener::math;
 
 TEST_F(basic_vector3_test, default_constructor)
@@ -1225,3 +1228,86 @@ TEST_F(basic_vector3_test, set_fields)
 
     EXPECT_NE(before, after);
 }
+
+TEST_F(basic_vector3_test, batch_dot_and_normalize)
+{
+    std::vector<vector3> lhs;
+    std::vector<vector3> rhs;
+
+    for (std::size_t i = 0; i < 37; ++i)
+    {
+        auto f = static_cast<float>(i);
+
+        lhs.push_back({ f * 0.5f - 3.0f, 1.0f + f * f * 0.01f, -f });
+        rhs.push_back({ 2.0f - f, f * 0.25f, 0.5f + f * 0.125f });
+    }
+
+    std::vector<float>   dots(lhs.size());
+    std::vector<vector3> normals(lhs.size());
+    std::vector<vector3> in_place(lhs);
+
+    vector::dot(lhs, rhs, dots);
+    vector::normalize(lhs, normals);
+    vector::normalize(in_place, in_place);
+
+    // The compiler may fuse the products and sums of the scalar operations but not the ones of the batches
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        EXPECT_NEAR(vector::dot(lhs[i], rhs[i]), dots[i], 1e-6f * vector::length(lhs[i]) * vector::length(rhs[i]));
+        EXPECT_TRUE(equality_helper::equal(vector::normalize(lhs[i]), normals[i]));
+        EXPECT_EQ(normals[i], in_place[i]);
+    }
+}
+
+TEST_F(basic_vector3_test, transform_by_quaternion_direct)
+{
+    auto v = vector3 { 1.0f, -2.0f, 3.0f };
+
+    // Also non unit quaternions, the result is the one of the rotation matrix built from them
+    for (auto q : { quat::create_from_axis_angle(vector::normalize(vector3 { 1.0f, 2.0f, 3.0f }), radians { 2.5f })
+                  , quaternion { 0.5f, -1.0f, 0.25f, 2.0f }
+                  , quaternion { 0.0f, 0.0f, 1.0f, 0.0f } })
+    {
+        EXPECT_TRUE(equality_helper::equal(v * matrix::create_from_quaternion(q), vector::transform(v, q)));
+    }
+}
+
+TEST_F(basic_vector3_test, batch_transform_by_quaternion)
+{
+    std::vector<vector3>    source;
+    std::vector<quaternion> rotations;
+
+    for (std::size_t i = 0; i < 37; ++i)
+    {
+        auto f = static_cast<float>(i);
+
+        source.push_back({ f * 0.5f - 3.0f, 1.0f + f * f * 0.01f, -f });
+        rotations.push_back(quat::create_from_yaw_pitch_roll(radians { f * 0.3f }, radians { -f }, radians { 0.1f }));
+    }
+
+    auto rotation = rotations[5];
+
+    std::vector<vector3> by_one(source.size());
+    std::vector<vector3> by_each(source.size());
+    std::vector<vector3> in_place(source);
+
+    vector::transform(source, rotation, by_one);
+    vector::transform(source, rotations, by_each);
+    vector::transform(in_place, rotations, in_place);
+
+    // The compiler may fuse the products and sums of the scalar operations but not the ones of the batches
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        auto length = vector::length(source[i]);
+
+        EXPECT_NEAR(0.0f, vector::distance(vector::transform(source[i], rotation), by_one[i]), 1e-6f * length);
+        EXPECT_NEAR(0.0f, vector::distance(vector::transform(source[i], rotations[i]), by_each[i]), 1e-6f * length);
+        EXPECT_EQ(by_each[i], in_place[i]);
+    }
+
+    std::vector<vector3> parallel(source.size());
+
+    vector::transform(serial_executor { }, source, rotations, parallel);
+
+    EXPECT_TRUE(std::equal(by_each.begin(), by_each.end(), parallel.begin()));
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "bfloat16_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <scener/math/bfloat16.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+TEST_F(bfloat16_test, round_trip)
+{
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+    {
+        auto value = bfloat16::from_bits(static_cast<std::uint16_t>(bits));
+
+        if (std::isnan(float(value)))
+        {
+            // Signaling NaNs are quieted
+            EXPECT_TRUE(std::isnan(float(bfloat16 { float(value) })));
+        }
+        else
+        {
+            EXPECT_EQ(bits, bfloat16 { float(value) }.bits());
+        }
+    }
+}
+
+TEST_F(bfloat16_test, rounding)
+{
+    EXPECT_EQ(0x3F80u, bfloat16 { 1.0f }.bits());
+    EXPECT_EQ(0xC000u, bfloat16 { -2.0f }.bits());
+
+    // Ties round to even
+    EXPECT_EQ(0x3F80u, bfloat16 { 1.0f + std::ldexp(1.0f, -8) }.bits());
+    EXPECT_EQ(0x3F82u, bfloat16 { 1.0f + 3.0f * std::ldexp(1.0f, -8) }.bits());
+
+    // Overflow and NaN
+    EXPECT_EQ(0x7F80u, bfloat16 { max_value<> }.bits());
+    EXPECT_TRUE(std::isnan(float(bfloat16 { NaN<> })));
+    EXPECT_TRUE(is_nan(NaN<bfloat16>));
+    EXPECT_EQ(std::ldexp(1.0f, -7), float(epsilon<bfloat16>));
+}
+
+TEST_F(bfloat16_test, vector_arithmetic)
+{
+    vector4bf a { 1.0f, 2.0f, 3.0f, 4.0f };
+    vector4bf b { 0.5f, -1.0f, 4.0f, 0.0f };
+
+    EXPECT_EQ(sizeof(bfloat16) * 4, sizeof(vector4bf));
+    EXPECT_EQ(vector4bf(1.5f, 1.0f, 7.0f, 4.0f), a + b);
+    EXPECT_EQ(10.5f, float(vector::dot(a, b)));
+}
+
+TEST_F(bfloat16_test, convert_span)
+{
+    std::mt19937                          engine { 7 };
+    std::uniform_real_distribution<float> distribution { -1.0f, 1.0f };
+    std::vector<float>                    source(1005);
+
+    for (auto& value : source)
+    {
+        value = distribution(engine) * std::pow(10.0f, float(int(engine() % 60)) - 30.0f);
+    }
+
+    source[0] = NaN<>;
+    source[1] = negative_infinity<>;
+    source[2] = max_value<>;
+    source[3] = -max_value<>;
+
+    std::vector<bfloat16> packed(source.size());
+    std::vector<float>    unpacked(source.size());
+
+    convert(source, packed);
+    convert(packed, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        if (std::isnan(source[i]))
+        {
+            EXPECT_TRUE(std::isnan(unpacked[i]));
+        }
+        else
+        {
+            EXPECT_EQ(bfloat16 { source[i] }.bits(), packed[i].bits());
+            EXPECT_EQ(float(packed[i]), unpacked[i]);
+        }
+    }
+}
+
+TEST_F(bfloat16_test, convert_vector_span)
+{
+    std::vector<vector3>   source   { { 1.0f, 2.0f, 3.0f }, { -0.25f, 0.125f, 1024.0f }, { 0.1f, 0.2f, 0.3f } };
+    std::vector<vector3bf> packed(source.size());
+    std::vector<vector3>   unpacked(source.size());
+
+    convert<3>(source, packed);
+    convert<3>(packed, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_TRUE(vector::distance(source[i], unpacked[i]) < 1.0e-2f * vector::length(source[i]));
+    }
+
+    // Empty vectors have no storage at all
+    std::vector<vector3>   empty;
+    std::vector<vector3bf> empty_packed;
+
+    convert<3>(empty, empty_packed);
+    convert<3>(empty_packed, empty);
+
+    EXPECT_TRUE(empty.empty());
+}
@@ -0,0 +1,135 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "color_space_test.hpp"
+
+#include <random>
+#include <vector>
+
+#include <scener/math/color_space.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    struct planes
+    {
+        planes(std::size_t count, float min, float max, std::uint32_t seed)
+            : r(count)
+            , g(count)
+            , b(count)
+        {
+            std::mt19937                          engine { seed };
+            std::uniform_real_distribution<float> distribution { min, max };
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                r[i] = distribution(engine);
+                g[i] = distribution(engine);
+                b[i] = distribution(engine);
+            }
+        }
+
+        color_planes view()
+        {
+            return { r, g, b };
+        }
+
+        color at(std::size_t i) const
+        {
+            return { r[i], g[i], b[i], 1.0f };
+        }
+
+        std::vector<float> r;
+        std::vector<float> g;
+        std::vector<float> b;
+    };
+
+    void expect_near(const color& expected, const color& actual, float tolerance)
+    {
+        EXPECT_NEAR(expected.r, actual.r, tolerance);
+        EXPECT_NEAR(expected.g, actual.g, tolerance);
+        EXPECT_NEAR(expected.b, actual.b, tolerance);
+        EXPECT_EQ(expected.a, actual.a);
+    }
+
+    template <typename Forward, typename Backward>
+    void check_round_trip(Forward forward, Backward backward, float tolerance)
+    {
+        planes source { 1001, 0.0f, 1.0f, 5 };
+        planes converted { source.r.size(), 0.0f, 1.0f, 0 };
+        planes restored { source.r.size(), 0.0f, 1.0f, 0 };
+
+        forward(source.view(), converted.view());
+        backward(converted.view(), restored.view());
+
+        for (std::size_t i = 0; i < source.r.size(); ++i)
+        {
+            expect_near(forward(source.at(i)), converted.at(i), 1e-6f);
+            expect_near(backward(converted.at(i)), restored.at(i), 1e-6f);
+            expect_near(source.at(i), restored.at(i), tolerance);
+        }
+
+        // In place
+        forward(source.view(), source.view());
+
+        EXPECT_EQ(converted.r, source.r);
+        EXPECT_EQ(converted.g, source.g);
+        EXPECT_EQ(converted.b, source.b);
+    }
+}
+
+TEST_F(color_space_test, hsv)
+{
+    expect_near({ 0.0f, 1.0f, 1.0f, 0.5f }, rgb_to_hsv(color { 1.0f, 0.0f, 0.0f, 0.5f }), 1e-6f);
+    expect_near({ 1.0f / 3.0f, 1.0f, 0.5f, 1.0f }, rgb_to_hsv(color { 0.0f, 0.5f, 0.0f, 1.0f }), 1e-6f);
+    expect_near({ 2.0f / 3.0f, 0.5f, 1.0f, 1.0f }, rgb_to_hsv(color { 0.5f, 0.5f, 1.0f, 1.0f }), 1e-6f);
+    expect_near({ 5.0f / 6.0f, 1.0f, 1.0f, 1.0f }, rgb_to_hsv(color { 1.0f, 0.0f, 1.0f, 1.0f }), 1e-6f);
+    expect_near({ 0.0f, 0.0f, 0.25f, 1.0f }, rgb_to_hsv(color { 0.25f, 0.25f, 0.25f, 1.0f }), 1e-6f);
+    expect_near({ 0.0f, 0.0f, 0.0f, 1.0f }, rgb_to_hsv(color { 0.0f, 0.0f, 0.0f, 1.0f }), 1e-6f);
+
+    expect_near({ 1.0f, 1.0f, 0.0f, 1.0f }, hsv_to_rgb(color { 1.0f / 6.0f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+    expect_near({ 1.0f, 0.0f, 0.0f, 1.0f }, hsv_to_rgb(color { 1.0f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+    expect_near({ 0.0f, 1.0f, 1.0f, 1.0f }, hsv_to_rgb(color { -0.5f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+
+    check_round_trip([](auto&&... args) { return rgb_to_hsv(args...); }
+                   , [](auto&&... args) { return hsv_to_rgb(args...); }
+                   , 1e-5f);
+}
+
+TEST_F(color_space_test, hsl)
+{
+    expect_near({ 0.0f, 1.0f, 0.5f, 1.0f }, rgb_to_hsl(color { 1.0f, 0.0f, 0.0f, 1.0f }), 1e-6f);
+    expect_near({ 0.5f, 1.0f, 0.75f, 1.0f }, rgb_to_hsl(color { 0.5f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+    expect_near({ 0.0f, 0.0f, 1.0f, 1.0f }, rgb_to_hsl(color { 1.0f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+
+    expect_near({ 0.0f, 0.5f, 0.0f, 1.0f }, hsl_to_rgb(color { 1.0f / 3.0f, 1.0f, 0.25f, 1.0f }), 1e-6f);
+    expect_near({ 0.75f, 0.25f, 0.75f, 1.0f }, hsl_to_rgb(color { 5.0f / 6.0f, 0.5f, 0.5f, 1.0f }), 1e-6f);
+
+    check_round_trip([](auto&&... args) { return rgb_to_hsl(args...); }
+                   , [](auto&&... args) { return hsl_to_rgb(args...); }
+                   , 1e-5f);
+}
+
+TEST_F(color_space_test, ycocg)
+{
+    expect_near({ 0.25f, 0.5f, -0.25f, 1.0f }, rgb_to_ycocg(color { 1.0f, 0.0f, 0.0f, 1.0f }), 1e-6f);
+    expect_near({ 0.5f, 0.0f, 0.5f, 1.0f }, rgb_to_ycocg(color { 0.0f, 1.0f, 0.0f, 1.0f }), 1e-6f);
+    expect_near({ 1.0f, 0.0f, 0.0f, 1.0f }, rgb_to_ycocg(color { 1.0f, 1.0f, 1.0f, 1.0f }), 1e-6f);
+
+    check_round_trip([](auto&&... args) { return rgb_to_ycocg(args...); }
+                   , [](auto&&... args) { return ycocg_to_rgb(args...); }
+                   , 1e-6f);
+}
+
+TEST_F(color_space_test, xyz)
+{
+    // D65 white point
+    expect_near({ 0.95047f, 1.0f, 1.08883f, 1.0f }, rgb_to_xyz(color { 1.0f, 1.0f, 1.0f, 1.0f }), 1e-4f);
+    expect_near({ 0.3575761f, 0.7151522f, 0.1191920f, 1.0f }, rgb_to_xyz(color { 0.0f, 1.0f, 0.0f, 1.0f }), 1e-6f);
+    expect_near({ 1.0f, 1.0f, 1.0f, 1.0f }, xyz_to_rgb(color { 0.95047f, 1.0f, 1.08883f, 1.0f }), 1e-4f);
+
+    check_round_trip([](auto&&... args) { return rgb_to_xyz(args...); }
+                   , [](auto&&... args) { return xyz_to_rgb(args...); }
+                   , 1e-5f);
+}
@@ -0,0 +1,272 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "cpu_dispatch_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <scener/math/cpu_dispatch.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    // Not a multiple of any register width, so every kernel also runs its scalar tail
+    constexpr std::size_t element_count = 77;
+
+    /// Runs the given check with every instruction set the CPU supports, then restores the default selection.
+    template <typename F>
+    void for_each_instruction_set(F&& check)
+    {
+        auto supported = dispatch::supported_instruction_set();
+
+        for (auto i = std::uint32_t(dispatch::instruction_set::scalar); i <= std::uint32_t(supported); ++i)
+        {
+            auto isa = static_cast<dispatch::instruction_set>(i);
+
+            ASSERT_EQ(isa, dispatch::select_instruction_set(isa));
+
+            SCOPED_TRACE(dispatch::to_string(isa));
+
+            check();
+        }
+
+        dispatch::select_instruction_set(supported);
+    }
+
+    std::vector<vector3> random_vectors3(std::size_t count, float range, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> value { -range, range };
+        std::vector<vector3>                  result;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result.push_back({ value(engine), value(engine), value(engine) });
+        }
+
+        return result;
+    }
+
+    std::vector<vector4> random_vectors4(std::size_t count, float range, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> value { -range, range };
+        std::vector<vector4>                  result;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result.push_back({ value(engine), value(engine), value(engine), value(engine) });
+        }
+
+        return result;
+    }
+
+    matrix4 random_matrix(std::mt19937& engine)
+    {
+        std::uniform_real_distribution<float> value { -2.0f, 2.0f };
+        matrix4                               result;
+
+        for (auto& item : result)
+        {
+            item = value(engine);
+        }
+
+        return result;
+    }
+}
+
+TEST_F(cpu_dispatch_test, select_instruction_set)
+{
+    auto supported = dispatch::supported_instruction_set();
+
+    EXPECT_EQ(supported, dispatch::selected_instruction_set());
+    EXPECT_EQ(dispatch::instruction_set::scalar, dispatch::select_instruction_set(dispatch::instruction_set::scalar));
+    EXPECT_EQ(dispatch::instruction_set::scalar, dispatch::selected_instruction_set());
+    EXPECT_EQ(supported, dispatch::select_instruction_set(dispatch::instruction_set::avx512));
+    EXPECT_EQ(supported, dispatch::selected_instruction_set());
+
+#if defined(__x86_64__) || defined(_M_X64)
+    EXPECT_LE(dispatch::instruction_set::sse2, supported);
+#endif
+}
+
+TEST_F(cpu_dispatch_test, to_string)
+{
+    EXPECT_STREQ("scalar", dispatch::to_string(dispatch::instruction_set::scalar));
+    EXPECT_STREQ("sse2", dispatch::to_string(dispatch::instruction_set::sse2));
+    EXPECT_STREQ("avx2", dispatch::to_string(dispatch::instruction_set::avx2));
+    EXPECT_STREQ("avx512", dispatch::to_string(dispatch::instruction_set::avx512));
+}
+
+TEST_F(cpu_dispatch_test, transform)
+{
+    std::mt19937 engine { 41 };
+
+    auto matrix = random_matrix(engine);
+    auto source = random_vectors4(element_count, 4.0f, 7);
+
+    for_each_instruction_set([&]
+    {
+        std::vector<vector4> result(source.size());
+        std::vector<vector4> in_place(source);
+
+        dispatch::transform(source, matrix, result);
+        dispatch::transform(in_place, matrix, in_place);
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(vector::transform(source[i], matrix), result[i]));
+            EXPECT_TRUE(equality_helper::equal(result[i], in_place[i]));
+        }
+    });
+}
+
+TEST_F(cpu_dispatch_test, multiply)
+{
+    std::mt19937         engine { 42 };
+    std::vector<matrix4> lhs;
+    std::vector<matrix4> rhs;
+
+    for (std::size_t i = 0; i < 9; ++i)
+    {
+        lhs.push_back(random_matrix(engine));
+        rhs.push_back(random_matrix(engine));
+    }
+
+    for_each_instruction_set([&]
+    {
+        std::vector<matrix4> result(lhs.size());
+        std::vector<matrix4> in_place(rhs);
+
+        dispatch::multiply(lhs, rhs, result);
+        dispatch::multiply(lhs, in_place, in_place);
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(lhs[i] * rhs[i], result[i]));
+            EXPECT_TRUE(equality_helper::equal(result[i], in_place[i]));
+        }
+    });
+}
+
+TEST_F(cpu_dispatch_test, normalize)
+{
+    auto source = random_vectors3(element_count, 100.0f, 11);
+
+    for_each_instruction_set([&]
+    {
+        std::vector<vector3> result(source.size());
+
+        dispatch::normalize(source, result);
+
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(vector::normalize(source[i]), result[i]));
+        }
+    });
+}
+
+TEST_F(cpu_dispatch_test, slerp)
+{
+    std::mt19937                          engine { 13 };
+    std::uniform_real_distribution<float> value { 0.0f, 1.0f };
+    std::vector<quaternion>               from;
+    std::vector<quaternion>               to;
+    std::vector<float>                    amount;
+
+    for (const auto& axis : random_vectors3(element_count, 1.0f, 17))
+    {
+        auto other = vector3 { axis.z, axis.x, axis.y };
+
+        from.push_back(quat::create_from_axis_angle(vector::normalize(axis), radians { value(engine) * 3.0f }));
+        to.push_back(quat::create_from_axis_angle(vector::normalize(other), radians { value(engine) * -3.0f }));
+        amount.push_back(value(engine));
+    }
+
+    for_each_instruction_set([&]
+    {
+        std::vector<quaternion> result(from.size());
+
+        dispatch::slerp(from, to, amount, result);
+
+        for (std::size_t i = 0; i < from.size(); ++i)
+        {
+            EXPECT_TRUE(equality_helper::equal(quat::slerp(from[i], to[i], amount[i]), result[i]));
+        }
+    });
+}
+
+TEST_F(cpu_dispatch_test, bounds)
+{
+    auto points = random_vectors3(element_count, 50.0f, 19);
+
+    auto expected = bounding_box { points[0], points[0] };
+
+    for (const auto& point : points)
+    {
+        expected.min = vector::min(expected.min, point);
+        expected.max = vector::max(expected.max, point);
+    }
+
+    for_each_instruction_set([&]
+    {
+        for (auto count : { std::size_t(1), std::size_t(5), std::size_t(16), points.size() })
+        {
+            auto subset = gsl::span<const vector3>(points.data(), count);
+            auto box    = dispatch::bounds(subset);
+
+            for (const auto& point : subset)
+            {
+                EXPECT_TRUE(box.min.x <= point.x && box.min.y <= point.y && box.min.z <= point.z);
+                EXPECT_TRUE(box.max.x >= point.x && box.max.y >= point.y && box.max.z >= point.z);
+            }
+        }
+
+        auto box = dispatch::bounds(points);
+
+        // Minimum and maximum are exact, whatever the order they are computed in
+        EXPECT_EQ(expected.min, box.min);
+        EXPECT_EQ(expected.max, box.max);
+    });
+}
+
+TEST_F(cpu_dispatch_test, cull)
+{
+    auto eye        = vector3 { 0.0f, 10.0f, 0.0f };
+    auto view       = matrix::create_look_at(eye, eye + vector3::forward(), vector3::up());
+    auto projection = matrix::create_perspective_field_of_view(radians { pi_over_4<> }, 1.5f, 1.0f, 120.0f);
+    auto frustrum   = bounding_frustrum { view * projection };
+
+    std::mt19937                          engine { 23 };
+    std::uniform_real_distribution<float> radius { 0.1f, 10.0f };
+    std::vector<bounding_sphere>          spheres;
+
+    for (const auto& center : random_vectors3(element_count * 4, 130.0f, 29))
+    {
+        spheres.push_back({ center, radius(engine) });
+    }
+
+    for_each_instruction_set([&]
+    {
+        std::vector<std::uint8_t> visible(spheres.size(), 2);
+        std::size_t               count = 0;
+
+        dispatch::cull(spheres, frustrum, visible);
+
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+        {
+            EXPECT_EQ(intersects(frustrum, spheres[i]) ? 1 : 0, visible[i]);
+
+            count += visible[i];
+        }
+
+        EXPECT_LT(0u, count);
+        EXPECT_GT(spheres.size(), count);
+    });
+}
@@ -0,0 +1,229 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "executor_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <scener/math/executor.hpp>
+#include <scener/math/matrix.hpp>
+#include <scener/math/packed_vector.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    template <typename Executor>
+    void check_coverage(Executor& executor, std::size_t count, std::size_t grain)
+    {
+        std::vector<std::atomic<int>> visits(count);
+
+        executor.parallel_for(count, grain, [&](std::size_t begin, std::size_t end)
+        {
+            EXPECT_LT(begin, end);
+            EXPECT_EQ(0u, begin % grain);
+            EXPECT_TRUE(end == count || end % grain == 0);
+
+            for (auto i = begin; i < end; ++i)
+            {
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        for (const auto& visit : visits)
+        {
+            EXPECT_EQ(1, visit.load());
+        }
+    }
+}
+
+TEST_F(executor_test, traits)
+{
+    static_assert(is_executor_v<serial_executor>);
+    static_assert(is_executor_v<thread_pool_executor&>);
+    static_assert(!is_executor_v<int>);
+    static_assert(!is_executor_v<gsl::span<const float>>);
+}
+
+TEST_F(executor_test, serial)
+{
+    serial_executor executor;
+    std::size_t     calls = 0;
+
+    executor.parallel_for(100, 10, [&](std::size_t begin, std::size_t end)
+    {
+        EXPECT_EQ(0u, begin);
+        EXPECT_EQ(100u, end);
+        ++calls;
+    });
+
+    executor.parallel_for(0, 10, [&](std::size_t, std::size_t) { ++calls; });
+
+    EXPECT_EQ(1u, calls);
+}
+
+TEST_F(executor_test, thread_pool)
+{
+    thread_pool_executor pool { 4 };
+
+    EXPECT_EQ(4u, pool.concurrency());
+
+    check_coverage(pool, 100000, 7);
+    check_coverage(pool, 1000, 1000);
+    check_coverage(pool, 3, 1);
+
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        check_coverage(pool, 64 + i, 16);
+    }
+
+    thread_pool_executor single { 1 };
+
+    check_coverage(single, 1000, 10);
+}
+
+TEST_F(executor_test, thread_pool_nested)
+{
+    thread_pool_executor pool { 3 };
+    std::atomic<int>     total { 0 };
+
+    pool.parallel_for(64, 1, [&](std::size_t begin, std::size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            pool.parallel_for(10, 1, [&](std::size_t b, std::size_t e) { total += int(e - b); });
+        }
+    });
+
+    EXPECT_EQ(640, total.load());
+}
+
+TEST_F(executor_test, thread_pool_concurrent_callers)
+{
+    thread_pool_executor     pool { 4 };
+    std::vector<std::thread> callers;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        callers.emplace_back([&pool] { check_coverage(pool, 5000, 13); });
+    }
+
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+}
+
+TEST_F(executor_test, adapter)
+{
+    std::size_t dispatches = 0;
+
+    executor_adapter adapter { [&](std::size_t chunks, chunk_function task)
+    {
+        std::vector<std::thread> threads;
+
+        ++dispatches;
+
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+            threads.emplace_back([task, i] { task(i); });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    } };
+
+    static_assert(is_executor_v<decltype(adapter)>);
+
+    check_coverage(adapter, 100, 9);
+    check_coverage(adapter, 9, 9);
+
+    EXPECT_EQ(1u, dispatches);
+}
+
+TEST_F(executor_test, small_inputs_run_serially)
+{
+    thread_pool_executor pool { 4 };
+    std::thread::id      caller = std::this_thread::get_id();
+    std::size_t          calls  = 0;
+
+    parallel_for(pool, 100, sizeof(float), [&](std::size_t begin, std::size_t end)
+    {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+        EXPECT_EQ(0u, begin);
+        EXPECT_EQ(100u, end);
+        ++calls;
+    });
+
+    EXPECT_EQ(1u, calls);
+}
+
+TEST_F(executor_test, batch_operations)
+{
+    std::mt19937                          engine { 31 };
+    std::uniform_real_distribution<float> distribution { -2.0f, 2.0f };
+    thread_pool_executor                  pool { 4 };
+
+    std::vector<matrix4> lhs(5000);
+    std::vector<matrix4> rhs(lhs.size());
+    std::vector<matrix4> serial(lhs.size());
+    std::vector<matrix4> parallel(lhs.size());
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        for (std::size_t j = 0; j < 16; ++j)
+        {
+            lhs[i].data()[j] = distribution(engine);
+            rhs[i].data()[j] = distribution(engine);
+        }
+    }
+
+    matrix::multiply(lhs, rhs, serial);
+    matrix::multiply(pool, lhs, rhs, parallel);
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        EXPECT_EQ(serial[i], parallel[i]);
+    }
+
+    std::vector<vector3> positions(50000);
+    std::vector<vector3> transformed(positions.size());
+    std::vector<vector3> expected(positions.size());
+
+    for (auto& position : positions)
+    {
+        position = { distribution(engine), distribution(engine), distribution(engine) + 10.0f };
+    }
+
+    vector::transform(positions, matrix::create_translation(1.0f, 2.0f, 3.0f), expected);
+    vector::transform(pool, positions, matrix::create_translation(1.0f, 2.0f, 3.0f), transformed);
+
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        EXPECT_EQ(expected[i], transformed[i]);
+    }
+
+    // Any batch operation through parallel_batch
+    std::vector<float>        values(100000);
+    std::vector<std::uint8_t> packed(values.size());
+
+    for (auto& value : values)
+    {
+        value = distribution(engine);
+    }
+
+    parallel_batch(pool, [](auto s, auto d) { packed::pack_unorm8(s, d); }, values, packed);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_unorm8(values[i]), packed[i]);
+    }
+}
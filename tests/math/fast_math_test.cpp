@@ -0,0 +1,237 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "fast_math_test.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <scener/math/fast_math.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    // Not a multiple of any register width, so the batch forms also run their scalar tail
+    constexpr std::size_t sample_count = 100003;
+
+    std::vector<float> samples(float low, float high)
+    {
+        std::vector<float> result(sample_count);
+
+        for (std::size_t i = 0; i < sample_count; ++i)
+        {
+            result[i] = low + (high - low) * static_cast<float>(i) / static_cast<float>(sample_count - 1);
+        }
+
+        return result;
+    }
+
+    /// Largest absolute difference between the results and a reference computed in double precision.
+    template <typename F>
+    double max_absolute_error(const std::vector<float>& x, const std::vector<float>& result, F&& reference)
+    {
+        double error = 0.0;
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            error = std::max(error, std::abs(double(result[i]) - reference(double(x[i]))));
+        }
+
+        return error;
+    }
+
+    /// Largest difference relative to a reference computed in double precision.
+    template <typename F>
+    double max_relative_error(const std::vector<float>& x, const std::vector<float>& result, F&& reference)
+    {
+        double error = 0.0;
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            auto expected = reference(double(x[i]));
+
+            error = std::max(error, std::abs(double(result[i]) - expected) / std::abs(expected));
+        }
+
+        return error;
+    }
+
+    template <fast::precision P>
+    void check_sincos(double tolerance)
+    {
+        auto x = samples(-1000.0f, 1000.0f);
+
+        std::vector<float> s(x.size());
+        std::vector<float> c(x.size());
+
+        fast::sincos<P>(x, s, c);
+
+        EXPECT_GT(tolerance, max_absolute_error(x, s, [](double v) { return std::sin(v); }));
+        EXPECT_GT(tolerance, max_absolute_error(x, c, [](double v) { return std::cos(v); }));
+
+        for (std::size_t i = 0; i < x.size(); i += 97)
+        {
+            auto [si, ci] = fast::sincos<P>(x[i]);
+
+            EXPECT_NEAR(s[i], si, tolerance);
+            EXPECT_NEAR(c[i], ci, tolerance);
+        }
+    }
+
+    template <fast::precision P>
+    void check_atan2(double tolerance)
+    {
+        auto angles = samples(-3.14159f, 3.14159f);
+
+        std::vector<float> y(angles.size());
+        std::vector<float> x(angles.size());
+        std::vector<float> result(angles.size());
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            auto radius = 0.5f + static_cast<float>(i % 7);
+
+            y[i] = radius * std::sin(angles[i]);
+            x[i] = radius * std::cos(angles[i]);
+        }
+
+        fast::atan2<P>(y, x, result);
+
+        double error = 0.0;
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            error = std::max(error, std::abs(double(result[i]) - std::atan2(double(y[i]), double(x[i]))));
+
+            if (i % 97 == 0)
+            {
+                EXPECT_NEAR(result[i], fast::atan2<P>(y[i], x[i]).value, tolerance);
+            }
+        }
+
+        EXPECT_GT(tolerance, error);
+        EXPECT_EQ(0.0f, fast::atan2<P>(0.0f, 0.0f).value);
+        EXPECT_NEAR(pi_over_2<>, fast::atan2<P>(2.0f, 0.0f).value, tolerance);
+        EXPECT_NEAR(-pi_over_2<>, fast::atan2<P>(-2.0f, 0.0f).value, tolerance);
+        EXPECT_NEAR(pi<>, fast::atan2<P>(0.0f, -2.0f).value, tolerance);
+    }
+
+    template <fast::precision P>
+    void check_acos(double tolerance)
+    {
+        auto x = samples(-1.0f, 1.0f);
+
+        std::vector<float> result(x.size());
+
+        fast::acos<P>(x, result);
+
+        EXPECT_GT(tolerance, max_absolute_error(x, result, [](double v) { return std::acos(v); }));
+        EXPECT_NEAR(0.0f, fast::acos<P>(1.0f).value, tolerance);
+        EXPECT_NEAR(pi<>, fast::acos<P>(-1.0f).value, tolerance);
+        EXPECT_TRUE(std::isnan(fast::acos<P>(1.5f).value));
+    }
+
+    template <fast::precision P>
+    void check_exp(double tolerance)
+    {
+        auto x = samples(-87.0f, 88.0f);
+
+        std::vector<float> result(x.size());
+
+        fast::exp<P>(x, result);
+
+        EXPECT_GT(tolerance, max_relative_error(x, result, [](double v) { return std::exp(v); }));
+        EXPECT_EQ(1.0f, fast::exp<P>(0.0f));
+        EXPECT_EQ(0.0f, fast::exp<P>(-200.0f));
+        EXPECT_EQ(std::numeric_limits<float>::infinity(), fast::exp<P>(100.0f));
+        EXPECT_TRUE(std::isnan(fast::exp<P>(std::numeric_limits<float>::quiet_NaN())));
+
+        // Subnormal results
+        EXPECT_NEAR(std::exp(-100.0f), fast::exp<P>(-100.0f), std::exp(-100.0f) * 1e-2f);
+    }
+
+    template <fast::precision P>
+    void check_log(double tolerance)
+    {
+        auto x = samples(1e-3f, 1e3f);
+
+        for (auto value : { 1e-40f, 1e-30f, 0.5f, 1.0f, 2.0f, 1e30f })
+        {
+            x.push_back(value);
+        }
+
+        std::vector<float> result(x.size());
+
+        fast::log<P>(x, result);
+
+        // Absolute near x = 1, where the logarithm goes through zero, relative elsewhere
+        double error = 0.0;
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            auto expected = std::log(double(x[i]));
+
+            error = std::max(error, std::abs(double(result[i]) - expected) / std::max(1.0, std::abs(expected)));
+        }
+
+        EXPECT_GT(tolerance, error);
+        EXPECT_EQ(0.0f, fast::log<P>(1.0f));
+        EXPECT_EQ(-std::numeric_limits<float>::infinity(), fast::log<P>(0.0f));
+        EXPECT_EQ(std::numeric_limits<float>::infinity(), fast::log<P>(std::numeric_limits<float>::infinity()));
+        EXPECT_TRUE(std::isnan(fast::log<P>(-1.0f)));
+    }
+}
+
+TEST_F(fast_math_test, sincos)
+{
+    check_sincos<fast::precision::low>(2e-5);
+    check_sincos<fast::precision::high>(3e-7);
+}
+
+TEST_F(fast_math_test, sincos_of_angles)
+{
+    auto [s, c] = fast::sincos(degrees { 90.0f });
+
+    EXPECT_NEAR(1.0f, s, 1e-7f);
+    EXPECT_NEAR(0.0f, c, 1e-7f);
+
+    std::vector<radians> angles = { radians { 0.5f }, radians { -2.0f }, radians { 7.0f } };
+    std::vector<float>   sin(angles.size());
+    std::vector<float>   cos(angles.size());
+
+    fast::sincos(angles, sin, cos);
+
+    for (std::size_t i = 0; i < angles.size(); ++i)
+    {
+        EXPECT_NEAR(std::sin(angles[i].value), sin[i], 3e-7f);
+        EXPECT_NEAR(std::cos(angles[i].value), cos[i], 3e-7f);
+    }
+
+    EXPECT_TRUE(std::isnan(fast::sincos(std::numeric_limits<float>::infinity()).first));
+}
+
+TEST_F(fast_math_test, atan2)
+{
+    check_atan2<fast::precision::low>(1e-4);
+    check_atan2<fast::precision::high>(5e-7);
+}
+
+TEST_F(fast_math_test, acos)
+{
+    check_acos<fast::precision::low>(1e-4);
+    check_acos<fast::precision::high>(5e-7);
+}
+
+TEST_F(fast_math_test, exp)
+{
+    check_exp<fast::precision::low>(2e-4);
+    check_exp<fast::precision::high>(3e-7);
+}
+
+TEST_F(fast_math_test, log)
+{
+    check_log<fast::precision::low>(2e-5);
+    check_log<fast::precision::high>(3e-7);
+}
@@ -0,0 +1,130 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "frame_arena_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <scener/math/frame_arena.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+TEST_F(frame_arena_test, allocate)
+{
+    frame_arena arena { 1024 };
+
+    auto a = arena.allocate<std::uint8_t>(3);
+    auto b = arena.allocate<double>(4);
+    auto c = arena.allocate(10, 64);
+
+    EXPECT_EQ(3u, a.size());
+    EXPECT_EQ(4u, b.size());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(b.data()) % alignof(double));
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(c) % 64);
+    EXPECT_LE(reinterpret_cast<std::uintptr_t>(a.data() + a.size()), reinterpret_cast<std::uintptr_t>(b.data()));
+    EXPECT_EQ(3u, arena.stats().allocations);
+    EXPECT_EQ(0u, arena.stats().overflows);
+    EXPECT_LE(3u + 32u + 10u, arena.stats().used);
+}
+
+TEST_F(frame_arena_test, rewind)
+{
+    frame_arena arena { 1024 };
+
+    arena.allocate<float>(16);
+
+    auto used = arena.stats().used;
+    auto mark = arena.mark();
+
+    {
+        scratch_scope scratch { arena };
+
+        auto first = scratch.allocate<float>(8);
+
+        EXPECT_EQ(used + 32, arena.stats().used);
+
+        arena.rewind(mark);
+
+        EXPECT_EQ(first.data(), arena.allocate<float>(8).data());
+    }
+
+    EXPECT_EQ(used, arena.stats().used);
+}
+
+TEST_F(frame_arena_test, overflow_and_reset)
+{
+    frame_arena arena { 256 };
+
+    auto capacity = arena.stats().capacity;
+    auto small    = arena.allocate<std::uint8_t>(64);
+    auto large    = arena.allocate<std::uint8_t>(capacity * 4);
+
+    EXPECT_EQ(1u, arena.stats().overflows);
+    EXPECT_EQ(capacity * 4 + 64, arena.stats().used);
+
+    // The heap allocation is writable and released on reset
+    large[large.size() - 1] = 1;
+    small[0]                = 1;
+
+    arena.reset();
+
+    EXPECT_EQ(0u, arena.stats().used);
+    EXPECT_EQ(0u, arena.stats().allocations);
+    EXPECT_EQ(1u, arena.stats().frames);
+    EXPECT_EQ(capacity * 4 + 64, arena.stats().peak);
+    EXPECT_LE(arena.stats().peak, arena.stats().capacity);
+
+    // The next frame fits in the arena block
+    arena.allocate<std::uint8_t>(64);
+    arena.allocate<std::uint8_t>(capacity * 4);
+
+    EXPECT_EQ(0u, arena.stats().overflows);
+}
+
+TEST_F(frame_arena_test, thread_arena)
+{
+    auto& arena = thread_frame_arena();
+
+    const frame_arena* other = nullptr;
+
+    std::thread { [&other] { other = &thread_frame_arena(); } }.join();
+
+    EXPECT_NE(&arena, other);
+    EXPECT_EQ(&arena, &thread_frame_arena());
+}
+
+TEST_F(frame_arena_test, transform_span)
+{
+    std::mt19937                          engine { 29 };
+    std::uniform_real_distribution<float> distribution { -10.0f, 10.0f };
+    std::vector<vector3>                  positions(1001);
+    std::vector<vector3>                  result(positions.size());
+
+    for (auto& position : positions)
+    {
+        position = { distribution(engine), distribution(engine), distribution(engine) };
+    }
+
+    auto matrix = matrix::create_perspective_field_of_view(radians(60_deg), 1.5f, 0.1f, 100.0f)
+                * matrix::create_translation(1.0f, 2.0f, -30.0f);
+    auto used   = thread_frame_arena().stats().used;
+
+    vector::transform(positions, matrix, result);
+
+    EXPECT_EQ(used, thread_frame_arena().stats().used);
+
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        auto expected = vector::transform(positions[i], matrix);
+
+        EXPECT_NEAR(expected.x, result[i].x, 1e-4f * (1.0f + std::abs(expected.x)));
+        EXPECT_NEAR(expected.y, result[i].y, 1e-4f * (1.0f + std::abs(expected.y)));
+        EXPECT_NEAR(expected.z, result[i].z, 1e-4f * (1.0f + std::abs(expected.z)));
+    }
+}
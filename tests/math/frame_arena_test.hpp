@@ -0,0 +1,20 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TESTS_FRAME_ARENA_TEST_HPP
+#define	TESTS_FRAME_ARENA_TEST_HPP
+
+#include <gtest/gtest.h>
+
+class frame_arena_test : public testing::Test
+{
+protected:
+    // virtual void SetUp() will be called before each test is run.  You
+    // should define it if you need to initialize the varaibles.
+    // Otherwise, this can be skipped.
+    void SetUp() override
+    {
+    }
+};
+
+#endif // TESTS_FRAME_ARENA_TEST_HPP
@@ -0,0 +1,139 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "half_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <scener/math/half.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+TEST_F(half_test, round_trip)
+{
+    // Every half value converts to float and back to itself
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits)
+    {
+        auto value = half::from_bits(static_cast<std::uint16_t>(bits));
+
+        if (std::isnan(float(value)))
+        {
+            // Signaling NaNs are quieted
+            EXPECT_TRUE(std::isnan(float(half { float(value) })));
+        }
+        else
+        {
+            EXPECT_EQ(bits, half { float(value) }.bits());
+        }
+    }
+}
+
+TEST_F(half_test, rounding)
+{
+    EXPECT_EQ(0x3C00u, half { 1.0f }.bits());
+    EXPECT_EQ(0xC000u, half { -2.0f }.bits());
+    EXPECT_EQ(0x7BFFu, half { 65504.0f }.bits());
+    EXPECT_EQ(0x0001u, half { std::ldexp(1.0f, -24) }.bits());
+    EXPECT_EQ(0x0400u, half { std::ldexp(1.0f, -14) }.bits());
+
+    // Ties round to even
+    EXPECT_EQ(0x3C00u, half { 1.0f + std::ldexp(1.0f, -11) }.bits());
+    EXPECT_EQ(0x3C02u, half { 1.0f + 3.0f * std::ldexp(1.0f, -11) }.bits());
+    EXPECT_EQ(0x0000u, half { std::ldexp(1.0f, -25) }.bits());
+    EXPECT_EQ(0x0002u, half { 3.0f * std::ldexp(1.0f, -25) }.bits());
+
+    // Overflow and underflow
+    EXPECT_EQ(0x7BFFu, half { 65519.0f }.bits());
+    EXPECT_EQ(0x7C00u, half { 65520.0f }.bits());
+    EXPECT_EQ(0xFC00u, half { -1.0e6f }.bits());
+    EXPECT_EQ(0x8000u, half { -1.0e-10f }.bits());
+}
+
+TEST_F(half_test, special_values)
+{
+    EXPECT_TRUE(std::isinf(float(half { positive_infinity<> })));
+    EXPECT_TRUE(std::isnan(float(half { NaN<> })));
+    EXPECT_TRUE(is_nan(NaN<half>));
+    EXPECT_TRUE(is_positive_infinity(positive_infinity<half>));
+    EXPECT_EQ(65504.0f, float(max_value<half>));
+    EXPECT_EQ(-65504.0f, float(min_value<half>));
+    EXPECT_EQ(std::ldexp(1.0f, -10), float(epsilon<half>));
+}
+
+TEST_F(half_test, vector_arithmetic)
+{
+    vector3h a { 1.0f, 2.0f, 3.0f };
+    vector3h b { 0.5f, -1.0f, 4.0f };
+
+    EXPECT_EQ(sizeof(half) * 3, sizeof(vector3h));
+    EXPECT_EQ(vector3h(1.5f, 1.0f, 7.0f), a + b);
+    EXPECT_EQ(vector3h(0.5f, -2.0f, 12.0f), a * b);
+    EXPECT_EQ(vector3h(2.0f, 4.0f, 6.0f), a * 2.0f);
+    EXPECT_EQ(10.5f, float(vector::dot(a, b)));
+    EXPECT_NEAR(1.0f, float(vector::length(vector::normalize(a))), 1.0e-3f);
+}
+
+TEST_F(half_test, convert_span)
+{
+    std::mt19937                          engine { 3 };
+    std::uniform_real_distribution<float> distribution { -70000.0f, 70000.0f };
+    std::vector<float>                    source(1003);
+
+    for (auto& value : source)
+    {
+        value = distribution(engine) * std::pow(2.0f, float(int(engine() % 40)) - 30.0f);
+    }
+
+    source[0] = NaN<>;
+    source[1] = positive_infinity<>;
+    source[2] = std::ldexp(1.0f, -25);
+
+    std::vector<half>  packed(source.size());
+    std::vector<float> unpacked(source.size());
+
+    convert(source, packed);
+    convert(packed, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        if (std::isnan(source[i]))
+        {
+            EXPECT_TRUE(std::isnan(unpacked[i]));
+        }
+        else
+        {
+            // The batch conversion matches the scalar one
+            EXPECT_EQ(half { source[i] }.bits(), packed[i].bits());
+            EXPECT_EQ(float(packed[i]), unpacked[i]);
+        }
+    }
+}
+
+TEST_F(half_test, convert_vector_span)
+{
+    std::vector<vector3>  source   { { 1.0f, 2.0f, 3.0f }, { -0.25f, 0.125f, 1024.0f }, { 0.1f, 0.2f, 0.3f } };
+    std::vector<vector3h> packed(source.size());
+    std::vector<vector3>  unpacked(source.size());
+
+    convert<3>(source, packed);
+    convert<3>(packed, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_TRUE(vector::distance(source[i], unpacked[i]) < 1.0e-3f);
+    }
+
+    // Empty vectors have no storage at all
+    std::vector<vector3>  empty;
+    std::vector<vector3h> empty_packed;
+
+    convert<3>(empty, empty_packed);
+    convert<3>(empty_packed, empty);
+
+    EXPECT_TRUE(empty.empty());
+}
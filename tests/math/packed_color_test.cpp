@@ -0,0 +1,218 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "packed_color_test.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <scener/math/color.hpp>
+#include <scener/math/packed_color.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    std::vector<color> generate_colors(std::size_t count, float min, float max, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> distribution { min, max };
+        std::vector<color>                    colors(count);
+
+        for (auto& value : colors)
+        {
+            value = { distribution(engine), distribution(engine), distribution(engine), distribution(engine) };
+        }
+
+        return colors;
+    }
+
+    double exact_srgb_to_linear(double value)
+    {
+        return (value <= 0.04045) ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+    }
+
+    double exact_linear_to_srgb(double value)
+    {
+        return (value <= 0.0031308) ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+    }
+}
+
+TEST_F(packed_color_test, packed_value)
+{
+    EXPECT_EQ(0x80FF0040u, packed_value(color { 0.5f, 1.0f, 0.0f, 0.25f }));
+    EXPECT_EQ(0xFF00FF00u, packed_value(color { 2.0f, -1.0f, 1.0f, 0.0f }));
+    EXPECT_EQ(0x01020304u, packed_value(basic_color<std::uint8_t> { 1, 2, 3, 4 }));
+
+    static_assert(packed_value(color { 1.0f, 0.0f, 0.0f, 1.0f }) == 0xFF0000FFu);
+}
+
+TEST_F(packed_color_test, packed_value_rounding)
+{
+    // Every 8 bit value, and the values halfway between two of them, where the rounding rules differ
+    std::vector<color> source;
+
+    for (int i = 0; i < 256; ++i)
+    {
+        auto value   = float(i) / 255.0f;
+        auto halfway = float((i + 0.5) / 255.0);
+
+        source.push_back({ value, value, value, value });
+        source.push_back({ halfway, std::nextafter(halfway, 0.0f), std::nextafter(halfway, 1.0f), halfway });
+    }
+
+    std::vector<std::uint32_t> packed_values(source.size());
+
+    packed::pack_rgba8(source, packed_values);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_rgba8(source[i]), packed_value(source[i])) << "color " << i;
+        EXPECT_EQ(packed_values[i], packed_value(source[i])) << "color " << i;
+    }
+
+    static_assert(packed_value(color { 0.5f, 0.5f, 0.5f, 0.5f }) == 0x80808080u);
+}
+
+TEST_F(packed_color_test, layouts)
+{
+    color value { 1.0f / 255.0f, 2.0f / 255.0f, 3.0f / 255.0f, 4.0f / 255.0f };
+
+    EXPECT_EQ(0x01020304u, packed::pack_rgba8(value));
+    EXPECT_EQ(0x03020104u, packed::pack_bgra8(value));
+    EXPECT_EQ(0x04030201u, packed::pack_abgr8(value));
+    EXPECT_EQ(packed_value(value), packed::pack_rgba8(value));
+
+    EXPECT_EQ(value, packed::unpack_rgba8(0x01020304u));
+    EXPECT_EQ(value, packed::unpack_bgra8(0x03020104u));
+    EXPECT_EQ(value, packed::unpack_abgr8(0x04030201u));
+}
+
+TEST_F(packed_color_test, pack_span)
+{
+    auto source = generate_colors(1003, -0.1f, 1.1f, 11);
+
+    std::vector<std::uint32_t> rgba(source.size());
+    std::vector<std::uint32_t> bgra(source.size());
+    std::vector<std::uint32_t> abgr(source.size());
+    std::vector<color>         unpacked(source.size());
+
+    packed::pack_rgba8(source, rgba);
+    packed::pack_bgra8(source, bgra);
+    packed::pack_abgr8(source, abgr);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_rgba8(source[i]), rgba[i]);
+        EXPECT_EQ(packed::pack_bgra8(source[i]), bgra[i]);
+        EXPECT_EQ(packed::pack_abgr8(source[i]), abgr[i]);
+    }
+
+    packed::unpack_rgba8(rgba, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_rgba8(rgba[i]), unpacked[i]);
+    }
+
+    packed::unpack_bgra8(bgra, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_bgra8(bgra[i]), unpacked[i]);
+    }
+
+    packed::unpack_abgr8(abgr, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_abgr8(abgr[i]), unpacked[i]);
+
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            auto expected = std::fmin(std::fmax(source[i][c], 0.0f), 1.0f);
+
+            EXPECT_NEAR(expected, unpacked[i][c], 0.5f / 255.0f + 1e-6f);
+        }
+    }
+}
+
+TEST_F(packed_color_test, srgb_accuracy)
+{
+    for (std::uint32_t i = 0; i <= 100000; ++i)
+    {
+        auto value   = float(i) / 100000.0f;
+        auto linear  = exact_srgb_to_linear(value);
+        auto encoded = exact_linear_to_srgb(value);
+
+        EXPECT_NEAR(linear, srgb_to_linear(value), linear * 1e-5 + 1e-7);
+        EXPECT_NEAR(encoded, linear_to_srgb(value), encoded * 1e-5 + 1e-7);
+    }
+}
+
+TEST_F(packed_color_test, srgb_span)
+{
+    auto source = generate_colors(1001, 0.0f, 1.0f, 13);
+
+    std::vector<color> linear(source.size());
+    std::vector<color> encoded(source.size());
+
+    srgb_to_linear(source, linear);
+    linear_to_srgb(linear, encoded);
+
+    // The compiler may fuse the products and sums of the scalar conversions but not the ones of the batches
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        auto expected_linear  = srgb_to_linear(source[i]);
+        auto expected_encoded = linear_to_srgb(linear[i]);
+
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            EXPECT_NEAR(expected_linear[c], linear[i][c], 1e-6f);
+            EXPECT_NEAR(expected_encoded[c], encoded[i][c], 1e-6f);
+            EXPECT_NEAR(source[i][c], encoded[i][c], 1e-5f);
+        }
+
+        EXPECT_EQ(source[i].a, linear[i].a);
+        EXPECT_EQ(source[i].a, encoded[i].a);
+    }
+
+    // In place
+    linear_to_srgb(linear, linear);
+
+    EXPECT_EQ(encoded, linear);
+}
+
+TEST_F(packed_color_test, srgb8)
+{
+    for (std::uint32_t i = 0; i < 256; ++i)
+    {
+        auto linear = packed::srgb8_to_linear(static_cast<std::uint8_t>(i));
+
+        EXPECT_EQ(float(exact_srgb_to_linear(i / 255.0)), linear);
+        EXPECT_EQ(i, packed::linear_to_srgb8(linear));
+    }
+
+    EXPECT_EQ(0u, packed::linear_to_srgb8(-1.0f));
+    EXPECT_EQ(255u, packed::linear_to_srgb8(2.0f));
+    EXPECT_EQ(0xBC00FF80u, packed::pack_srgba8(color { 0.5f, 0.0f, 1.0f, 0.5f }));
+    EXPECT_EQ(color(packed::srgb8_to_linear(0xBC), 0.0f, 1.0f, 128.0f / 255.0f), packed::unpack_srgba8(0xBC00FF80u));
+}
+
+TEST_F(packed_color_test, srgb8_span)
+{
+    auto source = generate_colors(1002, -0.1f, 1.1f, 17);
+
+    std::vector<std::uint32_t> values(source.size());
+    std::vector<color>         unpacked(source.size());
+
+    packed::pack_srgba8(source, values);
+    packed::unpack_srgba8(values, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_srgba8(source[i]), values[i]);
+        EXPECT_EQ(packed::unpack_srgba8(values[i]), unpacked[i]);
+    }
+}
@@ -0,0 +1,132 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "packed_quaternion_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <scener/math/packed_quaternion.hpp>
+#include <scener/math/quaternion.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    std::vector<quaternion> generate_rotations(std::size_t count, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> distribution { -1.0f, 1.0f };
+        std::vector<quaternion>               rotations(count);
+
+        for (auto& rotation : rotations)
+        {
+            rotation = quat::normalize(quaternion { distribution(engine), distribution(engine), distribution(engine), distribution(engine) });
+        }
+
+        rotations[0] = quaternion::identity();
+        rotations[1] = { 0.0f, 0.0f, -1.0f, 0.0f };
+        rotations[2] = quat::normalize(quaternion { 0.5f, -0.5f, 0.5f, -0.5f });
+        rotations[3] = quat::normalize(quaternion { 1.0f, 0.0f, -1.0f, 0.0f });
+
+        return rotations;
+    }
+
+    /// Returns the angle, in degrees, of the rotation between both quaternions.
+    float rotation_error(const quaternion& lhs, const quaternion& rhs)
+    {
+        // q and -q represent the same rotation, compare against the closest one
+        auto delta = (quat::dot(lhs, rhs) < 0.0f) ? lhs + rhs : lhs - rhs;
+
+        return 4.0f * std::asin(std::min(1.0f, std::sqrt(quat::length_squared(delta)) * 0.5f)) * 180.0f / pi<>;
+    }
+
+    template <typename Pack, typename Unpack>
+    float max_component_error(const std::vector<quaternion>& rotations, Pack pack, Unpack unpack)
+    {
+        float result = 0.0f;
+
+        for (const auto& rotation : rotations)
+        {
+            auto decoded = unpack(pack(rotation));
+            auto sign    = (quat::dot(rotation, decoded) < 0.0f) ? -1.0f : 1.0f;
+
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                result = std::max(result, std::abs(rotation[i] - decoded[i] * sign));
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_F(packed_quaternion_test, round_trip_error)
+{
+    auto rotations = generate_rotations(5000, 1);
+
+    auto error32 = max_component_error(rotations
+                                     , [] (const quaternion& q) { return packed::pack_quaternion32(q); }
+                                     , [] (std::uint32_t code) { return packed::unpack_quaternion32(code); });
+    auto error48 = max_component_error(rotations
+                                     , [] (const quaternion& q) { return packed::pack_quaternion48(q); }
+                                     , [] (const packed::quaternion48& code) { return packed::unpack_quaternion48(code); });
+    auto error64 = max_component_error(rotations
+                                     , [] (const quaternion& q) { return packed::pack_quaternion64(q); }
+                                     , [] (std::uint64_t code) { return packed::unpack_quaternion64(code); });
+
+    EXPECT_LT(error32, 0.002f);
+    EXPECT_LT(error48, 0.0001f);
+    EXPECT_LT(error64, 0.000003f);
+
+    for (const auto& rotation : rotations)
+    {
+        EXPECT_LT(rotation_error(rotation, packed::unpack_quaternion32(packed::pack_quaternion32(rotation))), 0.25f);
+        EXPECT_LT(rotation_error(rotation, packed::unpack_quaternion48(packed::pack_quaternion48(rotation))), 0.01f);
+    }
+}
+
+TEST_F(packed_quaternion_test, largest_component_sign)
+{
+    // The largest component is rebuilt as positive, so the decoded quaternion may be negated
+    quaternion rotation { 0.1f, -0.9f, 0.3f, 0.2f };
+
+    rotation = quat::normalize(rotation);
+
+    auto decoded = packed::unpack_quaternion64(packed::pack_quaternion64(rotation));
+
+    EXPECT_TRUE(equality_helper::equal(-rotation, decoded));
+    EXPECT_TRUE(equality_helper::equal(quaternion::identity(), packed::unpack_quaternion32(packed::pack_quaternion32(quaternion::identity()))));
+}
+
+TEST_F(packed_quaternion_test, batch_matches_scalar)
+{
+    auto rotations = generate_rotations(1027, 2);
+
+    std::vector<std::uint32_t>         codes32(rotations.size());
+    std::vector<packed::quaternion48>  codes48(rotations.size());
+    std::vector<std::uint64_t>         codes64(rotations.size());
+    std::vector<quaternion>            decoded32(rotations.size());
+    std::vector<quaternion>            decoded48(rotations.size());
+    std::vector<quaternion>            decoded64(rotations.size());
+
+    packed::pack_quaternion32(rotations, codes32);
+    packed::pack_quaternion48(rotations, codes48);
+    packed::pack_quaternion64(rotations, codes64);
+    packed::unpack_quaternion32(codes32, decoded32);
+    packed::unpack_quaternion48(codes48, decoded48);
+    packed::unpack_quaternion64(codes64, decoded64);
+
+    for (std::size_t i = 0; i < rotations.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_quaternion32(rotations[i]), codes32[i]);
+        EXPECT_EQ(packed::pack_quaternion48(rotations[i]), codes48[i]);
+        EXPECT_EQ(packed::pack_quaternion64(rotations[i]), codes64[i]);
+        EXPECT_TRUE(equality_helper::equal(packed::unpack_quaternion32(codes32[i]), decoded32[i]));
+        EXPECT_TRUE(equality_helper::equal(packed::unpack_quaternion48(codes48[i]), decoded48[i]));
+        EXPECT_TRUE(equality_helper::equal(packed::unpack_quaternion64(codes64[i]), decoded64[i]));
+    }
+}
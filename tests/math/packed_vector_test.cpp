@@ -0,0 +1,302 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "packed_vector_test.hpp"
+
+#include "equality_helper.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <scener/math/packed_vector.hpp>
+#include <scener/math/vector.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    std::vector<float> generate_values(std::size_t count, float min, float max, std::uint32_t seed)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> distribution { min, max };
+        std::vector<float>                    values(count);
+
+        for (auto& value : values)
+        {
+            value = distribution(engine);
+        }
+
+        return values;
+    }
+
+    std::vector<vector3> generate_normals(std::size_t count, std::uint32_t seed)
+    {
+        auto                 values = generate_values(count * 3, -1.0f, 1.0f, seed);
+        std::vector<vector3> normals(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            normals[i] = vector::normalize(vector3 { values[i * 3], values[i * 3 + 1], values[i * 3 + 2] });
+        }
+
+        // Axes and octahedron folds
+        normals[0] = vector3::unit_z();
+        normals[1] = -vector3::unit_z();
+        normals[2] = -vector3::unit_x();
+        normals[3] = vector::normalize(vector3 { 1.0f, -1.0f, -1.0f });
+
+        return normals;
+    }
+
+    float angle_between(const vector3& lhs, const vector3& rhs)
+    {
+        // More accurate than the arc cosine of the dot product for small angles
+        return 2.0f * std::asin(std::min(1.0f, vector::distance(lhs, rhs) * 0.5f)) * 180.0f / pi<>;
+    }
+}
+
+TEST_F(packed_vector_test, normalized_integers)
+{
+    EXPECT_EQ(0u, packed::pack_unorm8(-0.5f));
+    EXPECT_EQ(128u, packed::pack_unorm8(0.5f));
+    EXPECT_EQ(255u, packed::pack_unorm8(2.0f));
+    EXPECT_EQ(0u, packed::pack_unorm8(NaN<>));
+    EXPECT_EQ(65535u, packed::pack_unorm16(1.0f));
+    EXPECT_EQ(-127, packed::pack_snorm8(-3.0f));
+    EXPECT_EQ(32767, packed::pack_snorm16(1.0f));
+    EXPECT_EQ(1.0f, packed::unpack_unorm8(255));
+    EXPECT_EQ(1.0f, packed::unpack_unorm16(65535));
+    EXPECT_EQ(-1.0f, packed::unpack_snorm8(-128));
+    EXPECT_EQ(-1.0f, packed::unpack_snorm16(-32768));
+    EXPECT_EQ(0.0f, packed::unpack_snorm16(0));
+
+    for (auto value : generate_values(1000, -1.0f, 1.0f, 1))
+    {
+        auto unsigned_value = std::abs(value);
+
+        EXPECT_LE(std::abs(packed::unpack_unorm8(packed::pack_unorm8(unsigned_value)) - unsigned_value), 0.5f / 255.0f + 1.0e-6f);
+        EXPECT_LE(std::abs(packed::unpack_unorm16(packed::pack_unorm16(unsigned_value)) - unsigned_value), 0.5f / 65535.0f + 1.0e-7f);
+        EXPECT_LE(std::abs(packed::unpack_snorm8(packed::pack_snorm8(value)) - value), 0.5f / 127.0f + 1.0e-6f);
+        EXPECT_LE(std::abs(packed::unpack_snorm16(packed::pack_snorm16(value)) - value), 0.5f / 32767.0f + 1.0e-7f);
+    }
+}
+
+TEST_F(packed_vector_test, normalized_integer_spans_match_scalar)
+{
+    auto values = generate_values(1001, -1.5f, 1.5f, 2);
+
+    values[3] = NaN<>;
+
+    std::vector<std::uint8_t>  unorm8(values.size());
+    std::vector<std::uint16_t> unorm16(values.size());
+    std::vector<std::int8_t>   snorm8(values.size());
+    std::vector<std::int16_t>  snorm16(values.size());
+    std::vector<float>         result(values.size());
+
+    packed::pack_unorm8(values, unorm8);
+    packed::pack_unorm16(values, unorm16);
+    packed::pack_snorm8(values, snorm8);
+    packed::pack_snorm16(values, snorm16);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_unorm8(values[i]), unorm8[i]);
+        EXPECT_EQ(packed::pack_unorm16(values[i]), unorm16[i]);
+        EXPECT_EQ(packed::pack_snorm8(values[i]), snorm8[i]);
+        EXPECT_EQ(packed::pack_snorm16(values[i]), snorm16[i]);
+    }
+
+    // Unpacking covers every encoding, including -128 and -32768
+    snorm8[5]  = -128;
+    snorm16[5] = -32768;
+
+    packed::unpack_unorm8(unorm8, result);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_unorm8(unorm8[i]), result[i]);
+    }
+
+    packed::unpack_unorm16(unorm16, result);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_unorm16(unorm16[i]), result[i]);
+    }
+
+    packed::unpack_snorm8(snorm8, result);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_snorm8(snorm8[i]), result[i]);
+    }
+
+    packed::unpack_snorm16(snorm16, result);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(packed::unpack_snorm16(snorm16[i]), result[i]);
+    }
+}
+
+TEST_F(packed_vector_test, normalized_vector_spans)
+{
+    auto normals = generate_normals(37, 3);
+
+    std::vector<basic_vector3<std::int16_t>> packed_normals(normals.size());
+    std::vector<vector3>                     unpacked(normals.size());
+
+    packed::pack_snorm16<3>(normals, packed_normals);
+    packed::unpack_snorm16<3>(packed_normals, unpacked);
+
+    for (std::size_t i = 0; i < normals.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_snorm16(normals[i].y), packed_normals[i].y);
+        EXPECT_LE(vector::distance(normals[i], unpacked[i]), 1.0e-4f);
+    }
+
+    // Empty vectors have no storage at all
+    std::vector<vector3>                     empty;
+    std::vector<basic_vector3<std::int16_t>> empty_packed;
+
+    packed::pack_snorm16<3>(empty, empty_packed);
+    packed::unpack_snorm16<3>(empty_packed, empty);
+
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(packed_vector_test, r10g10b10a2)
+{
+    EXPECT_EQ(0xFFFFFFFFu, packed::pack_r10g10b10a2({ 1.0f, 1.0f, 1.0f, 1.0f }));
+    EXPECT_EQ(0x000003FFu, packed::pack_r10g10b10a2({ 1.0f, 0.0f, -1.0f, 0.0f }));
+    EXPECT_EQ(0x40000000u, packed::pack_r10g10b10a2({ 0.0f, 0.0f, 0.0f, 0.4f }));
+    EXPECT_EQ(vector4(0.0f, 1.0f, 0.0f, 1.0f), packed::unpack_r10g10b10a2(0xC00FFC00u));
+
+    auto                 values = generate_values(4 * 103, -0.1f, 1.1f, 4);
+    std::vector<vector4> source(103);
+    std::vector<color>   colors(source.size());
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = { values[i * 4], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3] };
+        colors[i] = source[i];
+    }
+
+    std::vector<std::uint32_t> packed_values(source.size());
+    std::vector<std::uint32_t> packed_colors(source.size());
+    std::vector<vector4>       unpacked(source.size());
+    std::vector<color>         unpacked_colors(source.size());
+
+    packed::pack_r10g10b10a2(source, packed_values);
+    packed::pack_r10g10b10a2(colors, packed_colors);
+    packed::unpack_r10g10b10a2(packed_values, unpacked);
+    packed::unpack_r10g10b10a2(packed_colors, unpacked_colors);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        auto expected = vector4 { clamp(source[i].x, 0.0f, 1.0f)
+                                , clamp(source[i].y, 0.0f, 1.0f)
+                                , clamp(source[i].z, 0.0f, 1.0f)
+                                , clamp(source[i].w, 0.0f, 1.0f) };
+
+        EXPECT_EQ(packed::pack_r10g10b10a2(source[i]), packed_values[i]);
+        EXPECT_EQ(packed_values[i], packed_colors[i]);
+        EXPECT_EQ(packed::unpack_r10g10b10a2(packed_values[i]), unpacked[i]);
+        EXPECT_EQ(unpacked[i].z, unpacked_colors[i].b);
+        EXPECT_LE(std::abs(unpacked[i].x - expected.x), 0.5f / 1023.0f + 1.0e-6f);
+        EXPECT_LE(std::abs(unpacked[i].y - expected.y), 0.5f / 1023.0f + 1.0e-6f);
+        EXPECT_LE(std::abs(unpacked[i].z - expected.z), 0.5f / 1023.0f + 1.0e-6f);
+        EXPECT_LE(std::abs(unpacked[i].w - expected.w), 0.5f / 3.0f + 1.0e-6f);
+    }
+}
+
+TEST_F(packed_vector_test, rgb9e5)
+{
+    EXPECT_EQ(vector3::zero(), packed::unpack_rgb9e5(packed::pack_rgb9e5(vector3::zero())));
+    EXPECT_EQ(vector3(1.0f, 0.5f, 0.0f), packed::unpack_rgb9e5(packed::pack_rgb9e5({ 1.0f, 0.5f, -2.0f })));
+    EXPECT_EQ(vector3(packed::rgb9e5_max), packed::unpack_rgb9e5(packed::pack_rgb9e5(vector3 { 1.0e9f })));
+
+    // 511.75 rounds the mantissa up to 512, which bumps the shared exponent
+    EXPECT_EQ(vector3(512.0f, 0.0f, 2.0f), packed::unpack_rgb9e5(packed::pack_rgb9e5({ 511.75f, 0.0f, 2.0f })));
+
+    // Mantissas round to nearest, ties to even
+    EXPECT_EQ(vector3(300.0f, 2.0f, 4.0f), packed::unpack_rgb9e5(packed::pack_rgb9e5({ 300.0f, 2.5f, 3.5f })));
+    EXPECT_EQ(vector3(512.0f, 0.0f, 2.0f), packed::unpack_rgb9e5(packed::pack_rgb9e5({ 511.5f, 0.0f, 2.0f })));
+
+    auto                 values = generate_values(3 * 1003, 0.0f, 1.0f, 5);
+    std::vector<vector3> source(1003);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        // Spread the magnitudes over the whole exponent range
+        auto scale = std::ldexp(1.0f, int(i % 40) - 22);
+
+        source[i] = vector3 { values[i * 3], values[i * 3 + 1], values[i * 3 + 2] } * scale;
+    }
+
+    source[7] = { -1.0f, NaN<>, 3.0f };
+    source[9] = { 300.0f, 2.5f, 3.5f };
+
+    std::vector<std::uint32_t> packed_values(source.size());
+    std::vector<vector3>       unpacked(source.size());
+
+    packed::pack_rgb9e5(source, packed_values);
+    packed::unpack_rgb9e5(packed_values, unpacked);
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_rgb9e5(source[i]), packed_values[i]);
+        EXPECT_EQ(packed::unpack_rgb9e5(packed_values[i]), unpacked[i]);
+
+        if (i != 7)
+        {
+            auto largest = std::max({ source[i].x, source[i].y, source[i].z, std::ldexp(1.0f, -15) });
+
+            EXPECT_LE(vector::distance(vector::min(source[i], vector3 { packed::rgb9e5_max }), unpacked[i])
+                    , largest * std::ldexp(1.0f, -9) * 1.75f);
+        }
+    }
+}
+
+TEST_F(packed_vector_test, octahedral)
+{
+    EXPECT_EQ(vector2(0.0f, 0.0f), packed::encode_octahedral(vector3::unit_z()));
+    EXPECT_EQ(vector2(1.0f, 0.0f), packed::encode_octahedral(vector3::unit_x()));
+    EXPECT_EQ(vector3::unit_z(), packed::decode_octahedral({ 0.0f, 0.0f }));
+    EXPECT_EQ(-vector3::unit_z(), packed::decode_octahedral({ 1.0f, 1.0f }));
+
+    auto  normals   = generate_normals(2003, 6);
+    float max_error = 0.0f;
+
+    std::vector<std::uint32_t> packed_values(normals.size());
+    std::vector<vector3>       unpacked(normals.size());
+
+    packed::pack_octahedral16(normals, packed_values);
+    packed::unpack_octahedral16(packed_values, unpacked);
+
+    for (std::size_t i = 0; i < normals.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_octahedral16(normals[i]), packed_values[i]);
+        EXPECT_TRUE(equality_helper::equal(packed::unpack_octahedral16(packed_values[i]), unpacked[i]));
+        EXPECT_NEAR(1.0f, vector::length(unpacked[i]), 1.0e-5f);
+        EXPECT_TRUE(equality_helper::equal(packed::decode_octahedral(packed::encode_octahedral(normals[i])), normals[i]));
+
+        max_error = std::max(max_error, angle_between(normals[i], unpacked[i]));
+
+        EXPECT_LT(angle_between(normals[i], packed::unpack_octahedral8(packed::pack_octahedral8(normals[i]))), 1.2f);
+    }
+
+    EXPECT_LT(max_error, 0.005f);
+
+    std::vector<std::uint16_t> packed_small(normals.size());
+
+    packed::pack_octahedral8(normals, packed_small);
+    packed::unpack_octahedral8(packed_small, unpacked);
+
+    for (std::size_t i = 0; i < normals.size(); ++i)
+    {
+        EXPECT_EQ(packed::pack_octahedral8(normals[i]), packed_small[i]);
+        EXPECT_TRUE(equality_helper::equal(packed::unpack_octahedral8(packed_small[i]), unpacked[i]));
+    }
+}
@@ -0,0 +1,192 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "simd_test.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <scener/math/simd.hpp>
+
+using namespace scener::math;
+using namespace scener::math::detail;
+
+namespace
+{
+    template <typename V>
+    struct values
+    {
+        alignas(64) float data[V::size()];
+    };
+
+    template <typename V>
+    values<V> random_values(std::uint32_t seed, float low, float high)
+    {
+        std::mt19937                          engine { seed };
+        std::uniform_real_distribution<float> value { low, high };
+        values<V>                             result;
+
+        for (auto& item : result.data)
+        {
+            item = value(engine);
+        }
+
+        return result;
+    }
+
+    template <typename V>
+    values<V> stored(const V& value)
+    {
+        values<V> result;
+
+        value.store(result.data, vector_aligned);
+
+        return result;
+    }
+
+    /// Checks the operations of a simd type against the scalar ABI of the same width.
+    template <typename V>
+    void check_against_scalar()
+    {
+        using S = simd<float, V::size(), simd_abi::scalar>;
+
+        constexpr auto n = V::size();
+
+        auto a = random_values<V>(1, -10.0f, 10.0f);
+        auto b = random_values<V>(2, -10.0f, 10.0f);
+        auto c = random_values<V>(3, 0.5f, 100.0f);
+
+        // Equal lanes, so the comparisons see both outcomes
+        b.data[0] = a.data[0];
+
+        auto va = V::load(a.data, vector_aligned);
+        auto vb = V::load(b.data, element_aligned);
+        auto vc = V::load(c.data);
+        auto sa = S::load(a.data);
+        auto sb = S::load(b.data);
+        auto sc = S::load(c.data);
+
+        auto exact = [&](const V& v, const S& s)
+        {
+            auto result = stored(v);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(s[i], result.data[i]) << "lane " << i;
+            }
+        };
+
+        exact(va + vb, sa + sb);
+        exact(va - vb, sa - sb);
+        exact(va * vb, sa * sb);
+        exact(va / vc, sa / sc);
+        exact(-va, -sa);
+        exact(min(va, vb), min(sa, sb));
+        exact(max(va, vb), max(sa, sb));
+        exact(abs(va), abs(sa));
+        exact(sqrt(vc), sqrt(sc));
+        exact(select(va < vb, va, vb), select(sa < sb, sa, sb));
+        exact(shuffle<3, 2, 1, 0>(va), shuffle<3, 2, 1, 0>(sa));
+        exact(shuffle<1, 1, 0, 2>(vb), shuffle<1, 1, 0, 2>(sb));
+        exact(V::broadcast4(a.data), S::broadcast4(a.data));
+        exact(V { 2.5f }, S { 2.5f });
+        exact(round(va * V { 3.7f }), round(sa * S { 3.7f }));
+        exact(round(V { 2.5f }), S { 2.0f });
+        exact(round(V { -3.5f }), S { -4.0f });
+
+        values<V> e;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            e.data[i] = static_cast<float>(int(i % 21) - 10);
+        }
+
+        auto ve = V::load(e.data);
+        auto se = S::load(e.data);
+
+        exact(ldexp(va, ve), ldexp(sa, se));
+        exact(ldexp(V { 1.0f }, V { -126.0f }), S { std::numeric_limits<float>::min() });
+
+        auto vexponent = V { };
+        auto sexponent = S { };
+
+        exact(frexp(va, vexponent), frexp(sa, sexponent));
+        exact(vexponent, sexponent);
+
+        auto fused  = stored(fma(va, vb, vc));
+        auto approx = stored(rsqrt(vc));
+        auto scalar = rsqrt(sc);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(a.data[i] * b.data[i] + c.data[i], fused.data[i], 1e-4f);
+            EXPECT_NEAR(scalar[i], approx.data[i], scalar[i] * 1e-3f);
+            EXPECT_EQ(sa[i], va[i]);
+        }
+
+        EXPECT_NEAR(horizontal_add(sa), horizontal_add(va), 1e-4f);
+        EXPECT_EQ(horizontal_min(sa), horizontal_min(va));
+        EXPECT_EQ(horizontal_max(sa), horizontal_max(va));
+
+        EXPECT_EQ((sa == sb).bits(), (va == vb).bits());
+        EXPECT_EQ((sa != sb).bits(), (va != vb).bits());
+        EXPECT_EQ((sa < sb).bits(), (va < vb).bits());
+        EXPECT_EQ((sa <= sb).bits(), (va <= vb).bits());
+        EXPECT_EQ((sa > sb).bits(), (va > vb).bits());
+        EXPECT_EQ((sa >= sb).bits(), (va >= vb).bits());
+
+        auto lt = va < vb;
+        auto ge = va >= vb;
+
+        EXPECT_EQ(0u, (lt & ge).bits());
+        EXPECT_TRUE(all_of(lt | ge));
+        EXPECT_TRUE(all_of(lt ^ ge));
+        EXPECT_EQ(ge.bits(), (!lt).bits());
+        EXPECT_TRUE(any_of(va == vb));
+        EXPECT_TRUE(none_of(typename V::mask_type { false }));
+        EXPECT_TRUE(all_of(typename V::mask_type { true }));
+        EXPECT_EQ(lt[0], sa[0] < sb[0]);
+    }
+}
+
+TEST_F(simd_test, native_width)
+{
+    EXPECT_LE(std::size_t(1), simd_native_width);
+
+#if defined(__SSE2__)
+    static_assert(std::is_same_v<simd<float, 4>, simd<float, 4, simd_abi::sse>>);
+    EXPECT_LE(std::size_t(4), simd_native_width);
+#endif
+
+    static_assert(std::is_same_v<simd<float, 3>, simd<float, 3, simd_abi::scalar>>);
+
+#if defined(SCENER_MATH_SIMD_X86)
+    static_assert(std::is_same_v<simd_abi::fixed, simd_abi::sse>);
+#else
+    static_assert(std::is_same_v<simd_abi::fixed, simd_abi::scalar>);
+#endif
+}
+
+TEST_F(simd_test, native_matches_scalar)
+{
+    check_against_scalar<simd<float, 4>>();
+    check_against_scalar<simd<float, simd_native_width>>();
+}
+
+TEST_F(simd_test, scalar)
+{
+    check_against_scalar<simd<float, 8, simd_abi::scalar>>();
+    check_against_scalar<simd<float, 16, simd_abi::scalar>>();
+}
+
+TEST_F(simd_test, scalar_mask)
+{
+    auto m = mask<5, simd_abi::scalar>::from_bits(0xFF);
+
+    EXPECT_EQ(0x1Fu, m.bits());
+    EXPECT_TRUE(all_of(m));
+    EXPECT_EQ(0u, (!m).bits());
+    EXPECT_TRUE(none_of(!m));
+    EXPECT_EQ(0x15u, (m & mask<5, simd_abi::scalar>::from_bits(0x15)).bits());
+}
@@ -0,0 +1,83 @@
+// Copyright (c) Carlos Guzmán Álvarez. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include "tonemapping_test.hpp"
+
+#include <random>
+#include <vector>
+
+#include <scener/math/tonemapping.hpp>
+
+using namespace scener::math;
+
+namespace
+{
+    template <typename Operator>
+    void check_batch(Operator op)
+    {
+        std::mt19937                          engine { 3 };
+        std::uniform_real_distribution<float> distribution { 0.0f, 16.0f };
+        std::vector<float>                    r(1003);
+        std::vector<float>                    g(r.size());
+        std::vector<float>                    b(r.size());
+
+        for (std::size_t i = 0; i < r.size(); ++i)
+        {
+            r[i] = distribution(engine);
+            g[i] = distribution(engine);
+            b[i] = distribution(engine);
+        }
+
+        auto source = std::vector<color>(r.size());
+
+        for (std::size_t i = 0; i < r.size(); ++i)
+        {
+            source[i] = { r[i], g[i], b[i], 0.5f };
+        }
+
+        op(color_planes { r, g, b }, color_planes { r, g, b });
+
+        for (std::size_t i = 0; i < r.size(); ++i)
+        {
+            auto expected = op(source[i]);
+
+            EXPECT_NEAR(expected.r, r[i], 1e-6f);
+            EXPECT_NEAR(expected.g, g[i], 1e-6f);
+            EXPECT_NEAR(expected.b, b[i], 1e-6f);
+            EXPECT_EQ(0.5f, expected.a);
+        }
+    }
+}
+
+TEST_F(tonemapping_test, reinhard)
+{
+    EXPECT_EQ(color(0.5f, 0.0f, 0.75f, 0.25f), tonemap::reinhard(color { 1.0f, 0.0f, 3.0f, 0.25f }));
+    EXPECT_NEAR(1.0f, tonemap::reinhard(color { 4.0f, 4.0f, 4.0f, 1.0f }, 4.0f).r, 1e-6f);
+    EXPECT_NEAR(0.53125f, tonemap::reinhard(color { 1.0f, 1.0f, 1.0f, 1.0f }, 4.0f).g, 1e-6f);
+
+    check_batch([](auto&&... args) { return tonemap::reinhard(args...); });
+    check_batch([](auto&&... args) { return tonemap::reinhard(args..., 16.0f); });
+}
+
+TEST_F(tonemapping_test, aces_fitted)
+{
+    auto black = tonemap::aces_fitted(color { 0.0f, 0.0f, 0.0f, 1.0f });
+    auto grey  = tonemap::aces_fitted(color { 0.18f, 0.18f, 0.18f, 1.0f });
+    auto white = tonemap::aces_fitted(color { 100.0f, 100.0f, 100.0f, 1.0f });
+
+    EXPECT_NEAR(0.0f, black.r, 1e-3f);
+    EXPECT_NEAR(0.1056f, grey.g, 1e-3f);
+    EXPECT_NEAR(1.0f, white.b, 1e-3f);
+    EXPECT_NEAR(grey.r, grey.b, 1e-3f);
+
+    check_batch([](auto&&... args) { return tonemap::aces_fitted(args...); });
+}
+
+TEST_F(tonemapping_test, filmic)
+{
+    EXPECT_NEAR(0.0f, tonemap::filmic(color { 0.0f, 0.0f, 0.0f, 1.0f }).r, 1e-6f);
+    EXPECT_NEAR(1.0f, tonemap::filmic(color { 11.2f, 11.2f, 11.2f, 1.0f }).g, 1e-6f);
+    EXPECT_NEAR(1.0f, tonemap::filmic(color { 4.0f, 4.0f, 4.0f, 1.0f }, 4.0f).b, 1e-6f);
+
+    check_batch([](auto&&... args) { return tonemap::filmic(args...); });
+}